@@ -1 +1,13 @@
 extern const unsigned char *anim;
+
+//The nyan cat GIF, for the on-device decoder
+extern const unsigned char nyan_gif[];
+extern const unsigned nyan_gif_len;
+
+//Lenna still and the nyan cat frames as QOI images, for src/qoi.c
+extern const unsigned char lenna_qoi[], nyan_qoi[];
+extern const unsigned lenna_qoi_len, nyan_qoi_len;
+
+//The nyan cat frames as block video, for src/blockvid.c
+extern const unsigned char nyan_bv[];
+extern const unsigned nyan_bv_len;
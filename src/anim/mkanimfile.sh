@@ -1,21 +1,43 @@
 #!/bin/bash
 
 #Simple and stupid script to (re)generate image data. Needs an Unix-ish environment with
-#ImageMagick and xxd installed.
+#ImageMagick and xxd installed and the tools built in the top directory.
 
 convert nyan_64x32.gif nyan_64x32-f%02d.rgb
 convert lenna.png lenna.rgb
 
-OUTF="../anim.c"
+#Raw frames go through tools/transcode.c (built in the top directory) unchanged:
+#8 bits, no gamma, no dither. Videos can be converted the same way, e.g.
+#  ../../transcode -W 64x32 -r 10 -f c clip.mp4 ../anim.c
+cat nyan_64x32-f*.rgb lenna.rgb | ../../transcode -s 64x32 -W 64x32 -p 8 -g 1 -f c - ../anim.c
 
-echo '//Auto-generated' > $OUTF
-echo 'static const unsigned char myanim[]={' >> $OUTF
-{
-	for x in nyan_64x32-f*.rgb; do
-		echo $x >&2
-		cat $x
-	done 
-	cat lenna.rgb
-} | xxd -i >> $OUTF
-echo "};" >> $OUTF
-echo 'const unsigned char *anim=&myanim[0];' >> $OUTF
+#GIFs are decoded on the device (src/gif.c), they go in as they are
+OUTG="../anim_gif.c"
+echo '//Auto-generated' > $OUTG
+echo 'const unsigned char nyan_gif[]={' >> $OUTG
+xxd -i < nyan_64x32.gif >> $OUTG
+echo "};" >> $OUTG
+echo 'const unsigned nyan_gif_len=sizeof(nyan_gif);' >> $OUTG
+
+#QOI stills and frame sequences, needs tools/qoiconv.c built in the top directory
+../../qoiconv lenna.qoi lenna.rgb
+../../qoiconv nyan.qoi nyan_64x32-f*.rgb
+OUTQ="../anim_qoi.c"
+echo '//Auto-generated' > $OUTQ
+for x in lenna nyan; do
+	echo "const unsigned char ${x}_qoi[]={" >> $OUTQ
+	xxd -i < $x.qoi >> $OUTQ
+	echo "};" >> $OUTQ
+	echo "const unsigned ${x}_qoi_len=sizeof(${x}_qoi);" >> $OUTQ
+done
+rm lenna.qoi nyan.qoi
+
+#Block video of the nyan cat frames, needs tools/bvconv.c built in the top directory
+../../bvconv nyan.bv nyan_64x32-f*.rgb
+OUTB="../anim_bv.c"
+echo '//Auto-generated' > $OUTB
+echo 'const unsigned char nyan_bv[]={' >> $OUTB
+xxd -i < nyan.bv >> $OUTB
+echo "};" >> $OUTB
+echo 'const unsigned nyan_bv_len=sizeof(nyan_bv);' >> $OUTB
+rm nyan.bv
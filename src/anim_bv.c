@@ -0,0 +1,519 @@
+//Auto-generated
+const unsigned char nyan_bv[]={
+  0x42, 0x56, 0x04, 0x00, 0x40, 0x00, 0x20, 0x00, 0x0c, 0x00, 0x64, 0x00,
+  0x4b, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00,
+  0x44, 0x46, 0x0f, 0x4d, 0x8f, 0xc2, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0xc2, 0x0f,
+  0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x55, 0xaa, 0xc2, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xc2, 0x0f, 0x4d, 0x8f,
+  0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+  0xaa, 0xc2, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0xc1, 0x0f, 0x4d, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x40, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff,
+  0xff, 0xff, 0x03, 0x00, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x05,
+  0x04, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x08, 0x00, 0x41, 0x0f,
+  0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xc1,
+  0x0f, 0x4d, 0x8f, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc2, 0x0f, 0x4d, 0x8f,
+  0xff, 0x00, 0x00, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
+  0x5a, 0xc2, 0x0f, 0x4d, 0x8f, 0xff, 0x00, 0x00, 0xff, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0xc0, 0x0f, 0x4d, 0x8f, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xc2, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x15, 0x55, 0x65, 0x55,
+  0xc1, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x02, 0x00, 0xc2, 0xff, 0x99,
+  0xff, 0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x28, 0xc2, 0xff, 0x99, 0xff, 0xff, 0xcc, 0x99, 0xff, 0x33, 0x99,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x20, 0xc2, 0xff, 0xcc, 0x99, 0x00,
+  0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x19,
+  0xc1, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x0f, 0x4d,
+  0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x40, 0x06, 0xc1, 0xff,
+  0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x77, 0xf4, 0x41, 0x0f, 0x4d, 0x8f, 0xc2,
+  0xff, 0x00, 0x00, 0xff, 0x99, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x55, 0x56, 0xaa, 0xc1, 0xff, 0x99, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xc2, 0xff, 0x99, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33,
+  0xff, 0x00, 0x00, 0x06, 0x56, 0x5e, 0xc2, 0xff, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0x00, 0x99, 0x99, 0x99, 0x00, 0x56, 0xf5, 0x7d, 0xc0,
+  0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff,
+  0xc2, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00,
+  0x00, 0x15, 0x51, 0x55, 0x58, 0xc1, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99,
+  0x04, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x67, 0x77, 0xc2,
+  0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x95, 0xaa, 0xc2, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x99,
+  0x99, 0x99, 0x00, 0x00, 0x00, 0x16, 0x1a, 0x6a, 0xaa, 0xc2, 0x99, 0x99,
+  0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x41, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff,
+  0xff, 0x08, 0x80, 0x41, 0x0f, 0x4d, 0x8f, 0xc2, 0xff, 0xff, 0x00, 0x33,
+  0xff, 0x00, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0x01, 0x55, 0x56, 0xaa,
+  0xc1, 0x33, 0xff, 0x00, 0x00, 0x99, 0xff, 0x00, 0xff, 0xc2, 0x33, 0xff,
+  0x00, 0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x55, 0x5a, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x99, 0xff,
+  0x66, 0x33, 0xff, 0x05, 0x81, 0xaa, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x99, 0x99, 0x99, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x66, 0x33, 0xff, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xc2, 0xff, 0x99, 0xff,
+  0xff, 0x33, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80,
+  0x10, 0xc2, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x02, 0x42, 0x02, 0xc2, 0x99, 0x99, 0x99, 0xff, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x99, 0x99, 0x01, 0x02, 0x3c, 0x3c, 0xc1,
+  0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x77, 0xf6, 0xc2, 0x99, 0x99, 0x99,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00,
+  0x08, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0xff,
+  0x99, 0x99, 0x06, 0x06, 0xf6, 0xf6, 0x44, 0x0f, 0x4d, 0x8f, 0xc2, 0x00,
+  0x99, 0xff, 0x66, 0x33, 0xff, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x01,
+  0x55, 0x56, 0xaa, 0xc1, 0x66, 0x33, 0xff, 0x0f, 0x4d, 0x8f, 0x00, 0xff,
+  0xc1, 0x66, 0x33, 0xff, 0x0f, 0x4d, 0x8f, 0x03, 0xff, 0xc2, 0x66, 0x33,
+  0xff, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+  0x56, 0x56, 0xc2, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99,
+  0x99, 0x99, 0x99, 0x1a, 0x56, 0xfd, 0xf5, 0xc0, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0xcc, 0x99, 0xff,
+  0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00,
+  0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc2, 0xff, 0x99, 0xff,
+  0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00, 0x55, 0xaa,
+  0xbf, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xff, 0xcc, 0x99, 0x0f,
+  0x4d, 0x8f, 0x15, 0x85, 0x00, 0xf1, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99,
+  0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x48, 0xc2,
+  0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00,
+  0x01, 0x55, 0x00, 0x52, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f,
+  0x4d, 0x8f, 0x00, 0x00, 0x00, 0x1a, 0x6a, 0xaa, 0xaa, 0x47, 0x0f, 0x4d,
+  0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x10, 0x00, 0xc1, 0x00,
+  0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x1f, 0xff, 0xc1, 0x0f, 0x4d, 0x8f, 0x00,
+  0x00, 0x00, 0x70, 0x00, 0x40, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f,
+  0x3f, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x3f, 0xff, 0x55,
+  0x0f, 0x4d, 0x8f, 0x64, 0x80, 0x15, 0x80, 0xfa, 0x00, 0x80, 0xff, 0x00,
+  0x40, 0x0f, 0x4d, 0x8f, 0x80, 0x00, 0xff, 0x80, 0xff, 0x00, 0x00, 0x40,
+  0x0f, 0x4d, 0x8f, 0x07, 0x83, 0xff, 0x00, 0x01, 0xc0, 0x66, 0x33, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x99, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xff, 0xff,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xc2, 0x66, 0x33,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xaa,
+  0xaa, 0xaa, 0x07, 0x83, 0xff, 0x00, 0xc1, 0xff, 0x99, 0xff, 0xff, 0x33,
+  0x99, 0x20, 0x80, 0xc1, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x08, 0x04,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99,
+  0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc,
+  0x99, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x66,
+  0x33, 0xff, 0x05, 0x40, 0xa9, 0xff, 0xc2, 0x33, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x01, 0x0a, 0xaa, 0xaf, 0x03,
+  0x40, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x01,
+  0x40, 0x80, 0x02, 0xfe, 0x80, 0xff, 0x00, 0xc2, 0xff, 0xcc, 0x99, 0x00,
+  0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99, 0x99, 0x99, 0x19, 0x17, 0x5f, 0xff,
+  0x81, 0xff, 0x00, 0x00, 0x80, 0x03, 0xfe, 0xc0, 0xff, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x33, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xc0, 0xff, 0x99, 0x00,
+  0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x33, 0xff, 0x00, 0xc2, 0xff, 0x99,
+  0x00, 0xff, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x55, 0x5b, 0x03, 0x80, 0x00, 0xfa, 0x80, 0xfe, 0x05, 0xc1, 0x0f, 0x4d,
+  0x8f, 0xff, 0xff, 0xff, 0x21, 0x02, 0x80, 0xff, 0x00, 0xc2, 0xff, 0xcc,
+  0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x00, 0xc2, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0a, 0x08, 0x40, 0x0f, 0x4d,
+  0x8f, 0x82, 0x03, 0x06, 0x0c, 0x80, 0x01, 0x02, 0xc1, 0x0f, 0x4d, 0x8f,
+  0xff, 0xff, 0xff, 0x00, 0x28, 0x0a, 0x64, 0x80, 0x06, 0xc1, 0x0f, 0x4d,
+  0x8f, 0xff, 0xff, 0xff, 0x08, 0x48, 0x80, 0x01, 0xff, 0x0b, 0x82, 0xff,
+  0xff, 0x00, 0x82, 0xff, 0xff, 0x08, 0x85, 0x00, 0xff, 0xc0, 0xff, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x11,
+  0xaa, 0x9a, 0x9a, 0xc2, 0x66, 0x33, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0x05, 0x0a, 0xaa, 0xaa, 0x06, 0x84, 0x00, 0xff,
+  0xc1, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x28, 0x00, 0xc0, 0x33, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x99, 0x99,
+  0x99, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xc0, 0x33,
+  0xff, 0x00, 0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00,
+  0x99, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xc2,
+  0x33, 0xff, 0x00, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0x66, 0x33, 0xff,
+  0x00, 0x05, 0x56, 0x5e, 0x04, 0x41, 0x0f, 0x4d, 0x8f, 0x84, 0x00, 0xff,
+  0x40, 0xff, 0x99, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0xf9, 0x01, 0x03,
+  0x43, 0x0f, 0x4d, 0x8f, 0x84, 0x00, 0xff, 0xc0, 0x0f, 0x4d, 0x8f, 0x0f,
+  0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x06, 0x43, 0x0f, 0x4d,
+  0x8f, 0x83, 0xff, 0xff, 0x80, 0x00, 0xff, 0x06, 0x41, 0x0f, 0x4d, 0x8f,
+  0x0a, 0x64, 0x00, 0x3f, 0x00, 0xc2, 0x33, 0xff, 0x00, 0x00, 0x99, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x55, 0xc0, 0x33,
+  0xff, 0x00, 0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x33,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0x00,
+  0x99, 0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0x99, 0xff, 0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0xc2,
+  0x33, 0xff, 0x00, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0x00, 0x6b, 0xbf, 0xfa, 0xc0, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x0b, 0xc2, 0x66, 0x33, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x04, 0x00, 0xa9, 0xaa, 0xc2,
+  0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x01, 0x0a, 0xab, 0xba, 0xc0, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x00,
+  0x00, 0x00, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x0f,
+  0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x0f,
+  0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0xc0, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x99, 0x99, 0x99, 0xff,
+  0x99, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x16, 0x0b, 0x2f, 0xaf,
+  0x01, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x02, 0x2d, 0x80, 0xfe,
+  0xfe, 0x04, 0x85, 0x01, 0x00, 0x40, 0x0f, 0x4d, 0x8f, 0x01, 0xc1, 0x0f,
+  0x4d, 0x8f, 0xff, 0xff, 0xff, 0x22, 0x00, 0x07, 0xc1, 0x0f, 0x4d, 0x8f,
+  0xff, 0xff, 0xff, 0x00, 0x30, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x44, 0xb4, 0x40, 0x0f, 0x4d, 0x8f, 0x06, 0x64, 0x00, 0x12, 0xc1, 0xff,
+  0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x7f, 0xff, 0x1d, 0xc2, 0xff, 0x99, 0x00,
+  0xff, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
+  0x5b, 0xc2, 0xff, 0x99, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33,
+  0xff, 0x00, 0x00, 0x55, 0x55, 0xab, 0x02, 0x80, 0x01, 0x00, 0xc0, 0xff,
+  0x99, 0xff, 0xff, 0x33, 0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff,
+  0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0x99,
+  0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2,
+  0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99, 0x99, 0x99,
+  0x19, 0x17, 0x1f, 0x7f, 0x80, 0x01, 0x00, 0x05, 0x80, 0xff, 0x00, 0xc0,
+  0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff,
+  0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x66, 0x33, 0xff,
+  0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x66, 0x33,
+  0xff, 0x05, 0x00, 0xa9, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0xc2, 0xff, 0x99, 0xff, 0xff,
+  0x33, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x42,
+  0x83, 0x01, 0x00, 0x05, 0x80, 0xff, 0x00, 0x80, 0xf9, 0x01, 0xc2, 0x66,
+  0x33, 0xff, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00,
+  0x55, 0x56, 0x5b, 0xc2, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0x99, 0x99, 0x99, 0x1a, 0x5a, 0x56, 0xf5, 0x00, 0x83, 0x01, 0x00,
+  0xc2, 0xff, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99, 0x99,
+  0x99, 0x06, 0xda, 0x6a, 0xaa, 0x80, 0x05, 0x00, 0xc1, 0x0f, 0x4d, 0x8f,
+  0xff, 0xff, 0xff, 0x22, 0x0a, 0x80, 0x03, 0x00, 0x40, 0x0f, 0x4d, 0x8f,
+  0x03, 0x80, 0x02, 0x00, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f,
+  0x4d, 0x8f, 0xff, 0xff, 0xff, 0x19, 0x6b, 0xaa, 0xba, 0xc2, 0x99, 0x99,
+  0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x06, 0x56,
+  0xaa, 0xba, 0x80, 0x04, 0x01, 0x82, 0x02, 0x00, 0x01, 0x80, 0x00, 0xfb,
+  0x40, 0x0f, 0x4d, 0x8f, 0x05, 0x80, 0xfe, 0xfe, 0x80, 0x04, 0x00, 0xc1,
+  0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x40, 0x50, 0x80, 0x03, 0x00, 0x07,
+  0x64, 0x00, 0x01, 0x80, 0x04, 0x01, 0x0d, 0x80, 0x05, 0x00, 0xc1, 0x0f,
+  0x4d, 0x8f, 0xff, 0xff, 0xff, 0x48, 0x00, 0x40, 0x0f, 0x4d, 0x8f, 0x12,
+  0xc2, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x55, 0x65, 0x7d, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x0f, 0x4d,
+  0x8f, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x15, 0x85, 0x85, 0x84, 0x80,
+  0x00, 0x01, 0x07, 0xc0, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0xff, 0x99,
+  0x00, 0xff, 0x99, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00,
+  0x00, 0x33, 0xff, 0x00, 0x01, 0xc2, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xc2, 0x00,
+  0x00, 0x00, 0x99, 0x99, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x14,
+  0x95, 0x25, 0x95, 0xc2, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00,
+  0x00, 0x99, 0x99, 0x99, 0x10, 0x80, 0xea, 0xff, 0x81, 0x00, 0x01, 0x06,
+  0xc2, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x66, 0x33,
+  0xff, 0x01, 0x0a, 0xaa, 0xaf, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x05, 0x40, 0xa9, 0xff, 0x01, 0xc2,
+  0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff, 0x33, 0x99, 0x00, 0x00, 0x00,
+  0x01, 0x09, 0x01, 0x81, 0x83, 0x00, 0x01, 0x08, 0xc2, 0x66, 0x33, 0xff,
+  0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x99, 0x99, 0x99, 0x1a, 0x5a, 0xd6,
+  0xf5, 0x00, 0x80, 0xff, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0xff, 0x99, 0xff, 0xff, 0xcc, 0x99, 0x15, 0x85, 0xf0, 0x00, 0xc1, 0x00,
+  0x00, 0x00, 0x99, 0x99, 0x99, 0x0f, 0x00, 0x81, 0x00, 0x01, 0xc1, 0x0f,
+  0x4d, 0x8f, 0xff, 0xff, 0xff, 0x14, 0x08, 0xc1, 0x0f, 0x4d, 0x8f, 0xff,
+  0xff, 0xff, 0x04, 0x02, 0x40, 0x0f, 0x4d, 0x8f, 0x05, 0xc2, 0x99, 0x99,
+  0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x19, 0x69,
+  0xaa, 0xea, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f,
+  0xff, 0xff, 0xff, 0x06, 0x5a, 0xaa, 0xae, 0x40, 0x0f, 0x4d, 0x8f, 0xc2,
+  0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00,
+  0x1a, 0x15, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99,
+  0x99, 0x99, 0x00, 0x00, 0x00, 0x12, 0x54, 0x55, 0x55, 0x01, 0x80, 0x02,
+  0xfb, 0x80, 0xfe, 0x01, 0x06, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x00, 0x10, 0xc1, 0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x7f, 0xff, 0xc1,
+  0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x7f, 0xbf, 0x40, 0x0f, 0x4d, 0x8f,
+  0x07, 0x64, 0x00, 0x00, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00,
+  0x44, 0x40, 0x0f, 0x4d, 0x8f, 0x05, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff,
+  0xff, 0x00, 0x06, 0xc1, 0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x77, 0xf4,
+  0x04, 0x80, 0x04, 0x00, 0xc1, 0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x4b,
+  0xbf, 0x40, 0x0f, 0x4d, 0x8f, 0x00, 0x85, 0x00, 0x01, 0xc1, 0x0f, 0x4d,
+  0x8f, 0xff, 0xff, 0xff, 0x08, 0x80, 0x04, 0xc2, 0x0f, 0x4d, 0x8f, 0xff,
+  0x00, 0x00, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0xa9,
+  0x00, 0x81, 0xf9, 0xff, 0xc0, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x81, 0x00, 0x01, 0xc2, 0xff, 0x99, 0xff,
+  0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x28, 0x80, 0x00, 0x01, 0xc2, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x0f,
+  0x4d, 0x8f, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x19, 0x05, 0xc2, 0xff,
+  0x99, 0x00, 0xff, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x54, 0x55, 0xa9, 0x00, 0xc2, 0xff, 0x99, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x00, 0x05, 0x02, 0xf2, 0xfe, 0xc2, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x00, 0x99, 0x99, 0x99, 0x00, 0x56,
+  0xf5, 0x7d, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99,
+  0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99,
+  0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99,
+  0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99,
+  0xff, 0x99, 0xff, 0xc2, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33,
+  0x99, 0x00, 0x00, 0x00, 0x01, 0x10, 0x01, 0x48, 0xc1, 0xff, 0x99, 0xff,
+  0xff, 0xff, 0xff, 0x44, 0xb6, 0xc1, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0x67, 0x77, 0xc2, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x95, 0xaa, 0x06, 0xc2, 0x33, 0xff, 0x00,
+  0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55,
+  0xa9, 0x00, 0x80, 0xf9, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99,
+  0x33, 0xff, 0x00, 0x00, 0x99, 0xff, 0x05, 0x81, 0xaa, 0xff, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x99,
+  0x99, 0x99, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00,
+  0x99, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xc2,
+  0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0x02, 0x10, 0xc2, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x33, 0x99, 0x00, 0x00, 0x00, 0x1b, 0x13, 0x83, 0x03, 0x08, 0xc1, 0x66,
+  0x33, 0xff, 0x0f, 0x4d, 0x8f, 0x0e, 0xff, 0x00, 0x80, 0xf9, 0xff, 0xc2,
+  0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f,
+  0x00, 0x55, 0x56, 0xfe, 0xc2, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0x99, 0x99, 0x99, 0x1a, 0x56, 0xfd, 0xf5, 0xc0, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0xcc,
+  0x99, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc2, 0xff,
+  0x99, 0xff, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00,
+  0x55, 0xaa, 0xbf, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xff, 0xcc,
+  0x99, 0x0f, 0x4d, 0x8f, 0x15, 0x85, 0x00, 0xf1, 0xc2, 0x00, 0x00, 0x00,
+  0x99, 0x99, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
+  0x48, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x0f, 0x4d, 0x8f, 0x00,
+  0x00, 0x00, 0x01, 0x55, 0x00, 0x52, 0x00, 0x41, 0x0f, 0x4d, 0x8f, 0x04,
+  0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x01, 0xc2, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x80, 0x20, 0xc1, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x1f, 0xff, 0x80,
+  0xfa, 0x00, 0x00, 0x80, 0xff, 0xff, 0x80, 0x04, 0x01, 0x80, 0x00, 0x01,
+  0x00, 0x41, 0x0f, 0x4d, 0x8f, 0x05, 0x80, 0x01, 0xff, 0x42, 0x0f, 0x4d,
+  0x8f, 0x08, 0x64, 0x80, 0x0b, 0x40, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d,
+  0x8f, 0xff, 0xff, 0xff, 0x44, 0x00, 0x07, 0x80, 0xfa, 0x00, 0x80, 0xff,
+  0x00, 0x40, 0x0f, 0x4d, 0x8f, 0x80, 0x00, 0xff, 0x80, 0xff, 0x00, 0x00,
+  0x40, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x04,
+  0x4b, 0x80, 0x02, 0xfe, 0x05, 0x83, 0xff, 0x00, 0x01, 0xc0, 0x00, 0x99,
+  0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x66, 0x33,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x00, 0x00,
+  0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x80, 0xff,
+  0x00, 0x07, 0x83, 0xff, 0x00, 0xc1, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99,
+  0x20, 0x80, 0xc2, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x99,
+  0x00, 0x00, 0x00, 0x10, 0x90, 0x00, 0x20, 0x00, 0xc2, 0x99, 0x99, 0x99,
+  0x00, 0x00, 0x00, 0x33, 0xff, 0x00, 0x00, 0x99, 0xff, 0x05, 0x40, 0xa9,
+  0xff, 0xc2, 0x33, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x99, 0xff, 0x06, 0x00, 0xf0, 0xff, 0x06, 0x80, 0xff, 0x00, 0xc2, 0xff,
+  0xcc, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99, 0x99, 0x99, 0x19,
+  0x17, 0x5f, 0xff, 0x80, 0xff, 0x00, 0xc2, 0xff, 0x99, 0xff, 0x00, 0x00,
+  0x00, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x1a, 0xc2,
+  0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x80, 0x00, 0xc2, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x33, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x08, 0xc0, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xc0, 0xff,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+  0x99, 0x00, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc2,
+  0xff, 0x99, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0xa0, 0xab, 0x06, 0x80, 0xff, 0x00, 0xc2, 0xff, 0xcc, 0x99,
+  0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a,
+  0x1a, 0x00, 0xc2, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0a, 0x00, 0xc2, 0xff, 0xcc, 0x99,
+  0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0xff, 0xff, 0xff, 0x15, 0x55, 0x65,
+  0x75, 0x09, 0x40, 0x0f, 0x4d, 0x8f, 0xc2, 0x0f, 0x4d, 0x8f, 0xff, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x80, 0xc2,
+  0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99,
+  0x00, 0x01, 0xaa, 0xff, 0xc2, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0x00, 0x04, 0xaa, 0xff, 0x04, 0xc1, 0xff,
+  0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x3f, 0xff, 0xc1, 0x0f, 0x4d, 0x8f, 0xff,
+  0xff, 0xff, 0x50, 0x44, 0x04, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x00, 0x08, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x41, 0x00, 0xc1,
+  0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x01, 0x0a, 0x80, 0x02, 0x02, 0x04,
+  0x40, 0x0f, 0x4d, 0x8f, 0x80, 0x00, 0x05, 0x64, 0x80, 0x0c, 0x40, 0x0f,
+  0x4d, 0x8f, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x02, 0x20, 0x05,
+  0x82, 0xff, 0xff, 0x00, 0x82, 0xff, 0xff, 0x00, 0xc1, 0x0f, 0x4d, 0x8f,
+  0xff, 0xff, 0xff, 0x00, 0x0c, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x22, 0x02, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x03, 0x04,
+  0x85, 0x00, 0xff, 0xc0, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0xcc, 0x99, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0xcc, 0x99, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x99, 0x99,
+  0x99, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x66, 0x33, 0xff, 0x0f,
+  0x4d, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0x07, 0x84, 0x00,
+  0xff, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x00,
+  0x00, 0x00, 0x19, 0x95, 0x55, 0x55, 0xc0, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xc2, 0xff, 0xff, 0x00, 0x33,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x6a, 0xbf, 0xfe,
+  0xc2, 0x33, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x99, 0xff, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0xa3, 0xab, 0x06, 0x83, 0x00, 0xff, 0xc1, 0xff, 0x99,
+  0xff, 0xff, 0x33, 0x99, 0x00, 0x40, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x99,
+  0xff, 0x7f, 0xbf, 0xc0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xc2, 0xff, 0x00, 0x00, 0xff, 0x99, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x55, 0x56, 0xff, 0x80, 0xf9, 0xff,
+  0x05, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x01, 0x10, 0x40, 0x0f,
+  0x4d, 0x8f, 0x84, 0x00, 0xff, 0xc0, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f,
+  0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0x06, 0xc1, 0x0f, 0x4d, 0x8f, 0xff,
+  0xff, 0xff, 0x00, 0x06, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x11,
+  0x0d, 0x80, 0x04, 0xfd, 0x40, 0x0f, 0x4d, 0x8f, 0x81, 0xf8, 0xff, 0x81,
+  0xff, 0xff, 0x80, 0x00, 0xff, 0x01, 0x40, 0x0f, 0x4d, 0x8f, 0xc1, 0x0f,
+  0x4d, 0x8f, 0xff, 0xff, 0xff, 0x40, 0x80, 0x04, 0x43, 0x0f, 0x4d, 0x8f,
+  0x05, 0x80, 0x01, 0x02, 0x64, 0x00, 0x40, 0x0f, 0x4d, 0x8f, 0x03, 0xc1,
+  0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x12, 0xc1, 0x0f, 0x4d, 0x8f,
+  0xff, 0xff, 0xff, 0x00, 0x08, 0x08, 0x40, 0x0f, 0x4d, 0x8f, 0x03, 0xc2,
+  0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xaa, 0x03, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x14, 0x08, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x04, 0x02, 0x40,
+  0x0f, 0x4d, 0x8f, 0x06, 0xc0, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0xcc, 0x99, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x01, 0xc2, 0xff, 0xcc, 0x99, 0xff, 0xff,
+  0xff, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x01, 0xa9, 0x96, 0xa9, 0xc2,
+  0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x50, 0xa4, 0x55, 0x00, 0x80, 0x02, 0xfb, 0x80, 0xfe, 0x01, 0x06,
+  0x80, 0xff, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0x40, 0xff, 0x99, 0xff, 0x00, 0xc2, 0xff, 0x99,
+  0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x06, 0x1f,
+  0x1f, 0x1f, 0x09, 0xc2, 0x33, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x99,
+  0xff, 0x00, 0x00, 0x00, 0x05, 0x00, 0xa0, 0xab, 0xc2, 0xff, 0xff, 0x00,
+  0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x6b, 0xbf,
+  0xfa, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0xc1, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x28, 0x00, 0x0b,
+  0xc2, 0x66, 0x33, 0xff, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x4d,
+  0x8f, 0x06, 0x00, 0xf0, 0xff, 0xc0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x66, 0x33, 0xff, 0x66, 0x33, 0xff, 0x66, 0x33, 0xff, 0x66, 0x33, 0xff,
+  0x66, 0x33, 0xff, 0x66, 0x33, 0xff, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f,
+  0x0f, 0x4d, 0x8f, 0x0f, 0x4d, 0x8f, 0xc0, 0x00, 0x99, 0xff, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x66, 0x33, 0xff, 0x00, 0x00,
+  0x00, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0x66, 0x33, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x04, 0xc2, 0x99, 0x99, 0x99,
+  0xff, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x16, 0x0b, 0x2f,
+  0xaf, 0x04, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x28, 0x00, 0xc1,
+  0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x08, 0x04, 0x40, 0x0f, 0x4d, 0x8f,
+  0x00, 0x82, 0x01, 0x00, 0xc2, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x81, 0x01, 0x00,
+  0x40, 0x0f, 0x4d, 0x8f, 0x04, 0x80, 0x02, 0xfb, 0x80, 0x01, 0xfe, 0x03,
+  0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x70, 0xc1, 0x0f, 0x4d,
+  0x8f, 0xff, 0xff, 0xff, 0x40, 0x50, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff,
+  0xff, 0x00, 0x80, 0x06, 0x64, 0x00, 0x03, 0xc1, 0x0f, 0x4d, 0x8f, 0xff,
+  0xff, 0xff, 0x00, 0x03, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x08,
+  0x86, 0x40, 0x0f, 0x4d, 0x8f, 0x0d, 0xc2, 0xff, 0xff, 0xff, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x55, 0xaa, 0x00,
+  0xc2, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x41, 0x0f, 0x4d, 0x8f, 0x09, 0xc2,
+  0xff, 0xcc, 0x99, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x55, 0x69, 0x55, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x99, 0xff,
+  0x99, 0xff, 0xff, 0x33, 0x99, 0x15, 0xaa, 0x30, 0xaa, 0xc1, 0xff, 0xcc,
+  0x99, 0xff, 0x99, 0xff, 0x0c, 0xef, 0xc2, 0xff, 0xff, 0xff, 0x0f, 0x4d,
+  0x8f, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x15, 0xb5, 0xb5, 0xb5, 0x41,
+  0x0f, 0x4d, 0x8f, 0x05, 0xc2, 0xff, 0x99, 0x00, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xa0, 0xab, 0xc2, 0xff, 0x00,
+  0x00, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x55,
+  0x55, 0xab, 0x02, 0xc2, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x99,
+  0xff, 0x99, 0x99, 0x99, 0x16, 0x3d, 0x7f, 0x7f, 0xc2, 0xff, 0x99, 0xff,
+  0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x10, 0x00, 0x80,
+  0xea, 0xc2, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99,
+  0x99, 0x99, 0x19, 0x17, 0x1f, 0x7f, 0x80, 0x01, 0x00, 0x06, 0xc0, 0x33,
+  0xff, 0x00, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x33,
+  0xff, 0x00, 0x33, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x99, 0xff, 0x00, 0x99, 0xff, 0x33, 0xff, 0x00, 0x33, 0xff, 0x00, 0x00,
+  0x99, 0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0xc2,
+  0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x33, 0xff, 0x00, 0x00, 0x99, 0xff,
+  0x05, 0x00, 0xa9, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff,
+  0xcc, 0x99, 0xff, 0x99, 0xff, 0x00, 0xc2, 0xff, 0x99, 0xff, 0xff, 0x33,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x42, 0x83,
+  0x01, 0x00, 0x06, 0x80, 0xf9, 0xff, 0xc0, 0x00, 0x99, 0xff, 0x00, 0x99,
+  0xff, 0x00, 0x99, 0xff, 0x00, 0x99, 0xff, 0x66, 0x33, 0xff, 0x66, 0x33,
+  0xff, 0x66, 0x33, 0xff, 0x66, 0x33, 0xff, 0x66, 0x33, 0xff, 0x66, 0x33,
+  0xff, 0x66, 0x33, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x0f, 0x4d,
+  0x8f, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xc2, 0x00, 0x99, 0xff, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x99, 0x99, 0x99, 0x99, 0x1a, 0x5a, 0x56, 0xf5,
+  0x00, 0x83, 0x01, 0x00, 0xc2, 0xff, 0x99, 0x99, 0x00, 0x00, 0x00, 0x0f,
+  0x4d, 0x8f, 0x99, 0x99, 0x99, 0x06, 0xda, 0x6a, 0xaa, 0x04, 0x41, 0x0f,
+  0x4d, 0x8f, 0x00, 0x82, 0x02, 0x00, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff,
+  0xff, 0x00, 0x04, 0x82, 0x02, 0x00, 0x05, 0x41, 0x0f, 0x4d, 0x8f, 0x02,
+  0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x10, 0x20, 0xc1, 0x0f, 0x4d,
+  0x8f, 0xff, 0xff, 0xff, 0x10, 0x00, 0x80, 0xff, 0xfe, 0x40, 0x0f, 0x4d,
+  0x8f, 0x06, 0x64, 0x00, 0x02, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff,
+  0x00, 0x06, 0xc1, 0xff, 0xff, 0xff, 0x0f, 0x4d, 0x8f, 0x77, 0xf4, 0x40,
+  0x0f, 0x4d, 0x8f, 0x0a, 0xc1, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00,
+  0x40, 0x01, 0xc2, 0x0f, 0x4d, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x02, 0x80, 0xff, 0x00, 0x81, 0x04,
+  0x00, 0x80, 0xf8, 0x00, 0x0b, 0xc2, 0xff, 0xcc, 0x99, 0xff, 0xff, 0xff,
+  0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x04, 0x2a, 0x9a, 0xba, 0xc2, 0xff,
+  0xcc, 0x99, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0x04,
+  0xaa, 0xad, 0xaa, 0xc0, 0xff, 0xcc, 0x99, 0xff, 0xcc, 0x99, 0xff, 0xcc,
+  0x99, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x99,
+  0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0xff, 0x33, 0x99, 0xff, 0x99,
+  0xff, 0xff, 0x99, 0xff, 0xff, 0x99, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x99, 0xff, 0xc2, 0xff, 0xcc, 0x99, 0xff, 0xff, 0xff, 0xff,
+  0x99, 0xff, 0x00, 0x00, 0x00, 0x10, 0x60, 0xa8, 0xaa, 0xc2, 0x00, 0x00,
+  0x00, 0x0f, 0x4d, 0x8f, 0xff, 0xcc, 0x99, 0x00, 0x00, 0x00, 0x15, 0x85,
+  0x85, 0x84, 0x80, 0x00, 0x01, 0x07, 0xc0, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x99, 0x00, 0xff, 0x99,
+  0x00, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x99, 0x00, 0xff, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xc1, 0xff, 0x99, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0x00, 0xc2, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x04, 0x40, 0x20, 0x00, 0xc1, 0x00,
+  0x00, 0x00, 0x99, 0x99, 0x99, 0x67, 0x77, 0xc2, 0xff, 0x99, 0xff, 0xff,
+  0x33, 0x99, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x10, 0x80, 0xea, 0xff,
+  0x81, 0x00, 0x01, 0x05, 0xc2, 0x33, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+  0x99, 0xff, 0x00, 0x00, 0x00, 0x04, 0x11, 0xa6, 0xaa, 0xc2, 0x33, 0xff,
+  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x06, 0x00,
+  0xf0, 0xff, 0xc2, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x33, 0xff, 0x00,
+  0x00, 0x99, 0xff, 0x05, 0x40, 0xa9, 0xff, 0x01, 0xc2, 0xff, 0x99, 0xff,
+  0x00, 0x00, 0x00, 0xff, 0x33, 0x99, 0x00, 0x00, 0x00, 0x01, 0x09, 0x01,
+  0x81, 0x83, 0x00, 0x01, 0x08, 0xc2, 0x00, 0x99, 0xff, 0x00, 0x00, 0x00,
+  0xff, 0xcc, 0x99, 0x99, 0x99, 0x99, 0x1a, 0x5a, 0xd6, 0xf5, 0x00, 0x80,
+  0xff, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0xff, 0x99, 0xff,
+  0xff, 0xcc, 0x99, 0x15, 0x85, 0xf0, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x99,
+  0x99, 0x99, 0x0f, 0x00, 0x81, 0x00, 0x01, 0x08, 0xc2, 0x99, 0x99, 0x99,
+  0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x00, 0x00, 0x00, 0x19, 0x69, 0xaa,
+  0xaa, 0x80, 0xfb, 0x00, 0x40, 0x0f, 0x4d, 0x8f, 0xc2, 0x0f, 0x4d, 0x8f,
+  0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x1a, 0x15, 0x00,
+  0x00, 0xc2, 0x00, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x99, 0x99, 0x99, 0x00,
+  0x00, 0x00, 0x12, 0x54, 0x55, 0x55, 0x0b, 0x42, 0x0f, 0x4d, 0x8f, 0x07
+};
+const unsigned nyan_bv_len=sizeof(nyan_bv);
@@ -0,0 +1,326 @@
+//Auto-generated
+const unsigned char nyan_gif[]={
+  0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x40, 0x00, 0x20, 0x00, 0xe3, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x0f, 0x4d, 0x8f, 0x66, 0x33,
+  0xff, 0xff, 0x33, 0x99, 0x00, 0x99, 0xff, 0x99, 0x99, 0x99, 0xff, 0x99,
+  0x00, 0xff, 0x99, 0x99, 0xff, 0x99, 0xff, 0x33, 0xff, 0x00, 0xff, 0xcc,
+  0x99, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0x0b, 0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45,
+  0x32, 0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xfe, 0x11, 0x43,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x47, 0x49, 0x4d, 0x50, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x0a, 0x00, 0xff,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x04,
+  0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb, 0xff, 0x60,
+  0x28, 0x5a, 0xcd, 0x68, 0x9e, 0x53, 0x89, 0xae, 0x6c, 0xeb, 0xa6, 0x65,
+  0xac, 0xbe, 0x02, 0x60, 0xdf, 0x78, 0x6e, 0xd3, 0x22, 0xb0, 0xfc, 0xc0,
+  0xa0, 0xf0, 0x07, 0xe0, 0xcc, 0x68, 0xbe, 0x5f, 0x62, 0xc9, 0x6c, 0x32,
+  0x81, 0x45, 0x8d, 0xea, 0x18, 0x0a, 0x58, 0xaf, 0x81, 0xa4, 0x33, 0x41,
+  0x58, 0x76, 0x9b, 0x44, 0x0f, 0x35, 0x83, 0x2d, 0x97, 0x7d, 0xde, 0xad,
+  0x3a, 0xb1, 0x88, 0xb2, 0xcc, 0xd8, 0x83, 0x7c, 0x7e, 0x40, 0xaf, 0x13,
+  0xb6, 0x34, 0xbb, 0xb8, 0xbb, 0x34, 0x62, 0x02, 0x7f, 0x18, 0x57, 0x74,
+  0x85, 0x85, 0x68, 0x0d, 0x6a, 0x00, 0x06, 0x06, 0x00, 0x60, 0x36, 0x8c,
+  0x6e, 0x23, 0x86, 0x74, 0x0c, 0x38, 0x0c, 0x96, 0x89, 0x4b, 0x9a, 0x5f,
+  0x8b, 0x91, 0x4f, 0x9e, 0x8d, 0x52, 0x1b, 0x73, 0x98, 0xa6, 0xa6, 0x9e,
+  0x36, 0x96, 0x0b, 0x77, 0xa1, 0x8d, 0x37, 0x8c, 0x91, 0xa3, 0x1a, 0xa7,
+  0xb5, 0x0c, 0x0a, 0x90, 0xaf, 0x0d, 0xac, 0x5e, 0x9a, 0x4b, 0xae, 0xb1,
+  0xc1, 0xa2, 0x27, 0xa6, 0x0a, 0xc6, 0xc7, 0xc7, 0xb9, 0x36, 0xbc, 0x4e,
+  0x04, 0xa1, 0x0d, 0xc0, 0xd0, 0xb2, 0x26, 0xc8, 0xd5, 0x0a, 0x05, 0xd8,
+  0xca, 0x89, 0x5d, 0xbe, 0x78, 0xb1, 0xb9, 0xdf, 0xa9, 0x27, 0xc7, 0xd8,
+  0xe5, 0xe6, 0xe6, 0xcb, 0x09, 0xbe, 0x9d, 0x06, 0x08, 0x08, 0xc2, 0xc1,
+  0xee, 0x92, 0x21, 0xe7, 0xe7, 0x03, 0xf7, 0xf8, 0x03, 0x5a, 0x5f, 0x4c,
+  0x8b, 0xee, 0x8d, 0x91, 0x02, 0xca, 0x3b, 0x51, 0x2e, 0x9f, 0x41, 0x83,
+  0x49, 0x98, 0x35, 0x09, 0xa5, 0x43, 0xdc, 0x89, 0x83, 0xf9, 0x2c, 0xdc,
+  0x18, 0x12, 0x04, 0x98, 0xb0, 0x79, 0x22, 0xf0, 0x71, 0x60, 0xd8, 0xb0,
+  0x63, 0x0e, 0x1e, 0x22, 0x1a, 0x52, 0xf1, 0x99, 0x36, 0x41, 0x9c, 0x43,
+  0x90, 0x18, 0x70, 0x48, 0xb8, 0x71, 0x81, 0x65, 0x0d, 0x8c, 0x28, 0x63,
+  0xca, 0x9c, 0x49, 0xb3, 0xa6, 0xcd, 0x9b, 0x38, 0x73, 0xea, 0xdc, 0x09,
+  0x32, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00, 0x0f, 0x00, 0x2c,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x04, 0xfe, 0x50,
+  0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb, 0xff, 0x60, 0x28, 0x4e,
+  0xcd, 0x68, 0x9e, 0x42, 0x29, 0xa9, 0x68, 0xeb, 0xbe, 0x30, 0xbb, 0xc2,
+  0x17, 0x60, 0xdf, 0x78, 0x6e, 0xd3, 0x23, 0xb0, 0xfc, 0xc0, 0xa0, 0xf0,
+  0x07, 0xb8, 0xb0, 0x64, 0x3c, 0xdf, 0x2f, 0xc1, 0x6c, 0x3a, 0x9b, 0xc0,
+  0xa2, 0x71, 0xd6, 0x0a, 0x58, 0xaf, 0x01, 0xe5, 0x33, 0x41, 0x60, 0x76,
+  0x9d, 0xc4, 0xcc, 0xf1, 0x83, 0x2d, 0x97, 0x7d, 0xde, 0xad, 0x3a, 0xb1,
+  0x90, 0xba, 0xcc, 0xd8, 0x83, 0x7c, 0x7e, 0x40, 0xaf, 0x99, 0x36, 0x2e,
+  0xb3, 0x2d, 0xd9, 0x91, 0x2a, 0x48, 0x16, 0x57, 0x74, 0x84, 0x84, 0x76,
+  0x6b, 0x00, 0x06, 0x06, 0x00, 0x50, 0x45, 0x89, 0x8b, 0x27, 0x85, 0x74,
+  0x0c, 0x94, 0x95, 0x0c, 0x87, 0x4d, 0x5f, 0x09, 0x8f, 0x8b, 0x7b, 0x36,
+  0x8a, 0x90, 0x7f, 0x54, 0x1a, 0x73, 0x96, 0xa6, 0x36, 0x95, 0x98, 0x5b,
+  0x9c, 0x8b, 0x37, 0xa0, 0xa1, 0x14, 0x81, 0x18, 0xa6, 0xa6, 0x0a, 0x8f,
+  0x00, 0x0a, 0xb6, 0x0b, 0x99, 0xab, 0xaf, 0xbe, 0xa0, 0x6e, 0x22, 0x95,
+  0xb9, 0xc4, 0xc4, 0xb7, 0x37, 0xbb, 0x5b, 0x5d, 0x9c, 0x0d, 0xac, 0x06,
+  0xcd, 0x8a, 0xc1, 0x20, 0xc5, 0xd4, 0x0a, 0x05, 0x05, 0xac, 0x68, 0x9a,
+  0x4e, 0x9c, 0x9f, 0xaf, 0xde, 0xd2, 0x1f, 0xc4, 0xd7, 0xe4, 0xe5, 0xe4,
+  0x00, 0xcd, 0xc9, 0xbc, 0x78, 0x06, 0x08, 0x08, 0xbf, 0xa0, 0xee, 0xe1,
+  0x1e, 0xe6, 0xe6, 0x03, 0xf7, 0xf8, 0xe9, 0xbb, 0xdb, 0xec, 0xee, 0x8b,
+  0xd1, 0x00, 0xe5, 0x99, 0x20, 0x87, 0xaf, 0x60, 0xc1, 0x06, 0x0d, 0x06,
+  0x20, 0x5c, 0xa2, 0xa6, 0x9b, 0x8e, 0x68, 0x27, 0x0c, 0x1a, 0xb4, 0xd0,
+  0x4c, 0xc9, 0x90, 0x28, 0xf0, 0x80, 0xa1, 0xc0, 0xd7, 0xa1, 0x41, 0x34,
+  0x1d, 0x26, 0x20, 0x43, 0xf2, 0xd8, 0x70, 0x4b, 0x40, 0xc9, 0x0a, 0x25,
+  0x4f, 0x8e, 0xcc, 0x70, 0x63, 0x42, 0x4b, 0x0b, 0x2f, 0x5f, 0xae, 0x9c,
+  0x49, 0xb3, 0xa6, 0xcd, 0x9b, 0x38, 0x73, 0xea, 0xdc, 0xc9, 0xb3, 0xa7,
+  0x4f, 0x09, 0x11, 0x00, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00, 0x0f,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x04,
+  0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb, 0xff, 0x60,
+  0x28, 0x8e, 0x64, 0x69, 0x9e, 0x68, 0xaa, 0xae, 0x6c, 0xeb, 0x4a, 0x40,
+  0x2c, 0xcf, 0x74, 0xfc, 0x7e, 0xc0, 0xa2, 0xef, 0x7c, 0xaf, 0x03, 0xb7,
+  0x4a, 0x60, 0x48, 0x0c, 0xe4, 0x74, 0x89, 0xa4, 0x72, 0xa9, 0xdc, 0x01,
+  0x59, 0xc5, 0x68, 0xf4, 0xc8, 0x4c, 0x10, 0x92, 0xd7, 0xe5, 0x4f, 0x25,
+  0x2d, 0x1e, 0xbe, 0xe0, 0x43, 0x0e, 0x5b, 0x2d, 0x27, 0x16, 0x4f, 0x14,
+  0x31, 0xcc, 0x66, 0x8f, 0xcd, 0xc9, 0x98, 0x35, 0x89, 0x86, 0xa5, 0x47,
+  0xed, 0x30, 0x63, 0xcf, 0x67, 0xbc, 0xcd, 0x00, 0x06, 0x06, 0x00, 0x4d,
+  0x40, 0x81, 0x83, 0x25, 0x60, 0x7d, 0x8b, 0x8b, 0x7f, 0x4a, 0x59, 0x09,
+  0x87, 0x83, 0x74, 0x31, 0x82, 0x88, 0x24, 0x8c, 0x7d, 0x0a, 0x9b, 0x9c,
+  0x0a, 0x8e, 0x55, 0x92, 0x83, 0x32, 0x96, 0x97, 0x23, 0x7c, 0x9d, 0xa8,
+  0xa8, 0x7f, 0x90, 0x4a, 0xa1, 0xa4, 0xa4, 0x77, 0x21, 0xa9, 0x9d, 0x05,
+  0xb5, 0x0d, 0x00, 0xb8, 0x63, 0xac, 0x73, 0x92, 0xb7, 0xaf, 0xbe, 0xa5,
+  0xb2, 0x9b, 0xb5, 0xc4, 0xc4, 0xb8, 0x0d, 0x96, 0x9f, 0x4b, 0x92, 0xb8,
+  0xaf, 0xcd, 0xc1, 0x20, 0xc5, 0xd2, 0x05, 0x03, 0xcc, 0xb8, 0x0b, 0x4c,
+  0x90, 0x81, 0x08, 0x08, 0xaf, 0xa4, 0xdc, 0xb1, 0x1f, 0xc4, 0x03, 0xe4,
+  0xe5, 0x03, 0x0d, 0xb7, 0xe9, 0xb7, 0x48, 0xbb, 0x91, 0x06, 0xdc, 0x83,
+  0x82, 0x87, 0xdb, 0x08, 0xe1, 0x1e, 0xe6, 0xf8, 0x03, 0x17, 0x47, 0xd8,
+  0x65, 0xd6, 0xb9, 0xcf, 0xec, 0xdd, 0x23, 0xa7, 0xa1, 0xc1, 0x84, 0x6b,
+  0x3e, 0x78, 0xb8, 0x72, 0x16, 0x44, 0x82, 0x41, 0x18, 0xa2, 0x00, 0x4a,
+  0x9c, 0x28, 0xb1, 0xa1, 0x85, 0x79, 0x02, 0x30, 0x56, 0xc0, 0xa8, 0xd1,
+  0xe2, 0x41, 0x5c, 0x19, 0x1f, 0xed, 0xe5, 0xb2, 0x23, 0xd0, 0xa3, 0xc9,
+  0x93, 0x28, 0x53, 0xaa, 0xc4, 0xf0, 0x70, 0xa5, 0x08, 0x83, 0x2d, 0x5d,
+  0x82, 0x88, 0xb9, 0x22, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00,
+  0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00,
+  0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb, 0xff,
+  0x60, 0x28, 0x8e, 0x64, 0x69, 0x9e, 0x68, 0xaa, 0xae, 0x6c, 0xeb, 0x4a,
+  0x40, 0x2c, 0xcf, 0x74, 0xfc, 0x7e, 0xc0, 0xa2, 0xef, 0x7c, 0xaf, 0x03,
+  0xb7, 0x4a, 0x60, 0x48, 0x0c, 0xe4, 0x74, 0x89, 0xa4, 0x72, 0xa9, 0xdc,
+  0x01, 0x59, 0xc5, 0x68, 0xf4, 0xc8, 0x4c, 0x10, 0x92, 0xd7, 0xe5, 0x4f,
+  0x25, 0x2d, 0x1e, 0xbe, 0xe0, 0x43, 0x0e, 0x5b, 0x2d, 0x27, 0x16, 0x4f,
+  0x14, 0x31, 0xcc, 0x66, 0x8f, 0xcd, 0xc9, 0x98, 0x35, 0x89, 0x86, 0xa5,
+  0x47, 0xed, 0x30, 0x63, 0xcf, 0x67, 0xbc, 0xcd, 0x00, 0x06, 0x06, 0x00,
+  0x4d, 0x40, 0x81, 0x83, 0x25, 0x60, 0x7d, 0x8b, 0x8b, 0x7f, 0x4a, 0x59,
+  0x09, 0x87, 0x83, 0x74, 0x31, 0x82, 0x88, 0x24, 0x8c, 0x7d, 0x0a, 0x9b,
+  0x9c, 0x0a, 0x8e, 0x55, 0x92, 0x83, 0x32, 0x96, 0x97, 0x23, 0x7c, 0x9d,
+  0xa8, 0xa8, 0x7f, 0x90, 0x4a, 0xa1, 0xa4, 0xa4, 0x77, 0x21, 0xa9, 0x9c,
+  0x0d, 0x05, 0xb6, 0x00, 0x87, 0x63, 0xac, 0x73, 0x92, 0x0d, 0xae, 0xbe,
+  0x82, 0xb1, 0x1f, 0x9c, 0xb6, 0xb6, 0xb5, 0xc6, 0xa1, 0x9f, 0x4b, 0x92,
+  0xb8, 0xaf, 0xcd, 0xa5, 0x21, 0xc5, 0xd2, 0xc5, 0x03, 0xb9, 0xb8, 0x9f,
+  0x90, 0x81, 0x08, 0x08, 0xaf, 0xa4, 0xdb, 0xc2, 0x1e, 0xd4, 0x03, 0x03,
+  0x0d, 0xe3, 0xe3, 0x00, 0x0d, 0x83, 0xe7, 0x48, 0xbb, 0x91, 0x06, 0xdb,
+  0x83, 0xc1, 0xf2, 0xdf, 0x24, 0xe6, 0xf6, 0xe6, 0x76, 0x13, 0x47, 0x0b,
+  0x80, 0x96, 0xd7, 0xff, 0xc1, 0x36, 0x34, 0xc8, 0x80, 0x6f, 0xc2, 0x40,
+  0x09, 0x07, 0xf5, 0xed, 0xf3, 0xf1, 0xa3, 0x1b, 0x2c, 0x0e, 0x09, 0x3f,
+  0x44, 0x84, 0x11, 0xec, 0x9f, 0xc5, 0x8b, 0x18, 0x35, 0x34, 0x18, 0xb8,
+  0xf1, 0x44, 0x2e, 0x01, 0x24, 0x1f, 0x2b, 0x7c, 0x0c, 0x09, 0x31, 0xc5,
+  0x35, 0x85, 0xe0, 0x4e, 0x82, 0xc4, 0xe5, 0x61, 0x62, 0x90, 0x97, 0x30,
+  0x63, 0x9e, 0x70, 0x29, 0x93, 0x04, 0xcd, 0x9a, 0x12, 0x3b, 0x76, 0xc4,
+  0x59, 0xe2, 0xa6, 0x8a, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00,
+  0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00,
+  0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb, 0xff,
+  0x60, 0x28, 0x8e, 0x64, 0x69, 0x7e, 0xcd, 0xa9, 0xae, 0x6c, 0xeb, 0xbe,
+  0x20, 0x20, 0xcf, 0x74, 0x2d, 0xc3, 0xf1, 0xa2, 0xef, 0x7c, 0xaf, 0x03,
+  0x38, 0x4b, 0x60, 0x48, 0x0c, 0x00, 0x76, 0x89, 0xa4, 0x72, 0xa9, 0xdc,
+  0x01, 0x5d, 0xc5, 0x68, 0xf4, 0xb8, 0x60, 0x26, 0x08, 0x49, 0xec, 0xf2,
+  0xc7, 0x92, 0x16, 0x0f, 0xe0, 0xf0, 0xe1, 0x98, 0xb5, 0x9a, 0x13, 0x8b,
+  0xa7, 0x8a, 0x28, 0x6e, 0xb7, 0xc9, 0xe7, 0x84, 0xac, 0x8c, 0x06, 0xde,
+  0x4c, 0x6e, 0x31, 0x63, 0xcf, 0x67, 0xc0, 0xcd, 0x00, 0x06, 0x06, 0x00,
+  0x5b, 0x32, 0x82, 0x6a, 0x23, 0x61, 0x7d, 0x8b, 0x8b, 0x7f, 0x4a, 0x5a,
+  0x81, 0x82, 0x0d, 0x4d, 0x91, 0x83, 0x26, 0x8c, 0x7d, 0x0a, 0x34, 0x0a,
+  0x9a, 0x55, 0x67, 0x95, 0x83, 0x33, 0x82, 0x87, 0x97, 0x7b, 0x9c, 0xa7,
+  0x9c, 0x95, 0x34, 0x9e, 0x57, 0x4c, 0xa0, 0xa3, 0xb0, 0x96, 0x25, 0xa8,
+  0xb4, 0x9a, 0xaf, 0x64, 0x5a, 0x8f, 0x95, 0x0d, 0xaf, 0xbc, 0xa4, 0x24,
+  0xa7, 0x05, 0xc2, 0xc3, 0xc4, 0xc2, 0x33, 0xac, 0xae, 0xa3, 0x86, 0xb0,
+  0xcb, 0x88, 0x21, 0xc5, 0xc5, 0x03, 0xd2, 0xd3, 0x03, 0x8e, 0xad, 0x72,
+  0x06, 0x08, 0x08, 0xb1, 0xb0, 0xda, 0xce, 0x20, 0xc3, 0xd4, 0xe2, 0xe2,
+  0x54, 0xd7, 0x4a, 0x81, 0xda, 0x83, 0x87, 0xeb, 0xde, 0x17, 0x29, 0x1c,
+  0xe3, 0xd4, 0x16, 0x32, 0x48, 0x56, 0xaa, 0x36, 0xbf, 0x16, 0xef, 0x1b,
+  0xd3, 0x1c, 0xab, 0x3e, 0x4e, 0xb8, 0x31, 0x0b, 0x52, 0xe1, 0x9e, 0x8d,
+  0x83, 0x07, 0xdd, 0xa5, 0x58, 0xb8, 0xaf, 0x44, 0x24, 0x3b, 0xf9, 0x26,
+  0x3c, 0x14, 0x30, 0x91, 0xe0, 0xbc, 0x3b, 0xbc, 0xee, 0x14, 0xbc, 0x33,
+  0x83, 0x43, 0x43, 0x8b, 0x19, 0x2b, 0x3e, 0x86, 0x9c, 0xb0, 0x4f, 0x24,
+  0x48, 0x13, 0x26, 0x4f, 0x7a, 0x48, 0xa9, 0xb2, 0x44, 0x83, 0x85, 0x02,
+  0x5e, 0xb6, 0x9c, 0x69, 0x22, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a,
+  0x00, 0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00,
+  0x00, 0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb,
+  0xff, 0x60, 0x28, 0x8e, 0x5a, 0x43, 0x9e, 0xa7, 0x69, 0xa2, 0x2c, 0xb8,
+  0xb6, 0x70, 0x2c, 0xcf, 0x16, 0x60, 0xdf, 0x78, 0x6e, 0xd3, 0x21, 0xb0,
+  0xfc, 0xc0, 0xa0, 0xf0, 0x07, 0xe0, 0x5d, 0x02, 0xc8, 0x64, 0xc0, 0xf7,
+  0x4b, 0x38, 0x9f, 0xd0, 0x27, 0xb0, 0x38, 0x53, 0x5a, 0xad, 0xcc, 0x68,
+  0x82, 0xe0, 0xe4, 0x42, 0x89, 0xb1, 0xab, 0xf2, 0x40, 0x2e, 0x1f, 0x7c,
+  0x5d, 0x6d, 0xc2, 0x16, 0x5d, 0x14, 0x77, 0xa8, 0xa4, 0x79, 0x3e, 0x47,
+  0xab, 0xd7, 0x06, 0x03, 0x60, 0xeb, 0x74, 0x03, 0xf2, 0x54, 0x24, 0x74,
+  0x66, 0x0c, 0x85, 0x86, 0x0c, 0x76, 0x6a, 0x0d, 0x79, 0x7a, 0x52, 0x7f,
+  0x80, 0x28, 0x65, 0x87, 0x93, 0x36, 0x86, 0x89, 0x4f, 0x5c, 0x0d, 0x00,
+  0x8b, 0x80, 0x37, 0x8c, 0x7a, 0x28, 0x93, 0x93, 0x0a, 0x8f, 0x00, 0x0a,
+  0xa4, 0x0b, 0x77, 0x09, 0x9c, 0x9f, 0xad, 0xa0, 0x27, 0x86, 0xa7, 0xb2,
+  0xb2, 0xa5, 0x37, 0xa9, 0x69, 0x4f, 0x8f, 0x06, 0x9a, 0xad, 0xbc, 0xaf,
+  0x23, 0xb3, 0xc1, 0x0a, 0x05, 0x05, 0xba, 0x7a, 0xa9, 0x5e, 0x98, 0xba,
+  0x36, 0xad, 0xcc, 0xbf, 0x22, 0xb2, 0xc4, 0xd2, 0xd3, 0xd2, 0xb6, 0x77,
+  0x7f, 0x08, 0x08, 0xae, 0x8c, 0xd9, 0x81, 0x22, 0xd4, 0xd4, 0x03, 0xe2,
+  0xe3, 0x03, 0x97, 0x7c, 0x78, 0xd9, 0x7a, 0x80, 0xeb, 0xdd, 0x27, 0xd2,
+  0xe4, 0xf0, 0xf0, 0x59, 0xc9, 0xb9, 0x8c, 0x3a, 0xa5, 0x15, 0x2f, 0x1d,
+  0xf1, 0xe4, 0x35, 0x4c, 0xb7, 0x5a, 0x8c, 0xb9, 0xf2, 0xf6, 0x42, 0x9f,
+  0x86, 0x71, 0x1c, 0xfe, 0xd8, 0x18, 0x22, 0xe4, 0xde, 0x0d, 0x23, 0x17,
+  0x96, 0x39, 0x9c, 0xf8, 0x4c, 0x82, 0x41, 0x83, 0x28, 0xf0, 0xe1, 0xab,
+  0xa0, 0x11, 0x12, 0xc4, 0x88, 0x1d, 0x70, 0x1e, 0xfa, 0x0b, 0x24, 0x32,
+  0xdf, 0x04, 0x8c, 0x1f, 0x51, 0xa0, 0x84, 0x71, 0x31, 0xa5, 0x8c, 0x82,
+  0x2e, 0x63, 0xca, 0xf4, 0xd0, 0x72, 0xa6, 0xcd, 0x16, 0x11, 0x00, 0x00,
+  0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00, 0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab,
+  0xbd, 0x98, 0xb6, 0xcc, 0xbb, 0xff, 0xd8, 0x06, 0x7e, 0xe2, 0x68, 0x9e,
+  0x24, 0x4a, 0x6e, 0x6c, 0xa9, 0x0a, 0x4d, 0xfb, 0xce, 0xaf, 0x4b, 0x87,
+  0x77, 0x65, 0x63, 0x40, 0xef, 0xff, 0xc0, 0x9e, 0x26, 0x77, 0x02, 0x2c,
+  0x8e, 0xc8, 0xa4, 0xf2, 0x08, 0x20, 0xaa, 0x8c, 0xc7, 0x84, 0x74, 0x4a,
+  0x9d, 0x22, 0x9b, 0xc4, 0x80, 0x16, 0x04, 0xad, 0x26, 0x08, 0x52, 0x30,
+  0x95, 0xe9, 0xd4, 0x9a, 0xcf, 0x81, 0x8b, 0x31, 0xec, 0x6d, 0x27, 0x16,
+  0xd8, 0xdc, 0x61, 0x8e, 0xae, 0x9b, 0xd7, 0xee, 0x44, 0x8f, 0xfd, 0x6e,
+  0x0a, 0x69, 0x73, 0x81, 0x82, 0x07, 0x76, 0x78, 0x52, 0x0d, 0x09, 0x88,
+  0x7a, 0x06, 0x06, 0x00, 0x63, 0x3d, 0x8c, 0x71, 0x2a, 0x0c, 0x94, 0x83,
+  0x81, 0x3f, 0x73, 0x78, 0x8a, 0x89, 0x52, 0x00, 0x8c, 0x8d, 0x56, 0x9e,
+  0x91, 0x34, 0x94, 0xa5, 0xa6, 0x0c, 0x07, 0xa2, 0x3d, 0xa9, 0x0b, 0x54,
+  0x31, 0x89, 0x0d, 0xa2, 0x91, 0x3e, 0x9f, 0x8d, 0x34, 0x0a, 0xb8, 0xa7,
+  0xa5, 0x90, 0x8d, 0x3d, 0xad, 0x88, 0x62, 0xaf, 0xb2, 0xb5, 0xc4, 0x92,
+  0x28, 0xb8, 0xc8, 0xc9, 0x0a, 0x94, 0xbc, 0xbe, 0x5e, 0x0d, 0x04, 0xb2,
+  0xb1, 0xc4, 0xd3, 0xb6, 0x2f, 0x05, 0xd8, 0xca, 0xca, 0xcd, 0xad, 0x04,
+  0x9b, 0x88, 0xb2, 0xbc, 0x9f, 0xcd, 0x33, 0xd8, 0xe6, 0xe7, 0x05, 0xda,
+  0xce, 0x53, 0xd0, 0x9d, 0x06, 0x08, 0x08, 0xc4, 0xb5, 0xf0, 0xc6, 0x26,
+  0x03, 0xf7, 0xe8, 0xf9, 0xe6, 0x5d, 0x62, 0x53, 0x9e, 0xf0, 0x8d, 0x22,
+  0x09, 0xa4, 0x37, 0xe3, 0x9e, 0xc1, 0x83, 0x03, 0xf4, 0x41, 0x69, 0xe5,
+  0x25, 0x5c, 0x90, 0x51, 0x39, 0x10, 0x4a, 0xbc, 0xe7, 0x63, 0x49, 0x92,
+  0x61, 0xf2, 0xea, 0x39, 0x11, 0x80, 0xd0, 0x61, 0x90, 0x8f, 0x2a, 0x41,
+  0x36, 0x7a, 0x50, 0xe5, 0x07, 0xe2, 0x04, 0x55, 0x02, 0x50, 0x8a, 0xec,
+  0xf0, 0x43, 0x82, 0x0f, 0x35, 0x7f, 0xfe, 0xac, 0x9c, 0x49, 0x93, 0xc3,
+  0x8e, 0x9a, 0x39, 0x58, 0xe0, 0x5c, 0x79, 0x73, 0xa7, 0xcf, 0x9f, 0x40,
+  0x83, 0x0a, 0x3d, 0x11, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00,
+  0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00,
+  0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x58, 0xb4, 0xcc, 0xf1, 0xee,
+  0x20, 0xf5, 0x49, 0xe3, 0x18, 0x66, 0xe6, 0xa9, 0xae, 0x6c, 0x6b, 0x95,
+  0x5a, 0x95, 0xba, 0x5b, 0x63, 0xbb, 0x78, 0xae, 0xbf, 0xe2, 0x34, 0xd3,
+  0x2c, 0x80, 0x70, 0x48, 0x2c, 0x0a, 0x63, 0x3b, 0xdf, 0x0a, 0xb0, 0x68,
+  0x3a, 0x9f, 0xd0, 0x26, 0x20, 0x89, 0x63, 0x36, 0x13, 0xd8, 0xac, 0x36,
+  0xeb, 0x9c, 0x52, 0x03, 0xe0, 0x93, 0x75, 0x9b, 0x20, 0x60, 0xcd, 0x5a,
+  0x29, 0x55, 0x00, 0x6e, 0xbb, 0x03, 0x17, 0xe6, 0x99, 0x4c, 0x4f, 0x2c,
+  0xbc, 0xc9, 0x83, 0xfe, 0xcd, 0x6f, 0xcb, 0x13, 0x0d, 0x75, 0x42, 0x65,
+  0x58, 0x77, 0x12, 0x47, 0x39, 0x7a, 0x8a, 0x8b, 0x07, 0x7d, 0x7f, 0x81,
+  0x64, 0x00, 0x06, 0x06, 0x00, 0x5c, 0x53, 0x92, 0x94, 0x39, 0x0c, 0x9b,
+  0x8c, 0x9d, 0x8a, 0x7f, 0x5a, 0x68, 0x09, 0x98, 0x94, 0x85, 0x42, 0x93,
+  0x99, 0x38, 0x9b, 0xab, 0xac, 0x0c, 0x7a, 0x42, 0x9f, 0x36, 0x80, 0x80,
+  0x90, 0x58, 0xa4, 0x94, 0x00, 0xb9, 0xa8, 0xa9, 0x2e, 0x0a, 0xbe, 0xad,
+  0xab, 0x98, 0x00, 0x9b, 0xa0, 0xa2, 0x59, 0xb7, 0xbb, 0xbb, 0x78, 0x2d,
+  0xbe, 0xcd, 0xce, 0x0a, 0x0c, 0xc2, 0xb9, 0x8f, 0xa1, 0xa3, 0xa8, 0x0d,
+  0xc8, 0xd8, 0x93, 0xcb, 0x2b, 0x05, 0xde, 0xcf, 0xce, 0xb7, 0x72, 0x04,
+  0xb5, 0xc7, 0xa8, 0xba, 0xca, 0xc2, 0x38, 0xde, 0xec, 0xed, 0x05, 0xcf,
+  0xd3, 0x0b, 0x5b, 0xa2, 0x92, 0x08, 0x08, 0xc9, 0xbb, 0xf6, 0xdc, 0x2a,
+  0x03, 0xfd, 0xee, 0xff, 0xec, 0xc6, 0x18, 0xb3, 0x65, 0xc0, 0x1e, 0xa5,
+  0x6d, 0x08, 0xf5, 0xe1, 0xe8, 0xc7, 0xb0, 0xe1, 0x00, 0x80, 0x56, 0xe4,
+  0xd1, 0x21, 0x35, 0xad, 0xe2, 0xb6, 0x24, 0x0e, 0x33, 0x32, 0xcc, 0x15,
+  0x05, 0x0a, 0xb2, 0x64, 0x31, 0xfb, 0xd6, 0x64, 0x94, 0x56, 0xb1, 0xa4,
+  0xc9, 0x92, 0x6b, 0x42, 0xa8, 0x53, 0x57, 0x61, 0xe5, 0xc5, 0x94, 0x20,
+  0xa6, 0x4d, 0x90, 0x69, 0x81, 0x26, 0x4d, 0x98, 0x4a, 0x70, 0xea, 0xcc,
+  0xb9, 0x13, 0xe6, 0x8d, 0x1b, 0x3d, 0x7d, 0x06, 0xd5, 0xf9, 0x63, 0xa8,
+  0xd1, 0xa3, 0x48, 0x83, 0x46, 0x00, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a,
+  0x00, 0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00,
+  0x00, 0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb,
+  0xff, 0x58, 0x03, 0x8e, 0x64, 0x69, 0x9e, 0xa3, 0x88, 0xa2, 0xea, 0xea,
+  0x7a, 0x6d, 0x17, 0xbf, 0x74, 0x0d, 0xdc, 0x78, 0xae, 0xdf, 0x57, 0xe3,
+  0x0b, 0xa2, 0x5f, 0x6d, 0x02, 0x58, 0x18, 0x8f, 0xc8, 0xa4, 0x11, 0x50,
+  0x0b, 0x38, 0x3d, 0x45, 0x63, 0x62, 0x4a, 0xad, 0x52, 0x8f, 0xcc, 0x10,
+  0xc8, 0xc9, 0xed, 0x06, 0x2e, 0x51, 0x6b, 0x82, 0x30, 0x25, 0x57, 0x97,
+  0x99, 0xd9, 0xe6, 0xc0, 0xf6, 0xba, 0xb9, 0x80, 0x46, 0x59, 0x4c, 0x4f,
+  0x2c, 0xb2, 0x2e, 0xb6, 0x7e, 0x7f, 0x70, 0x37, 0x8a, 0x09, 0x72, 0x75,
+  0x37, 0x63, 0x53, 0x77, 0x12, 0x3c, 0x27, 0x0c, 0x8b, 0x7c, 0x8d, 0x7a,
+  0x80, 0x75, 0x09, 0x00, 0x06, 0x06, 0x00, 0x57, 0x4c, 0x93, 0x95, 0x8a,
+  0x8b, 0x9c, 0x9d, 0x7c, 0x0d, 0x07, 0x90, 0x82, 0x85, 0x53, 0x99, 0x95,
+  0x86, 0x37, 0x94, 0x9a, 0x26, 0x0a, 0xad, 0x9d, 0xaf, 0xaf, 0x90, 0x83,
+  0xaa, 0x95, 0x00, 0xb6, 0xb4, 0x78, 0x24, 0xad, 0xbb, 0xbc, 0x0a, 0xb0,
+  0x7f, 0x0b, 0x81, 0xa4, 0x55, 0xa6, 0xb4, 0xc6, 0xb9, 0x23, 0x05, 0xca,
+  0xbd, 0xbd, 0xb6, 0xce, 0x72, 0x66, 0x54, 0x64, 0xa6, 0x7f, 0xc6, 0xd5,
+  0xab, 0x24, 0xca, 0xda, 0xdb, 0x05, 0x0a, 0xb7, 0xaa, 0xb2, 0x62, 0xa6,
+  0xdf, 0xe0, 0x99, 0xc8, 0x1f, 0x03, 0xe9, 0xdc, 0xda, 0xe3, 0xb6, 0xc1,
+  0x55, 0xd1, 0x93, 0x08, 0x08, 0xc6, 0xb4, 0xf3, 0xe7, 0x1e, 0xe9, 0xfa,
+  0xfb, 0x03, 0xca, 0xce, 0x00, 0x05, 0xc2, 0x44, 0xa3, 0x22, 0x8f, 0x9e,
+  0x39, 0x4a, 0x05, 0xf1, 0x81, 0xe0, 0xc7, 0x50, 0x5f, 0x94, 0x77, 0xe2,
+  0xca, 0xfd, 0x33, 0x37, 0x64, 0x42, 0x43, 0x77, 0x4a, 0x90, 0x14, 0xab,
+  0xa7, 0xb0, 0x22, 0xa2, 0x5a, 0x2d, 0x13, 0x43, 0x8a, 0xb4, 0x55, 0x51,
+  0x0d, 0x05, 0x8a, 0x14, 0x2b, 0xa0, 0x44, 0x58, 0x52, 0x83, 0x33, 0x22,
+  0x24, 0x2d, 0xbc, 0x14, 0x30, 0xd3, 0xa3, 0x4d, 0x1a, 0x42, 0x82, 0x98,
+  0xbc, 0xc9, 0xb3, 0x27, 0x89, 0x9d, 0x3e, 0x4d, 0x00, 0x0d, 0x4a, 0xb4,
+  0xa8, 0x80, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00, 0x0f, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x04, 0xfe,
+  0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd, 0xbb, 0xff, 0xe0, 0xd7,
+  0x84, 0x64, 0x89, 0x8d, 0xa3, 0xa9, 0x9a, 0x69, 0xd8, 0xae, 0x70, 0xd7,
+  0xbe, 0x71, 0x6d, 0xaf, 0x40, 0xae, 0xef, 0x7c, 0x4e, 0xd1, 0xb4, 0xdb,
+  0x04, 0xb0, 0x28, 0x1a, 0x8f, 0xc5, 0xc6, 0x11, 0x70, 0x0b, 0x38, 0x3d,
+  0xc4, 0x62, 0x62, 0x4a, 0xad, 0x36, 0xa6, 0x46, 0xa6, 0x64, 0x46, 0x72,
+  0x7a, 0xbf, 0x81, 0x4b, 0xb4, 0x3a, 0x25, 0x4c, 0x1b, 0x57, 0x74, 0xa2,
+  0xa8, 0x9d, 0x04, 0x3d, 0x87, 0x38, 0x78, 0xee, 0x25, 0x96, 0xc9, 0xd6,
+  0xea, 0xa2, 0x0d, 0x8b, 0xfb, 0xff, 0x07, 0x74, 0x76, 0x78, 0x55, 0x00,
+  0x57, 0x66, 0x6b, 0x5a, 0x3e, 0x2a, 0x0c, 0x8d, 0x80, 0x8f, 0x7e, 0x83,
+  0x84, 0x09, 0x00, 0x06, 0x06, 0x00, 0x54, 0x7b, 0x02, 0x95, 0x97, 0x8c,
+  0x8d, 0x9f, 0xa0, 0x90, 0x92, 0x54, 0x88, 0x94, 0x96, 0x97, 0x58, 0x39,
+  0xa7, 0x7c, 0x21, 0x0a, 0xae, 0xa0, 0xb0, 0xb0, 0xa3, 0x78, 0x9c, 0x96,
+  0x3b, 0xa7, 0x9d, 0x26, 0xae, 0xbb, 0xbc, 0x0a, 0xb1, 0x0c, 0x92, 0xa5,
+  0x54, 0xb5, 0xb8, 0xc5, 0xac, 0x20, 0x05, 0xc9, 0xbd, 0xbd, 0xaa, 0x97,
+  0x0b, 0x09, 0xc2, 0xd0, 0xa6, 0x96, 0x0d, 0xc4, 0x06, 0xd5, 0xb6, 0x26,
+  0xc9, 0xdb, 0xdc, 0x05, 0xae, 0xc4, 0xb3, 0x85, 0xab, 0xd6, 0xcd, 0xc7,
+  0x1e, 0x03, 0xe8, 0xdd, 0xdb, 0x9c, 0x3b, 0xcf, 0x55, 0xa5, 0x95, 0x08,
+  0x08, 0xc5, 0xb8, 0xf2, 0xe6, 0x1d, 0xe8, 0xf9, 0xfa, 0x03, 0x05, 0xec,
+  0xc9, 0x63, 0xd1, 0x4c, 0xc9, 0xbb, 0x64, 0xab, 0xa0, 0x3d, 0x18, 0xfb,
+  0xf4, 0x01, 0x00, 0x90, 0x2f, 0x8a, 0x3b, 0x5a, 0xe3, 0x16, 0x4a, 0xcc,
+  0x26, 0x44, 0x42, 0xc2, 0x01, 0x0b, 0x91, 0x68, 0xb4, 0x66, 0xac, 0x62,
+  0x06, 0x76, 0x34, 0x12, 0x43, 0x8a, 0x1c, 0x19, 0x32, 0xc6, 0x1b, 0x0b,
+  0xec, 0x36, 0x51, 0xa4, 0x90, 0x32, 0x25, 0x0c, 0x2e, 0x1a, 0x24, 0x0e,
+  0x59, 0x28, 0x86, 0xe6, 0x26, 0x9b, 0x1e, 0x73, 0x7a, 0x3c, 0x29, 0x42,
+  0x67, 0x4e, 0x9e, 0x35, 0x60, 0xfa, 0xb4, 0x01, 0x94, 0x03, 0x1a, 0x14,
+  0x02, 0xd0, 0x0c, 0x5d, 0x6a, 0x23, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05,
+  0x0a, 0x00, 0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20,
+  0x00, 0x00, 0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0xbd, 0x38, 0xeb, 0xcd,
+  0x6d, 0xeb, 0x60, 0x28, 0x56, 0xdf, 0x68, 0x9e, 0xde, 0xd7, 0x94, 0x68,
+  0x6b, 0xb2, 0x6e, 0x1c, 0xc2, 0x72, 0x6d, 0xdf, 0x28, 0xa0, 0xef, 0x7b,
+  0xc3, 0xef, 0x38, 0x13, 0x60, 0x41, 0x2c, 0x16, 0x1b, 0xc6, 0xe3, 0x2d,
+  0xc0, 0x04, 0x0d, 0x89, 0x89, 0xa8, 0x74, 0x2a, 0x2d, 0x02, 0x6c, 0xcc,
+  0xac, 0x36, 0x70, 0x79, 0x52, 0x57, 0x89, 0x06, 0x01, 0x1c, 0x25, 0x5e,
+  0x6b, 0x87, 0xf4, 0x76, 0x9d, 0x1d, 0x46, 0x09, 0xd4, 0x78, 0xf5, 0x2c,
+  0x4b, 0xdb, 0xef, 0x07, 0xb6, 0x5b, 0x1e, 0xd6, 0xbd, 0xcb, 0x57, 0x3a,
+  0x31, 0x0c, 0x84, 0x78, 0x86, 0x76, 0x7b, 0x72, 0x0d, 0x06, 0x06, 0x00,
+  0x53, 0x0b, 0x3a, 0x8c, 0x74, 0x27, 0x84, 0x95, 0x96, 0x0c, 0x87, 0x89,
+  0x52, 0x70, 0x09, 0x00, 0x8c, 0x8d, 0x73, 0x9f, 0x93, 0x26, 0x0a, 0xa5,
+  0x97, 0x95, 0x3c, 0x84, 0x9a, 0x54, 0x9e, 0xa2, 0x3b, 0x9f, 0x8d, 0x2e,
+  0xa5, 0xb3, 0xb4, 0x0a, 0xad, 0x8d, 0x3b, 0x0b, 0x9b, 0xac, 0xb0, 0xbd,
+  0xa2, 0x2e, 0x05, 0xc1, 0xb5, 0xa5, 0x3e, 0xbd, 0x6e, 0x9c, 0x9b, 0xb7,
+  0xc5, 0xb0, 0xcb, 0xa3, 0x22, 0xc1, 0xd0, 0xd1, 0x05, 0xb5, 0xb9, 0x7c,
+  0xb7, 0x91, 0xb0, 0xd8, 0xce, 0x21, 0x03, 0xdd, 0xd2, 0xdf, 0xd0, 0xab,
+  0x9c, 0x9e, 0x08, 0x08, 0xbe, 0x9f, 0xe5, 0xdb, 0x20, 0xdd, 0xec, 0xed,
+  0x03, 0xe0, 0x5e, 0xc8, 0x51, 0xe4, 0xe6, 0xad, 0xf6, 0x06, 0xe9, 0x32,
+  0xee, 0xfb, 0xdd, 0x3a, 0x45, 0x72, 0xd7, 0x7e, 0xd8, 0x0b, 0x32, 0xc1,
+  0x1d, 0x8f, 0x24, 0x49, 0x6e, 0x9d, 0x53, 0x17, 0x24, 0xa0, 0xc0, 0x87,
+  0x0f, 0x09, 0x62, 0x18, 0x38, 0xb0, 0x02, 0x45, 0x49, 0x12, 0x33, 0x00,
+  0x91, 0xb0, 0xd1, 0xa2, 0x20, 0x01, 0x16, 0x1d, 0x33, 0x8a, 0x1c, 0xd9,
+  0x81, 0x06, 0xc9, 0x16, 0x2c, 0x4c, 0x9e, 0x5c, 0xc9, 0x92, 0x84, 0xcb,
+  0x96, 0x30, 0x4f, 0x44, 0x00, 0x00, 0x21, 0xf9, 0x04, 0x01, 0x0a, 0x00,
+  0x0f, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00,
+  0x04, 0xfe, 0x50, 0xc8, 0x49, 0xab, 0x68, 0x36, 0xeb, 0xcd, 0xbb, 0xc7,
+  0x5e, 0x28, 0x8e, 0x64, 0x69, 0x9a, 0x0d, 0xa6, 0x82, 0x67, 0xeb, 0xbe,
+  0x70, 0xc9, 0xc6, 0xf4, 0x6c, 0xd9, 0x74, 0xce, 0x01, 0x3c, 0xdf, 0xf4,
+  0xc0, 0x1f, 0x4f, 0x77, 0x02, 0x2c, 0x8e, 0x8d, 0xe3, 0x22, 0xa9, 0x4c,
+  0x32, 0x01, 0xba, 0x80, 0x54, 0x64, 0x3c, 0x26, 0xae, 0xd8, 0x6c, 0xa2,
+  0x91, 0x50, 0x42, 0x69, 0xd2, 0xb0, 0x38, 0x90, 0xa9, 0x6e, 0xb3, 0x04,
+  0x2e, 0x41, 0x7b, 0xfc, 0xc6, 0x0e, 0xf0, 0xb1, 0x3c, 0x6c, 0xbc, 0xae,
+  0xb5, 0x09, 0x1e, 0x1b, 0x3a, 0x7c, 0xc1, 0xff, 0x80, 0x07, 0x73, 0x75,
+  0x57, 0x5c, 0x85, 0x79, 0x06, 0x06, 0x00, 0x09, 0x77, 0x0b, 0x00, 0x00,
+  0x89, 0x6e, 0x27, 0x0c, 0x94, 0x81, 0x96, 0x7f, 0x84, 0x58, 0x86, 0x88,
+  0x91, 0x58, 0x8e, 0x89, 0x8a, 0x2f, 0x94, 0xa3, 0xa4, 0x0c, 0x70, 0x8f,
+  0x98, 0x0b, 0x78, 0x77, 0x90, 0xa0, 0x8f, 0x8f, 0xa0, 0xa1, 0x2e, 0x0a,
+  0xb4, 0xa5, 0xa3, 0xad, 0x00, 0x94, 0x99, 0x78, 0xad, 0xb1, 0xbe, 0xb2,
+  0x2d, 0xb4, 0xc2, 0x0a, 0x0d, 0xc2, 0x0c, 0xb8, 0xaf, 0xaa, 0x76, 0x59,
+  0xbd, 0x3f, 0xbe, 0xce, 0xc0, 0x26, 0x05, 0xd3, 0xb4, 0xc5, 0xc5, 0xc2,
+  0xbd, 0x8a, 0xaa, 0x77, 0x58, 0x04, 0xbd, 0xb0, 0xb1, 0xe0, 0x92, 0x25,
+  0xd3, 0xe5, 0x05, 0x0d, 0xe5, 0xc3, 0x0a, 0xc9, 0x78, 0x57, 0x90, 0x08,
+  0x08, 0xbf, 0xa0, 0xf0, 0xe3, 0x24, 0x03, 0xf7, 0xe6, 0xf9, 0xf9, 0xbb,
+  0x8c, 0xee, 0x06, 0xf0, 0x8a, 0x22, 0x09, 0xa4, 0xe7, 0xe2, 0x9e, 0xc1,
+  0x83, 0x03, 0xf4, 0x15, 0x30, 0xc3, 0x0d, 0xcb, 0xb7, 0x57, 0xaf, 0x22,
+  0xd1, 0x40, 0x48, 0xf1, 0xde, 0x23, 0x25, 0xed, 0x38, 0xc9, 0x8b, 0x46,
+  0x44, 0x00, 0x42, 0x48, 0x30, 0x17, 0x95, 0x88, 0xf4, 0x02, 0xb1, 0x64,
+  0xc7, 0x0d, 0x0f, 0x4b, 0xaa, 0x2c, 0xc9, 0xf1, 0x64, 0x05, 0x5c, 0x02,
+  0x60, 0xbe, 0x94, 0x28, 0xd3, 0x65, 0x99, 0x47, 0x12, 0x5e, 0xdd, 0x74,
+  0xa3, 0xd3, 0xa6, 0xcf, 0x9f, 0x40, 0x83, 0x0a, 0x1d, 0x4a, 0xb4, 0xa8,
+  0xd1, 0xa3, 0x12, 0x22, 0x00, 0x00, 0x3b
+};
+const unsigned nyan_gif_len=sizeof(nyan_gif);
@@ -0,0 +1,1002 @@
+//Auto-generated
+const unsigned char lenna_qoi[]={
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20,
+  0x03, 0x00, 0xfe, 0xaa, 0x42, 0x4e, 0x61, 0x74, 0xfe, 0xc9, 0x57, 0x54,
+  0xfe, 0xe9, 0x89, 0x6a, 0xfe, 0xed, 0x97, 0x75, 0x9b, 0xdc, 0xfe, 0xd2,
+  0x62, 0x59, 0xfe, 0x95, 0x2e, 0x46, 0xfe, 0xa6, 0x3d, 0x4c, 0xa5, 0xd5,
+  0x9f, 0x96, 0x66, 0xa5, 0x75, 0x98, 0x9f, 0xfe, 0xfa, 0xbe, 0x89, 0xfe,
+  0xe0, 0x7a, 0x66, 0xfe, 0xd0, 0x5e, 0x58, 0xfe, 0xb5, 0x44, 0x50, 0xaa,
+  0x46, 0xa1, 0x7a, 0xfe, 0xd2, 0x6e, 0x6f, 0xa5, 0x27, 0x92, 0x9d, 0xfe,
+  0xd6, 0x7c, 0x78, 0x9d, 0x7d, 0xa2, 0x58, 0xfe, 0xd5, 0x89, 0x85, 0xaa,
+  0x47, 0xa3, 0x55, 0x54, 0xa4, 0x58, 0x9c, 0x99, 0x9d, 0xa7, 0xfe, 0xd7,
+  0x9c, 0x94, 0xa8, 0x29, 0xa6, 0x17, 0x9c, 0xb8, 0xa0, 0x8d, 0xfe, 0xd3,
+  0x98, 0x94, 0xfe, 0xd0, 0x9f, 0x99, 0xfe, 0xd9, 0xaf, 0x9e, 0xa6, 0x5b,
+  0xad, 0x28, 0x9c, 0x97, 0x9f, 0x7c, 0xa3, 0x68, 0xa3, 0x88, 0x9c, 0xc5,
+  0xfe, 0xd3, 0x92, 0x8a, 0xfe, 0xda, 0xa7, 0x9c, 0xfe, 0xb7, 0x8b, 0x8a,
+  0xfe, 0x56, 0x14, 0x3f, 0xa5, 0xd4, 0x9c, 0x98, 0xa6, 0x8e, 0xfe, 0xb2,
+  0x60, 0x72, 0xfe, 0xd0, 0x7a, 0x7d, 0xfe, 0xd5, 0x8c, 0x81, 0x9f, 0xb9,
+  0x4a, 0x9f, 0x76, 0x65, 0x74, 0xfe, 0xa9, 0x40, 0x4d, 0x9d, 0x98, 0xa0,
+  0xa9, 0xfe, 0xcc, 0x5a, 0x56, 0xfe, 0xe9, 0x8a, 0x6c, 0xfe, 0xeb, 0x95,
+  0x75, 0x9e, 0xc8, 0xfe, 0xd3, 0x64, 0x5a, 0xfe, 0x94, 0x2d, 0x47, 0x2c,
+  0xa4, 0xc6, 0x64, 0x7d, 0xa2, 0x96, 0xa2, 0x1d, 0xfe, 0xf8, 0xb5, 0x7d,
+  0xfe, 0xe5, 0x83, 0x67, 0xfe, 0xd8, 0x69, 0x5e, 0xfe, 0xb9, 0x49, 0x52,
+  0xa1, 0x6a, 0x1a, 0x99, 0x8b, 0x98, 0x6d, 0xfe, 0xd5, 0x74, 0x72, 0x9c,
+  0x5a, 0xa7, 0x08, 0xa3, 0xb8, 0xab, 0x26, 0x67, 0xa7, 0x17, 0xa4, 0x55,
+  0x9f, 0x95, 0x9c, 0x6a, 0xa6, 0x49, 0xa3, 0x98, 0xa1, 0x79, 0x4f, 0xa1,
+  0x59, 0x97, 0x9d, 0xfe, 0xd7, 0xa2, 0x96, 0xac, 0x31, 0xfe, 0xe2, 0xbc,
+  0xab, 0x4a, 0x9c, 0x9d, 0xa3, 0x58, 0xa7, 0x58, 0xa1, 0x79, 0xa9, 0x46,
+  0xfe, 0xd3, 0x98, 0x90, 0xfe, 0xd0, 0x8d, 0x86, 0xb3, 0x17, 0xfe, 0x76,
+  0x3f, 0x5b, 0xfe, 0x5d, 0x17, 0x3f, 0x9f, 0x69, 0xa1, 0xe8, 0xfe, 0x89,
+  0x3c, 0x63, 0xfe, 0xd3, 0x7e, 0x7d, 0xa5, 0x16, 0xa9, 0x20, 0x9c, 0xb9,
+  0xa2, 0x68, 0x9e, 0x97, 0x6d, 0x66, 0xfe, 0xab, 0x41, 0x4f, 0x55, 0xa2,
+  0xe5, 0xfe, 0xd2, 0x5a, 0x57, 0xfe, 0xe9, 0x8a, 0x6c, 0xfe, 0xec, 0x97,
+  0x75, 0x9c, 0xf7, 0xfe, 0xd4, 0x66, 0x5d, 0xfe, 0x92, 0x2b, 0x42, 0xb1,
+  0x82, 0xa3, 0xf4, 0x59, 0xa1, 0xa7, 0x79, 0xfe, 0xaf, 0x4c, 0x55, 0xfe,
+  0xfb, 0xc1, 0x8b, 0xfe, 0xe9, 0x92, 0x6d, 0xfe, 0xe2, 0x7b, 0x61, 0xfe,
+  0xc7, 0x53, 0x55, 0xfe, 0xcc, 0x61, 0x65, 0xa3, 0x0a, 0x99, 0x7c, 0xfe,
+  0xd4, 0x6f, 0x70, 0x9d, 0x28, 0xfe, 0xc8, 0x68, 0x72, 0xaa, 0x41, 0xa9,
+  0x87, 0xfe, 0xbd, 0x69, 0x7d, 0x9a, 0x6f, 0xfe, 0xb0, 0x67, 0x83, 0xfe,
+  0xbd, 0x76, 0x83, 0x95, 0xcc, 0xfe, 0xd5, 0x87, 0x83, 0xfe, 0xd0, 0x87,
+  0x8d, 0xa0, 0xc5, 0xfe, 0xbe, 0x78, 0x89, 0xfe, 0xc9, 0x82, 0x8a, 0xa8,
+  0x61, 0xfe, 0xdd, 0xa6, 0x93, 0xfe, 0xe1, 0xb4, 0xa6, 0xa7, 0x23, 0x98,
+  0x7d, 0xa6, 0x4b, 0xa5, 0x66, 0xa5, 0x69, 0xa1, 0x89, 0xa4, 0x67, 0xfe,
+  0xe1, 0xbc, 0xae, 0xfe, 0xbb, 0x6e, 0x6d, 0xfe, 0xab, 0x51, 0x5f, 0xfe,
+  0xe0, 0xba, 0xaa, 0xfe, 0x49, 0x05, 0x34, 0xb5, 0x91, 0xa3, 0x97, 0xfe,
+  0x61, 0x19, 0x48, 0xfe, 0xc0, 0x6c, 0x78, 0xfe, 0xd0, 0x7b, 0x7c, 0xfe,
+  0xd5, 0x8b, 0x80, 0x9d, 0xa8, 0x46, 0x6e, 0x64, 0xa1, 0x59, 0x9d, 0xba,
+  0xfe, 0xac, 0x43, 0x50, 0xa0, 0x58, 0xfe, 0xb6, 0x45, 0x4e, 0xfe, 0xd8,
+  0x5e, 0x56, 0xfe, 0xeb, 0x8c, 0x6c, 0xfe, 0xee, 0x98, 0x74, 0x9d, 0xc9,
+  0xfe, 0xd7, 0x67, 0x5b, 0xfe, 0x90, 0x2a, 0x43, 0xb0, 0x90, 0xa6, 0xd5,
+  0xa2, 0xb6, 0x9d, 0xc8, 0xa1, 0x95, 0x9f, 0x1b, 0xfe, 0xfc, 0xc7, 0x93,
+  0xfe, 0xf1, 0xa4, 0x74, 0xfe, 0xd8, 0x69, 0x56, 0xfe, 0xc7, 0x5a, 0x58,
+  0xfe, 0xc1, 0x59, 0x5f, 0xfe, 0xb6, 0x55, 0x63, 0xfe, 0xd2, 0x6c, 0x6c,
+  0x99, 0x5c, 0x9d, 0x9d, 0xa4, 0x66, 0xac, 0x65, 0xfe, 0xbc, 0x64, 0x7b,
+  0x9e, 0x78, 0xfe, 0xa4, 0x4f, 0x6f, 0xfe, 0x81, 0x3b, 0x70, 0xfe, 0xb8,
+  0x7a, 0x99, 0xfe, 0x8d, 0x4f, 0x81, 0x92, 0x2e, 0x9d, 0xf0, 0x81, 0xe6,
+  0xfe, 0x56, 0x1c, 0x4e, 0xfe, 0xa5, 0x6c, 0x7c, 0xfe, 0xd8, 0x9f, 0x98,
+  0xfe, 0xe2, 0xb9, 0xa9, 0x4a, 0xa2, 0x49, 0x9e, 0x69, 0xa5, 0x89, 0xa1,
+  0x89, 0xa6, 0x66, 0x9e, 0xa7, 0xfe, 0xc7, 0x8c, 0x82, 0xfe, 0xa4, 0x4a,
+  0x51, 0xfe, 0x9d, 0x3e, 0x51, 0xfe, 0xe1, 0xa9, 0x9e, 0xfe, 0x85, 0x4e,
+  0x5f, 0xfe, 0x5d, 0x17, 0x3f, 0x45, 0xa3, 0xd6, 0xb9, 0x68, 0xfe, 0xd0,
+  0x7b, 0x7d, 0xfe, 0xd2, 0x87, 0x82, 0xa5, 0x53, 0x64, 0x9d, 0x9b, 0x41,
+  0xa0, 0x85, 0x46, 0x9f, 0xb6, 0xfe, 0xb1, 0x47, 0x53, 0x9a, 0xb8, 0xa3,
+  0xf6, 0xfe, 0xd7, 0x5e, 0x54, 0xfe, 0xea, 0x8c, 0x6d, 0xfe, 0xec, 0x97,
+  0x73, 0x9d, 0xda, 0xfe, 0xd7, 0x67, 0x5a, 0xfe, 0x91, 0x2c, 0x45, 0xfe,
+  0xa4, 0x3b, 0x4b, 0xa5, 0xc3, 0xa2, 0x98, 0x75, 0x9d, 0xa8, 0xfe, 0x9f,
+  0x2d, 0x42, 0xfe, 0xf9, 0xc4, 0x90, 0xfe, 0xf5, 0xad, 0x79, 0xfe, 0xd0,
+  0x61, 0x5f, 0xfe, 0xd0, 0x6b, 0x68, 0xfe, 0xb0, 0x4c, 0x5c, 0xfe, 0xd0,
+  0x68, 0x6a, 0x9a, 0x3e, 0x9e, 0xc8, 0xa4, 0x47, 0xa7, 0xa5, 0xfe, 0xb9,
+  0x5a, 0x72, 0xa8, 0x97, 0xfe, 0x91, 0x48, 0x77, 0x8d, 0x69, 0x8a, 0xbb,
+  0xfe, 0x8a, 0x53, 0x89, 0xfe, 0x7c, 0x3b, 0x73, 0xaa, 0x23, 0x8c, 0x47,
+  0xfe, 0x47, 0x0e, 0x42, 0xfe, 0xab, 0x70, 0x77, 0xfe, 0xd5, 0x98, 0x90,
+  0xfe, 0xde, 0xb1, 0x9f, 0xa7, 0x0c, 0x9c, 0xb5, 0xa3, 0x5b, 0xa1, 0x59,
+  0xa4, 0x7b, 0xa7, 0x82, 0xfe, 0xc7, 0x97, 0x94, 0xfe, 0x99, 0x38, 0x49,
+  0xa9, 0x4a, 0xfe, 0xc1, 0x6a, 0x6d, 0xfe, 0xe7, 0xad, 0x99, 0xfe, 0x85,
+  0x45, 0x54, 0xfe, 0x5b, 0x12, 0x3d, 0xa4, 0xb5, 0xa2, 0x47, 0xa3, 0x0e,
+  0xfe, 0xb5, 0x63, 0x73, 0xfe, 0xcd, 0x7d, 0x7d, 0xfe, 0xd6, 0x91, 0x84,
+  0x9c, 0xbb, 0x48, 0x9d, 0x9c, 0x46, 0x9d, 0xc6, 0x4a, 0x62, 0xfe, 0xb3,
+  0x4a, 0x55, 0x9c, 0x99, 0xfe, 0xb5, 0x42, 0x4b, 0xfe, 0xd5, 0x5d, 0x56,
+  0xfe, 0xe9, 0x8a, 0x6c, 0xfe, 0xeb, 0x96, 0x73, 0x9d, 0xe9, 0xfe, 0xd9,
+  0x69, 0x5c, 0xfe, 0x8f, 0x2c, 0x44, 0xae, 0xe0, 0xa5, 0xc5, 0xa3, 0x75,
+  0x56, 0xa0, 0xc6, 0x9a, 0x6c, 0xfe, 0xda, 0x93, 0x7b, 0xfe, 0xf8, 0xb6,
+  0x81, 0xfe, 0xdb, 0x82, 0x6f, 0xfe, 0xc4, 0x5e, 0x5e, 0xa4, 0xbf, 0x9c,
+  0x59, 0x9d, 0x9c, 0xa3, 0x76, 0xa5, 0x2a, 0x9c, 0xca, 0xfe, 0xaa, 0x50,
+  0x6b, 0xfe, 0x71, 0x2c, 0x5f, 0x9b, 0x65, 0x90, 0xc7, 0xfe, 0x7d, 0x3b,
+  0x70, 0x8c, 0xf3, 0xfe, 0x83, 0x4a, 0x80, 0x82, 0x96, 0xfe, 0x65, 0x35,
+  0x67, 0xfe, 0xbb, 0x70, 0x71, 0xfe, 0xd7, 0xa2, 0x9a, 0xaa, 0x11, 0xa0,
+  0x5c, 0x9f, 0x84, 0xa2, 0x89, 0xa6, 0x67, 0xaa, 0x09, 0xfe, 0xbd, 0x8f,
+  0x86, 0xfe, 0x8b, 0x4a, 0x65, 0xb6, 0x5a, 0xfe, 0xdb, 0x86, 0x7d, 0xfe,
+  0xe9, 0x93, 0x79, 0xfe, 0xf1, 0xac, 0x91, 0xfe, 0x8a, 0x4b, 0x5a, 0xfe,
+  0x5c, 0x12, 0x3c, 0xab, 0x62, 0x9a, 0x9b, 0xa3, 0x95, 0xac, 0x5f, 0xfe,
+  0xd0, 0x7c, 0x7d, 0xfe, 0xd4, 0x88, 0x7f, 0xfe, 0xd6, 0x93, 0x82, 0x67,
+  0x9d, 0x8b, 0x9c, 0xab, 0x9d, 0x9b, 0xa0, 0x75, 0x56, 0x9d, 0xb9, 0xfe,
+  0xb4, 0x4b, 0x56, 0x9c, 0x88, 0x9a, 0xe7, 0xfe, 0xcf, 0x56, 0x51, 0xfe,
+  0xea, 0x8b, 0x6e, 0xfe, 0xed, 0x97, 0x76, 0x9e, 0xb7, 0xfe, 0xdb, 0x6a,
+  0x5d, 0xfe, 0x8d, 0x29, 0x44, 0xfe, 0xa1, 0x38, 0x4a, 0xa6, 0xb5, 0xa1,
+  0xb4, 0x9f, 0xb9, 0xa5, 0x75, 0xa4, 0x75, 0xfe, 0xaf, 0x4a, 0x52, 0xfe,
+  0xfa, 0xc7, 0x93, 0xfe, 0xeb, 0xa0, 0x7d, 0xfe, 0xc0, 0x56, 0x5a, 0xaa,
+  0x4e, 0x9a, 0x8a, 0xfe, 0xc0, 0x5f, 0x75, 0x9f, 0xc7, 0xa0, 0x93, 0xfe,
+  0x8c, 0x35, 0x5d, 0xfe, 0x76, 0x35, 0x67, 0x8d, 0x88, 0xb5, 0x98, 0xfe,
+  0x55, 0x0f, 0x41, 0xbc, 0x74, 0x95, 0xea, 0xfe, 0x6b, 0x2b, 0x61, 0xfe,
+  0x76, 0x4b, 0x7c, 0xfe, 0x9d, 0x5e, 0x7f, 0xfe, 0xda, 0xa8, 0x9e, 0xfe,
+  0xde, 0xb6, 0xa6, 0x94, 0xac, 0x66, 0x9a, 0xb9, 0xaa, 0x17, 0xa3, 0xb8,
+  0xfe, 0xde, 0xa0, 0x95, 0xfe, 0x85, 0x2d, 0x4f, 0xfe, 0x94, 0x50, 0x6e,
+  0xb5, 0x14, 0xfe, 0xd3, 0x84, 0x85, 0xfe, 0xef, 0xa6, 0x88, 0xfe, 0x7c,
+  0x37, 0x4a, 0xfe, 0x5a, 0x10, 0x39, 0xa9, 0xb4, 0xa6, 0x26, 0x95, 0xad,
+  0xa6, 0x78, 0xfe, 0x9b, 0x4f, 0x67, 0xfe, 0xc1, 0x72, 0x77, 0xfe, 0xd9,
+  0x96, 0x83, 0x9c, 0x8b, 0x72, 0x5f, 0x9b, 0xac, 0x9f, 0x7b, 0x9f, 0x95,
+  0x9d, 0x7c, 0x9d, 0xb7, 0xfe, 0xb5, 0x4b, 0x55, 0x9a, 0xba, 0x9a, 0x78,
+  0xfe, 0xc6, 0x51, 0x50, 0xfe, 0xe8, 0x89, 0x6e, 0xfe, 0xec, 0x96, 0x77,
+  0xa1, 0xb4, 0xfe, 0xdc, 0x6a, 0x5d, 0xfe, 0x8e, 0x29, 0x43, 0xac, 0xb1,
+  0xaa, 0xc3, 0x08, 0xa1, 0x98, 0xa4, 0xb5, 0xa9, 0x84, 0x93, 0x5c, 0xfe,
+  0xe2, 0xa1, 0x88, 0xfe, 0xf1, 0xae, 0x80, 0xfe, 0xc8, 0x5c, 0x60, 0xfe,
+  0xb7, 0x53, 0x63, 0xa8, 0x9a, 0xa3, 0x93, 0xfe, 0xba, 0x5b, 0x74, 0xfe,
+  0x8e, 0x3d, 0x66, 0xfe, 0x70, 0x25, 0x58, 0xb4, 0x36, 0x81, 0x69, 0xbb,
+  0x7a, 0x8d, 0xa1, 0x95, 0xb5, 0xad, 0x3c, 0xad, 0x9d, 0xfe, 0x86, 0x4f,
+  0x86, 0xfe, 0xbe, 0x8c, 0x99, 0xfe, 0xda, 0xa9, 0x9c, 0x9c, 0x5a, 0x9d,
+  0x9a, 0xa0, 0xa6, 0xa0, 0x5d, 0xaf, 0xc5, 0xa2, 0xf8, 0xa6, 0x43, 0xfe,
+  0xc6, 0x58, 0x5f, 0xfe, 0x7d, 0x38, 0x5a, 0xbc, 0x45, 0xfe, 0xca, 0x82,
+  0x8a, 0xfe, 0x78, 0x22, 0x3f, 0xfe, 0x5a, 0x12, 0x3e, 0xfe, 0x68, 0x1b,
+  0x3e, 0xa5, 0x68, 0x97, 0x7a, 0x75, 0xaa, 0x3e, 0xfe, 0xb4, 0x69, 0x72,
+  0xfe, 0xc5, 0x7c, 0x7c, 0xfe, 0xd6, 0x97, 0x84, 0x9b, 0xbc, 0x79, 0x41,
+  0x9e, 0x9c, 0xc0, 0x9c, 0xa8, 0x46, 0x9c, 0xaa, 0xfe, 0xb1, 0x49, 0x57,
+  0x9d, 0x96, 0x98, 0xb8, 0xfe, 0xc1, 0x51, 0x54, 0xfe, 0xe8, 0x87, 0x70,
+  0xfe, 0xec, 0x98, 0x77, 0x9d, 0xeb, 0xfe, 0xdc, 0x6c, 0x61, 0xfe, 0x90,
+  0x2a, 0x44, 0xaf, 0x91, 0xa8, 0xd3, 0xa2, 0x97, 0x9c, 0xc9, 0xa7, 0x74,
+  0xa8, 0xa6, 0x99, 0x87, 0xfe, 0xe0, 0x97, 0x82, 0xfe, 0xe1, 0x91, 0x70,
+  0xfe, 0xb9, 0x4e, 0x58, 0xa9, 0x3b, 0xa3, 0xf7, 0xa4, 0x78, 0xfe, 0x80,
+  0x2d, 0x4f, 0xfe, 0x70, 0x28, 0x53, 0x8b, 0x4a, 0xb7, 0x7c, 0x5a, 0x99,
+  0x8d, 0xfe, 0x81, 0x48, 0x78, 0xfe, 0x5b, 0x18, 0x42, 0xa6, 0x57, 0xfe,
+  0xac, 0x5b, 0x73, 0xfe, 0xb5, 0x80, 0x9b, 0xfe, 0xdd, 0xad, 0x9d, 0xa1,
+  0x3c, 0xfe, 0xcc, 0x91, 0x8d, 0xfe, 0xd2, 0xa5, 0x9c, 0xfe, 0xd7, 0x91,
+  0x8c, 0xfe, 0xea, 0xad, 0xa2, 0xfe, 0xee, 0xba, 0xac, 0x67, 0xa7, 0x46,
+  0xfe, 0xde, 0x79, 0x74, 0xfe, 0x6c, 0x18, 0x40, 0xfe, 0x7f, 0x34, 0x58,
+  0xfe, 0xca, 0x89, 0x93, 0xfe, 0x63, 0x15, 0x3e, 0xa0, 0x57, 0xa7, 0xb5,
+  0xa7, 0x46, 0x91, 0x7b, 0xa1, 0xb9, 0xfe, 0x89, 0x41, 0x5f, 0xfe, 0xba,
+  0x70, 0x73, 0xfe, 0xcb, 0x85, 0x7d, 0xaa, 0x51, 0xa5, 0x54, 0x9c, 0xba,
+  0x9f, 0xab, 0x6e, 0x9c, 0x9e, 0x60, 0x10, 0x99, 0xdb, 0xfe, 0xb1, 0x48,
+  0x53, 0x9d, 0xa9, 0x9a, 0x6a, 0xfe, 0xc0, 0x51, 0x53, 0xfe, 0xe7, 0x88,
+  0x6f, 0xfe, 0xec, 0x98, 0x79, 0xa1, 0x93, 0xfe, 0xda, 0x6d, 0x61, 0xfe,
+  0x91, 0x2e, 0x49, 0xaa, 0xe0, 0xac, 0xb3, 0xa1, 0x98, 0x9d, 0xa7, 0xab,
+  0x72, 0xaa, 0x83, 0x99, 0xe9, 0xfe, 0xca, 0x6c, 0x67, 0xfe, 0xd7, 0x7f,
+  0x70, 0xfe, 0xbe, 0x51, 0x58, 0xab, 0x59, 0xfe, 0xbc, 0x54, 0x66, 0xfe,
+  0x76, 0x26, 0x4d, 0x91, 0x5e, 0xfe, 0x6a, 0x27, 0x53, 0x99, 0xc9, 0x98,
+  0x68, 0xa6, 0x9d, 0xfe, 0x7f, 0x3f, 0x75, 0x9e, 0x22, 0xfe, 0x4d, 0x0e,
+  0x3a, 0xfe, 0xc2, 0x6b, 0x6f, 0xfe, 0xdc, 0x9d, 0x93, 0xfe, 0xc2, 0x8c,
+  0x9a, 0xfe, 0xd2, 0xa7, 0xa1, 0x9b, 0xe7, 0xfe, 0xd0, 0x94, 0x90, 0xfe,
+  0xe0, 0x85, 0x7f, 0xfe, 0xe8, 0x9f, 0x94, 0xfe, 0xed, 0xb2, 0xa6, 0xaa,
+  0x05, 0xa4, 0x69, 0xa8, 0x46, 0xfe, 0xef, 0xa0, 0x93, 0xfe, 0x89, 0x22,
+  0x3f, 0xfe, 0x5f, 0x15, 0x42, 0xfe, 0xc1, 0x81, 0x8d, 0xfe, 0x66, 0x1e,
+  0x46, 0x9d, 0xc6, 0xa6, 0x66, 0x5d, 0x94, 0x9c, 0x9e, 0x6e, 0xfe, 0xb3,
+  0x6a, 0x71, 0xfe, 0xc6, 0x7c, 0x78, 0xae, 0x21, 0x99, 0xae, 0x61, 0xa6,
+  0x52, 0xa2, 0x88, 0xa5, 0x76, 0x43, 0x10, 0x9c, 0xc9, 0x9c, 0xbb, 0xfe,
+  0xb1, 0x46, 0x52, 0x9d, 0x78, 0x99, 0xaa, 0xfe, 0xbe, 0x4e, 0x52, 0xfe,
+  0xe7, 0x87, 0x73, 0xfe, 0xeb, 0x9a, 0x79, 0x9e, 0xd6, 0xfe, 0xd9, 0x6d,
+  0x63, 0xfe, 0x93, 0x2f, 0x4b, 0xfe, 0xa1, 0x3d, 0x50, 0xa7, 0xe3, 0xa2,
+  0xb7, 0x61, 0xa8, 0x93, 0xa6, 0xa3, 0x5a, 0x9f, 0xc8, 0xfe, 0xcc, 0x67,
+  0x5c, 0xfe, 0xd0, 0x5e, 0x64, 0xfe, 0xbe, 0x63, 0x7c, 0xfe, 0x81, 0x2b,
+  0x4f, 0xfe, 0x68, 0x28, 0x5b, 0x8b, 0xd5, 0xb2, 0x88, 0x9d, 0x95, 0x9b,
+  0x9c, 0x69, 0xb1, 0x2b, 0x93, 0x15, 0xfe, 0xb3, 0x5c, 0x66, 0xfe, 0xd6,
+  0x89, 0x82, 0xfe, 0xdc, 0xa7, 0x9a, 0xfe, 0xc2, 0x94, 0x9c, 0xfe, 0xd7,
+  0xac, 0xa5, 0xfe, 0xd3, 0x8a, 0x88, 0xfe, 0xe1, 0x83, 0x82, 0xfe, 0xe7,
+  0x95, 0x8e, 0xaa, 0x14, 0xfe, 0xed, 0xb4, 0xa7, 0xa6, 0x36, 0xa7, 0x47,
+  0xa7, 0x59, 0xfe, 0xf3, 0xba, 0xaa, 0xfe, 0xaf, 0x3b, 0x4b, 0xfe, 0x50,
+  0x0e, 0x3d, 0xfe, 0xb6, 0x72, 0x83, 0xfe, 0x70, 0x21, 0x46, 0x9e, 0x18,
+  0xa5, 0x86, 0x97, 0x9a, 0x64, 0xaf, 0x4c, 0xfe, 0xc4, 0x75, 0x74, 0xfe,
+  0xd0, 0x8e, 0x80, 0xa3, 0x76, 0x9f, 0x59, 0x9c, 0xcc, 0x9b, 0x99, 0xfe,
+  0xc0, 0x7f, 0x7d, 0x79, 0xa1, 0xa8, 0xa1, 0xc6, 0xa5, 0x73, 0xfe, 0xd0,
+  0x81, 0x79, 0xfe, 0xb0, 0x44, 0x4f, 0x9d, 0x8a, 0x9d, 0x88, 0xb1, 0xa1,
+  0xfe, 0xe5, 0x88, 0x75, 0xfe, 0xec, 0x9a, 0x7b, 0x9f, 0xb6, 0xfe, 0xdb,
+  0x6c, 0x5f, 0xfe, 0x92, 0x2e, 0x4a, 0xac, 0xa2, 0xab, 0xc0, 0xa0, 0xa8,
+  0x74, 0xa7, 0xc2, 0xa8, 0xb3, 0xac, 0x35, 0xfe, 0xb9, 0x5d, 0x59, 0xfe,
+  0xa9, 0x4e, 0x57, 0xfe, 0xbf, 0x6a, 0x86, 0xfe, 0xa7, 0x40, 0x53, 0xfe,
+  0x6b, 0x30, 0x64, 0xa4, 0x58, 0xfe, 0x57, 0x0f, 0x3e, 0xbf, 0x56, 0x85,
+  0xa7, 0xb0, 0x59, 0xfe, 0x68, 0x25, 0x5b, 0x9a, 0x32, 0xfe, 0x92, 0x45,
+  0x5a, 0xfe, 0xcc, 0x86, 0x81, 0xfe, 0xd9, 0x98, 0x8a, 0xfe, 0xd7, 0xa4,
+  0x9d, 0xfe, 0xd5, 0xae, 0xa3, 0xfe, 0xb5, 0x5d, 0x64, 0xfe, 0xcb, 0x68,
+  0x70, 0xbe, 0x02, 0xfe, 0xec, 0x9f, 0x96, 0x9b, 0xb6, 0xfe, 0xed, 0xab,
+  0x9a, 0xa8, 0x09, 0xa6, 0x47, 0xab, 0x28, 0xfe, 0xf6, 0xbe, 0xa8, 0xfe,
+  0xa8, 0x3a, 0x4e, 0xfe, 0x53, 0x0d, 0x3a, 0xfe, 0xa0, 0x5a, 0x72, 0xfe,
+  0x85, 0x37, 0x56, 0xfe, 0x6a, 0x26, 0x4c, 0xa2, 0xb3, 0x90, 0x9f, 0x9f,
+  0x69, 0xfe, 0x9c, 0x53, 0x6a, 0xfe, 0xbf, 0x72, 0x74, 0xfe, 0xd4, 0x90,
+  0x7f, 0x9e, 0x7a, 0xa0, 0x75, 0xa5, 0x5a, 0x9c, 0xb9, 0x99, 0x7c, 0x9c,
+  0x6c, 0x9b, 0xaf, 0x9d, 0x98, 0x62, 0xa0, 0xf4, 0xfe, 0xb0, 0x45, 0x52,
+  0xa2, 0x56, 0x97, 0xdb, 0xfe, 0xbc, 0x4c, 0x51, 0xfe, 0xe7, 0x86, 0x72,
+  0xfe, 0xee, 0x9a, 0x7a, 0xa1, 0x98, 0xfe, 0xdc, 0x70, 0x61, 0xfe, 0x92,
+  0x2e, 0x4b, 0xfe, 0xa2, 0x3c, 0x4f, 0xa9, 0xc4, 0x9e, 0xc7, 0x9f, 0xa5,
+  0xa6, 0xa4, 0xa9, 0xa7, 0xfe, 0xdb, 0x74, 0x6d, 0xfe, 0xa1, 0x52, 0x5c,
+  0xfe, 0x8b, 0x43, 0x66, 0xfe, 0xad, 0x49, 0x53, 0xfe, 0x73, 0x2c, 0x5f,
+  0x9f, 0x0b, 0xfe, 0x7a, 0x44, 0x75, 0xfe, 0x59, 0x16, 0x47, 0xad, 0x34,
+  0xfe, 0x65, 0x1e, 0x4a, 0x99, 0x8a, 0xfe, 0x6e, 0x31, 0x60, 0xfe, 0x6c,
+  0x29, 0x4c, 0xfe, 0xce, 0x81, 0x7e, 0xfe, 0xe0, 0xaa, 0x97, 0xfe, 0xd3,
+  0x98, 0x90, 0xfe, 0xd5, 0xa9, 0x9e, 0xfe, 0xcf, 0x60, 0x61, 0xaa, 0x2a,
+  0x96, 0x9a, 0xfe, 0x9b, 0x32, 0x48, 0xfe, 0xbe, 0x57, 0x62, 0xfe, 0xe7,
+  0x8f, 0x88, 0xfe, 0xec, 0x9f, 0x93, 0xfe, 0xee, 0xad, 0xa0, 0x9f, 0x95,
+  0xfe, 0xce, 0x77, 0x73, 0xfe, 0xab, 0x49, 0x58, 0xfe, 0xa7, 0x3c, 0x4b,
+  0xfe, 0x5f, 0x13, 0x3c, 0xfe, 0x88, 0x45, 0x63, 0xfe, 0x97, 0x4c, 0x64,
+  0xfe, 0x6d, 0x26, 0x48, 0x9b, 0x89, 0x99, 0x9b, 0xa0, 0x8d, 0xfe, 0xb7,
+  0x6b, 0x74, 0xfe, 0xc8, 0x7e, 0x78, 0xfe, 0xd6, 0x8c, 0x7c, 0x9d, 0x6b,
+  0x55, 0xa1, 0x59, 0xa3, 0x64, 0x9c, 0x8b, 0xa1, 0x6a, 0xa1, 0x6c, 0x9a,
+  0x9d, 0x9a, 0x6b, 0x94, 0xcf, 0xfe, 0xab, 0x42, 0x4f, 0x65, 0x98, 0x7a,
+  0xfe, 0xb8, 0x47, 0x4f, 0xfe, 0xe7, 0x87, 0x6f, 0xfe, 0xef, 0x9d, 0x77,
+  0x9c, 0xbe, 0xfe, 0xdd, 0x70, 0x62, 0xfe, 0x92, 0x2c, 0x45, 0xab, 0xb1,
+  0xab, 0xe2, 0x9d, 0xc7, 0x9c, 0x8b, 0xfe, 0xbe, 0x61, 0x6c, 0xfe, 0xd9,
+  0x80, 0x6e, 0xfe, 0xe1, 0x7d, 0x6f, 0xfe, 0xc0, 0x65, 0x68, 0xfe, 0x79,
+  0x28, 0x4a, 0xfe, 0x69, 0x2f, 0x63, 0xb7, 0x79, 0xa2, 0x99, 0xfe, 0x59,
+  0x1a, 0x4a, 0xb6, 0x7a, 0xfe, 0x52, 0x0c, 0x3b, 0xfe, 0x74, 0x3b, 0x6c,
+  0xfe, 0x61, 0x19, 0x42, 0x90, 0x2e, 0xfe, 0xbc, 0x6c, 0x70, 0xfe, 0xe0,
+  0xa0, 0x8b, 0xfe, 0xe1, 0xbc, 0xaf, 0xfe, 0xce, 0x99, 0x8c, 0xfe, 0x87,
+  0x20, 0x3a, 0xfe, 0x71, 0x17, 0x3a, 0x9d, 0x3c, 0xfe, 0x75, 0x29, 0x48,
+  0xfe, 0x8a, 0x2b, 0x48, 0xfe, 0xd8, 0x5d, 0x63, 0xfe, 0xdf, 0x70, 0x72,
+  0xfe, 0xec, 0x97, 0x8e, 0xfe, 0xf4, 0xbe, 0xad, 0xfe, 0xb3, 0x5f, 0x65,
+  0xfe, 0x7b, 0x28, 0x48, 0x90, 0xbd, 0xa5, 0xa5, 0xfe, 0x61, 0x12, 0x39,
+  0xfe, 0x85, 0x3b, 0x5b, 0xfe, 0xa5, 0x5c, 0x6e, 0xfe, 0x6d, 0x25, 0x49,
+  0x93, 0xaa, 0xa2, 0x77, 0xab, 0x6a, 0xfe, 0xc2, 0x75, 0x76, 0xfe, 0xd2,
+  0x8b, 0x7b, 0x9d, 0xca, 0x9e, 0x79, 0xa0, 0xa8, 0xa1, 0x59, 0x5d, 0x9e,
+  0x79, 0xa0, 0x5b, 0xa1, 0x6d, 0x99, 0x9b, 0x9c, 0x6c, 0x9a, 0x8c, 0xfe,
+  0xaa, 0x42, 0x50, 0x9c, 0x99, 0x95, 0x5c, 0xfe, 0xb0, 0x41, 0x4c, 0xfe,
+  0xe7, 0x88, 0x6f, 0xfe, 0xee, 0x9d, 0x7a, 0xa2, 0x78, 0xfe, 0xdd, 0x6e,
+  0x5e, 0xfe, 0x96, 0x2e, 0x45, 0xae, 0xd0, 0xa6, 0xd2, 0xa2, 0x5a, 0x93,
+  0x6b, 0xfe, 0xab, 0x60, 0x68, 0xfe, 0xdd, 0x90, 0x82, 0xfe, 0xc1, 0x62,
+  0x61, 0xfe, 0x77, 0x27, 0x49, 0xfe, 0x6b, 0x2e, 0x61, 0x98, 0xc7, 0x9f,
+  0x6d, 0xfe, 0x8e, 0x59, 0x8b, 0xfe, 0x54, 0x12, 0x3f, 0xa6, 0x78, 0xb1,
+  0xa6, 0x8a, 0xd6, 0xa3, 0x19, 0xfe, 0x80, 0x36, 0x58, 0xfe, 0xcd, 0x8b,
+  0x88, 0xfe, 0xdc, 0xaf, 0xa3, 0xa2, 0x24, 0xfe, 0xad, 0x42, 0x50, 0xfe,
+  0x75, 0x17, 0x3b, 0xfe, 0x92, 0x3e, 0x57, 0xfe, 0x77, 0x2d, 0x56, 0xfe,
+  0xed, 0xcc, 0xca, 0xfe, 0xb0, 0x45, 0x57, 0xfe, 0xc6, 0x4c, 0x56, 0xb7,
+  0x64, 0xfe, 0xee, 0x9f, 0x96, 0xfe, 0xde, 0x9e, 0x90, 0xfe, 0x7a, 0x2c,
+  0x50, 0xb6, 0x19, 0xfe, 0xb7, 0x5f, 0x6f, 0xfe, 0x64, 0x11, 0x35, 0xfe,
+  0x5b, 0x11, 0x3a, 0xfe, 0x81, 0x36, 0x59, 0xfe, 0xae, 0x66, 0x77, 0xfe,
+  0x73, 0x2b, 0x4d, 0x8d, 0x9b, 0xa0, 0x5a, 0xfe, 0x96, 0x4c, 0x62, 0xfe,
+  0xc6, 0x78, 0x76, 0xfe, 0xd3, 0x8a, 0x7c, 0x25, 0x9c, 0xa8, 0x9f, 0xba,
+  0x5e, 0x6f, 0x9f, 0x58, 0x9e, 0x4e, 0x9d, 0x7c, 0x99, 0x6c, 0x97, 0x7e,
+  0xac, 0x42, 0xfe, 0xaf, 0x45, 0x51, 0x9b, 0x79, 0x93, 0x6e, 0xad, 0xf0,
+  0xfe, 0xe8, 0x87, 0x6f, 0xfe, 0xef, 0xa0, 0x7c, 0xa1, 0x98, 0xfe, 0xdf,
+  0x71, 0x62, 0xfe, 0x9f, 0x34, 0x48, 0xfe, 0xb2, 0x42, 0x4c, 0xa8, 0xc7,
+  0xfe, 0x93, 0x37, 0x45, 0xfe, 0x9e, 0x4c, 0x67, 0xfe, 0xcb, 0x82, 0x90,
+  0xfe, 0xb4, 0x7d, 0x7c, 0xfe, 0x65, 0x29, 0x5e, 0xae, 0x6a, 0x90, 0xb4,
+  0xad, 0x5a, 0xac, 0x7c, 0xfe, 0x8f, 0x60, 0x95, 0xfe, 0x67, 0x29, 0x58,
+  0xfe, 0x59, 0x12, 0x3c, 0xa5, 0xa7, 0x9f, 0x76, 0x9f, 0x0b, 0xfe, 0xc5,
+  0x77, 0x79, 0xfe, 0xde, 0xa4, 0x93, 0xfe, 0xd4, 0xae, 0xa1, 0xfe, 0xc6,
+  0x54, 0x5d, 0xb4, 0x55, 0x9a, 0x4d, 0x94, 0xce, 0xfe, 0xcb, 0x76, 0x83,
+  0xfe, 0xd7, 0x8e, 0x91, 0xfe, 0xda, 0x76, 0x7d, 0xfe, 0xd1, 0x56, 0x5f,
+  0xa7, 0x88, 0xfe, 0xef, 0xab, 0xa4, 0x8d, 0x7e, 0xfe, 0xc5, 0x68, 0x79,
+  0xfe, 0xc0, 0x73, 0x86, 0xfe, 0x97, 0x33, 0x4b, 0x8d, 0x1f, 0xfe, 0x5f,
+  0x18, 0x42, 0xb7, 0xb4, 0xfe, 0xb5, 0x72, 0x80, 0xfe, 0x74, 0x2c, 0x4c,
+  0x28, 0xa5, 0x97, 0xfe, 0xb3, 0x68, 0x70, 0xfe, 0xca, 0x81, 0x7b, 0xa6,
+  0x80, 0x9d, 0x9a, 0x9d, 0x9c, 0xa8, 0x15, 0x9c, 0xc8, 0x9d, 0xaa, 0x9c,
+  0x79, 0x9a, 0x6f, 0x9c, 0x3d, 0xa8, 0x72, 0xfe, 0xd6, 0x9e, 0x83, 0xfe,
+  0xe5, 0xae, 0x88, 0xfe, 0xac, 0x42, 0x50, 0x97, 0x3d, 0x94, 0x8a, 0xfe,
+  0xa6, 0x39, 0x46, 0xfe, 0xe6, 0x86, 0x71, 0xfe, 0xef, 0xa1, 0x7b, 0xa2,
+  0xab, 0xfe, 0xe2, 0x75, 0x62, 0xfe, 0xa0, 0x30, 0x44, 0xfe, 0xb0, 0x40,
+  0x4a, 0xa9, 0xf3, 0xfe, 0xc9, 0x65, 0x6c, 0xfe, 0xba, 0x64, 0x79, 0xfe,
+  0x76, 0x34, 0x61, 0x88, 0x8b, 0xfe, 0x65, 0x26, 0x5f, 0xfe, 0x88, 0x5b,
+  0x8f, 0xfe, 0x6e, 0x32, 0x66, 0x94, 0xcc, 0xfe, 0x7c, 0x4b, 0x84, 0xa7,
+  0xa6, 0xfe, 0x6b, 0x35, 0x61, 0xfe, 0x5b, 0x15, 0x3f, 0xa1, 0x97, 0x9c,
+  0x1c, 0xfe, 0x9d, 0x49, 0x56, 0xfe, 0xd6, 0x95, 0x8a, 0xfe, 0xd7, 0xb4,
+  0xa4, 0xfe, 0xb1, 0x3d, 0x49, 0xfe, 0xd6, 0x61, 0x6b, 0xfe, 0xe0, 0x79,
+  0x7e, 0xa7, 0x34, 0x9b, 0xaa, 0xa0, 0x6a, 0xfe, 0xe0, 0x88, 0x8d, 0x97,
+  0xd9, 0xfe, 0xd8, 0x62, 0x6b, 0xfe, 0xd8, 0x57, 0x63, 0xfe, 0xea, 0x9f,
+  0x9f, 0xfe, 0xe9, 0xbc, 0xb4, 0xfe, 0xdb, 0x7a, 0x7f, 0xfe, 0xd3, 0x62,
+  0x6b, 0x89, 0x7b, 0xfe, 0x94, 0x2c, 0x42, 0xfe, 0x64, 0x15, 0x3d, 0xb2,
+  0x39, 0xfe, 0xc2, 0x80, 0x8b, 0xfe, 0x6d, 0x21, 0x44, 0x98, 0x38, 0xa7,
+  0xb9, 0xfe, 0xbf, 0x72, 0x74, 0xfe, 0xd0, 0x89, 0x7d, 0x9d, 0x99, 0x9c,
+  0xab, 0xa2, 0x56, 0x9d, 0xa9, 0xa1, 0x59, 0x9b, 0xca, 0x9d, 0x2b, 0x96,
+  0x9f, 0xfe, 0xd2, 0x97, 0x83, 0xfe, 0xe9, 0xb6, 0x86, 0x65, 0x51, 0xfe,
+  0x9f, 0x3c, 0x4e, 0x96, 0x9d, 0x93, 0x8b, 0xfe, 0xa0, 0x36, 0x47, 0xfe,
+  0xe5, 0x86, 0x70, 0xfe, 0xef, 0x9e, 0x7b, 0xa4, 0x76, 0xfe, 0xe1, 0x75,
+  0x62, 0xfe, 0x9e, 0x2f, 0x43, 0xaf, 0x94, 0xfe, 0xc1, 0x5a, 0x6f, 0xfe,
+  0xb8, 0x6c, 0x93, 0xfe, 0x92, 0x58, 0x84, 0x82, 0x9c, 0x90, 0xfe, 0xfe,
+  0x86, 0x51, 0x89, 0x9f, 0xa4, 0xfe, 0x53, 0x13, 0x41, 0xb1, 0x6d, 0xfe,
+  0x7d, 0x45, 0x7b, 0xfe, 0x79, 0x4b, 0x7b, 0xfe, 0x95, 0x4d, 0x65, 0xfe,
+  0x5f, 0x1a, 0x44, 0x9c, 0x49, 0xb2, 0x34, 0xfe, 0xc7, 0x73, 0x74, 0xfe,
+  0xe5, 0xc0, 0xa9, 0xfe, 0x82, 0x30, 0x48, 0xfe, 0xc9, 0x4d, 0x55, 0xb2,
+  0x58, 0xfe, 0xe4, 0x78, 0x7a, 0xfe, 0xe8, 0x8d, 0x89, 0xfe, 0xe9, 0x99,
+  0x92, 0x56, 0x56, 0xfe, 0xe0, 0x7e, 0x7e, 0xfe, 0xdc, 0x6b, 0x72, 0xfe,
+  0xd9, 0x59, 0x61, 0xfe, 0xe6, 0x8f, 0x91, 0xfe, 0xed, 0xc4, 0xb9, 0xfe,
+  0xdf, 0x8b, 0x88, 0xfe, 0xdb, 0x68, 0x6f, 0x92, 0xeb, 0xfe, 0x9a, 0x33,
+  0x49, 0xfe, 0x6b, 0x1c, 0x41, 0x9f, 0x7d, 0xfe, 0xcf, 0x8e, 0x91, 0xfe,
+  0x61, 0x13, 0x38, 0xa3, 0x38, 0xfe, 0x8c, 0x3e, 0x56, 0xfe, 0xc4, 0x76,
+  0x74, 0xfe, 0xd1, 0x8c, 0x7d, 0x99, 0xbd, 0x9e, 0x7c, 0x68, 0x9d, 0x88,
+  0x9d, 0x7c, 0x9c, 0x8a, 0x98, 0x6d, 0xfe, 0xd3, 0x99, 0x80, 0xfe, 0xee,
+  0xbc, 0x89, 0x9e, 0x97, 0x99, 0xbb, 0xa5, 0x4e, 0xfe, 0x8f, 0x2f, 0x48,
+  0x9c, 0x99, 0x98, 0x3c, 0xfe, 0x9d, 0x33, 0x45, 0xfe, 0xe5, 0x84, 0x72,
+  0xfe, 0xed, 0x9c, 0x7b, 0xa1, 0x99, 0xfe, 0xe2, 0x74, 0x63, 0xfe, 0x9b,
+  0x31, 0x45, 0xb0, 0x74, 0xfe, 0xc0, 0x4a, 0x50, 0xfe, 0x9c, 0x4f, 0x7a,
+  0xfe, 0x85, 0x46, 0x7a, 0x93, 0xf7, 0xfe, 0x6a, 0x31, 0x67, 0xfe, 0x86,
+  0x59, 0x8d, 0xfe, 0x65, 0x27, 0x58, 0x90, 0xf4, 0x4e, 0xa9, 0x35, 0xfe,
+  0x5d, 0x13, 0x39, 0xfe, 0xaf, 0x5e, 0x6d, 0xfe, 0x74, 0x32, 0x50, 0xfe,
+  0x4c, 0x0b, 0x39, 0xfe, 0xa3, 0x4d, 0x58, 0xfe, 0xdc, 0xa7, 0x9f, 0xfe,
+  0x8f, 0x63, 0x6c, 0xfe, 0x7e, 0x20, 0x41, 0xfe, 0xce, 0x53, 0x59, 0xab,
+  0x97, 0xfe, 0xe2, 0x70, 0x72, 0xfe, 0xe6, 0x84, 0x7f, 0xfe, 0xeb, 0x98,
+  0x90, 0xa2, 0x46, 0x98, 0xf6, 0xfe, 0xe1, 0x79, 0x76, 0xfe, 0xde, 0x6d,
+  0x6f, 0xfe, 0xd7, 0x5a, 0x5f, 0xfe, 0xe3, 0x82, 0x85, 0xfe, 0xee, 0xca,
+  0xc1, 0xfe, 0xde, 0x87, 0x84, 0xfe, 0xdc, 0x6f, 0x75, 0xfe, 0xd7, 0x5c,
+  0x65, 0xfe, 0x8c, 0x29, 0x44, 0xfe, 0x69, 0x1a, 0x3f, 0x9a, 0xbd, 0xfe,
+  0xd6, 0x92, 0x91, 0xfe, 0x5d, 0x13, 0x3c, 0xa8, 0x72, 0xfe, 0xae, 0x5a,
+  0x60, 0xfe, 0xcc, 0x85, 0x7d, 0xa3, 0x91, 0x9e, 0x6d, 0x9b, 0xba, 0x9e,
+  0x7c, 0x9f, 0x66, 0x43, 0x98, 0x7c, 0xfe, 0xc4, 0x80, 0x77, 0xfe, 0xee,
+  0xba, 0x84, 0x9e, 0x97, 0xa1, 0x6b, 0xa7, 0x0f, 0xa5, 0x4f, 0xfe, 0x89,
+  0x2f, 0x4b, 0x9f, 0x4a, 0x92, 0x8c, 0xfe, 0x98, 0x31, 0x46, 0xfe, 0xe4,
+  0x83, 0x71, 0xfe, 0xeb, 0x97, 0x7b, 0xa4, 0x81, 0xfe, 0xe2, 0x73, 0x61,
+  0xfe, 0x94, 0x28, 0x42, 0xfe, 0xb2, 0x56, 0x70, 0xfe, 0xba, 0x66, 0x89,
+  0xfe, 0x84, 0x3b, 0x65, 0xfe, 0x96, 0x57, 0x84, 0xfe, 0x6a, 0x31, 0x65,
+  0xfe, 0x75, 0x40, 0x7c, 0xfe, 0x8a, 0x63, 0x9e, 0xfe, 0x73, 0x39, 0x67,
+  0xfe, 0x63, 0x20, 0x4b, 0x90, 0x69, 0xfe, 0x84, 0x32, 0x4c, 0xfe, 0x78,
+  0x25, 0x4e, 0xfe, 0xc6, 0x7c, 0x7f, 0xfe, 0x92, 0x41, 0x52, 0xfe, 0x54,
+  0x14, 0x3c, 0xfe, 0xc5, 0x6f, 0x72, 0xfe, 0xcf, 0xaf, 0x9f, 0xfe, 0x4d,
+  0x08, 0x35, 0xfe, 0x8b, 0x26, 0x41, 0xfe, 0xc9, 0x4e, 0x55, 0xaf, 0xa5,
+  0xae, 0x29, 0xfe, 0xe5, 0x7c, 0x7c, 0xfe, 0xe8, 0x8a, 0x83, 0xa6, 0x36,
+  0x9b, 0xc8, 0xfe, 0xdf, 0x6f, 0x6d, 0x91, 0xff, 0xfe, 0xd3, 0x54, 0x5a,
+  0xfe, 0xdf, 0x73, 0x7a, 0xfe, 0xf2, 0xd0, 0xc6, 0xfe, 0xdc, 0x7f, 0x7c,
+  0xfe, 0xdc, 0x6c, 0x73, 0xfe, 0xd3, 0x5b, 0x61, 0xfe, 0x6c, 0x1b, 0x42,
+  0xa8, 0x82, 0xfe, 0x60, 0x11, 0x3c, 0xfe, 0xcb, 0x83, 0x87, 0xfe, 0x6f,
+  0x2a, 0x4a, 0xfe, 0x62, 0x18, 0x40, 0xfe, 0xc5, 0x72, 0x6d, 0xfe, 0xd2,
+  0x8c, 0x79, 0x9b, 0xcb, 0x9f, 0x5b, 0x9c, 0x8d, 0x9d, 0x5a, 0x61, 0x9b,
+  0x8b, 0x97, 0x9d, 0xfe, 0xe5, 0xae, 0x7f, 0xfe, 0xef, 0xb8, 0x7e, 0xa1,
+  0x5b, 0xfe, 0xee, 0xc5, 0x98, 0xa6, 0x2c, 0x99, 0xc9, 0xfe, 0x91, 0x32,
+  0x4c, 0x9c, 0x29, 0xfe, 0x73, 0x19, 0x3c, 0xfe, 0x91, 0x2a, 0x40, 0xfe,
+  0xe5, 0x83, 0x70, 0xfe, 0xed, 0x9a, 0x7d, 0xa2, 0xa3, 0xfe, 0xe4, 0x75,
+  0x5f, 0xfe, 0x96, 0x2c, 0x46, 0xfe, 0xb1, 0x4e, 0x68, 0xaa, 0x1f, 0xfe,
+  0x81, 0x34, 0x66, 0xfe, 0x85, 0x47, 0x7d, 0x89, 0x8e, 0xfe, 0x73, 0x40,
+  0x76, 0xfe, 0x8c, 0x68, 0x9d, 0xfe, 0x6d, 0x32, 0x65, 0x88, 0xf2, 0x97,
+  0xc8, 0xfe, 0x86, 0x3d, 0x59, 0xfe, 0xae, 0x55, 0x5d, 0xfe, 0x73, 0x2a,
+  0x48, 0xfe, 0x4d, 0x0b, 0x38, 0xfe, 0xa9, 0x5e, 0x65, 0xfe, 0xcc, 0x90,
+  0x8a, 0xfe, 0x6a, 0x29, 0x46, 0xfe, 0x5b, 0x14, 0x3c, 0xfe, 0x96, 0x31,
+  0x47, 0xfe, 0xc5, 0x4b, 0x52, 0xb0, 0xb6, 0xab, 0x58, 0xfe, 0xe3, 0x74,
+  0x74, 0xa7, 0x26, 0xa9, 0x14, 0x9c, 0xaa, 0xfe, 0xd5, 0x61, 0x64, 0x9e,
+  0xea, 0x79, 0xab, 0x09, 0xfe, 0xf5, 0xd0, 0xc2, 0xfe, 0xdb, 0x7a, 0x78,
+  0xfe, 0xd9, 0x6a, 0x70, 0x86, 0x6c, 0xfe, 0x55, 0x11, 0x3e, 0xfe, 0x77,
+  0x26, 0x45, 0xfe, 0x61, 0x11, 0x38, 0xfe, 0xbb, 0x72, 0x7c, 0xfe, 0x85,
+  0x3e, 0x56, 0x8e, 0xbf, 0xfe, 0xce, 0x79, 0x6f, 0xfe, 0xd1, 0x8c, 0x7b,
+  0x99, 0xbc, 0x9d, 0x99, 0xa1, 0x4a, 0x46, 0x9c, 0x9a, 0x96, 0xae, 0xfe,
+  0xcb, 0x88, 0x78, 0xfe, 0xf1, 0xbc, 0x82, 0x9c, 0xab, 0xfe, 0xef, 0xc5,
+  0x96, 0xa4, 0x48, 0x9f, 0x6e, 0xa1, 0x7e, 0xfe, 0x92, 0x32, 0x4a, 0x9c,
+  0x87, 0x93, 0x5e, 0xfe, 0xa2, 0x39, 0x4a, 0xfe, 0xe5, 0x84, 0x73, 0xfe,
+  0xeb, 0x98, 0x7e, 0xa5, 0x92, 0xfe, 0xe3, 0x77, 0x66, 0xfe, 0x9e, 0x37,
+  0x53, 0xfe, 0xa8, 0x3c, 0x4b, 0xfe, 0xb2, 0x4e, 0x6d, 0xfe, 0x80, 0x33,
+  0x66, 0xfe, 0x8e, 0x4d, 0x7c, 0xfe, 0x6e, 0x3c, 0x73, 0xfe, 0x68, 0x2a,
+  0x64, 0xfe, 0x85, 0x56, 0x8f, 0xfe, 0x8f, 0x68, 0x94, 0xfe, 0x57, 0x14,
+  0x40, 0xfe, 0x6b, 0x23, 0x43, 0xfe, 0x52, 0x13, 0x41, 0xfe, 0x81, 0x42,
+  0x67, 0xfe, 0x54, 0x11, 0x3a, 0xfe, 0x72, 0x35, 0x53, 0xfe, 0xe3, 0xaa,
+  0x99, 0xfe, 0xa1, 0x64, 0x69, 0xfe, 0x53, 0x0b, 0x34, 0xaa, 0xd7, 0xfe,
+  0xa2, 0x3c, 0x4d, 0xfe, 0xc9, 0x4c, 0x4f, 0xac, 0xd9, 0xac, 0x28, 0xfe,
+  0xe3, 0x72, 0x72, 0xa5, 0x38, 0xa7, 0x35, 0xa2, 0x45, 0xfe, 0xd9, 0x65,
+  0x69, 0xfe, 0xd0, 0x54, 0x55, 0xfe, 0xbb, 0x43, 0x4f, 0xfe, 0xcf, 0x4b,
+  0x53, 0xfe, 0xe9, 0xa5, 0x99, 0xfe, 0xda, 0x75, 0x76, 0xfe, 0xd8, 0x67,
+  0x6d, 0xfe, 0x82, 0x2d, 0x49, 0xfe, 0x58, 0x18, 0x44, 0xfe, 0x7a, 0x25,
+  0x42, 0x91, 0x7e, 0xfe, 0xa5, 0x60, 0x73, 0x87, 0xba, 0xfe, 0x9d, 0x4c,
+  0x5a, 0xfe, 0xd0, 0x80, 0x73, 0xfe, 0xce, 0x89, 0x7a, 0x9a, 0xbd, 0x4b,
+  0x41, 0x9d, 0x88, 0x41, 0xfe, 0xb7, 0x70, 0x73, 0xfe, 0xe3, 0xa4, 0x7d,
+  0xfe, 0xf1, 0xbb, 0x81, 0xa5, 0x3f, 0xfe, 0xee, 0xc8, 0x9c, 0xa2, 0x6c,
+  0xa2, 0x4a, 0x62, 0xfe, 0x8f, 0x2f, 0x46, 0x75, 0x97, 0x5c, 0xfe, 0xb8,
+  0x53, 0x5f, 0xfe, 0xe5, 0x88, 0x78, 0xfe, 0xea, 0x94, 0x78, 0xaa, 0x54,
+  0xfe, 0xe4, 0x7a, 0x67, 0xfe, 0x99, 0x30, 0x47, 0xac, 0x91, 0xfe, 0xc2,
+  0x5c, 0x72, 0xfe, 0x69, 0x24, 0x5a, 0xac, 0x2a, 0xa4, 0x30, 0xfe, 0x73,
+  0x36, 0x71, 0xfe, 0x85, 0x57, 0x8f, 0xaf, 0x53, 0xfe, 0x6b, 0x2f, 0x5d,
+  0xfe, 0xa9, 0x55, 0x60, 0xfe, 0x52, 0x17, 0x45, 0xfe, 0x78, 0x34, 0x5b,
+  0xfe, 0xb6, 0x73, 0x83, 0xfe, 0xad, 0x58, 0x61, 0xfe, 0xb9, 0x87, 0x86,
+  0xfe, 0x51, 0x0d, 0x3d, 0xfe, 0x68, 0x25, 0x49, 0x93, 0xfd, 0xfe, 0xa9,
+  0x47, 0x57, 0xfe, 0xce, 0x51, 0x57, 0xa7, 0xb5, 0xa8, 0x6a, 0xac, 0x03,
+  0xa6, 0x2a, 0xaa, 0x06, 0xa5, 0x45, 0x99, 0xb9, 0xfe, 0xdd, 0x68, 0x6d,
+  0xfe, 0xe3, 0x7d, 0x7a, 0xfe, 0xe3, 0x97, 0x97, 0xfe, 0xe6, 0xa3, 0x98,
+  0xfe, 0xda, 0x74, 0x78, 0x89, 0xdc, 0xfe, 0x56, 0x16, 0x44, 0xa6, 0xa5,
+  0xfe, 0x83, 0x32, 0x4a, 0xfe, 0x70, 0x1e, 0x3e, 0xfe, 0x92, 0x4b, 0x63,
+  0xa4, 0xe5, 0xfe, 0xbe, 0x69, 0x65, 0xfe, 0xd1, 0x85, 0x74, 0xa2, 0x2c,
+  0x9c, 0xaa, 0x9d, 0x7c, 0x5a, 0x9f, 0x68, 0x9b, 0x9b, 0x98, 0xaa, 0xfe,
+  0xee, 0xb3, 0x7f, 0xaa, 0x13, 0xfe, 0xf1, 0xc9, 0x9b, 0x9f, 0x7b, 0xa3,
+  0x58, 0xa2, 0x4b, 0x9e, 0xaf, 0xfe, 0x89, 0x29, 0x42, 0x9d, 0xb9, 0x9b,
+  0x4a, 0xfe, 0xb6, 0x55, 0x63, 0xfe, 0xe4, 0x88, 0x79, 0xfe, 0xeb, 0x95,
+  0x78, 0xa9, 0x54, 0xfe, 0xe4, 0x7c, 0x66, 0xfe, 0x98, 0x2f, 0x42, 0xb3,
+  0x7d, 0xfe, 0xb8, 0x5d, 0x77, 0xfe, 0x76, 0x2d, 0x65, 0xfe, 0x77, 0x3d,
+  0x6a, 0x8b, 0x9c, 0xa6, 0xda, 0xb0, 0x09, 0xa5, 0x7d, 0xfe, 0x93, 0x5f,
+  0x8c, 0xfe, 0x7e, 0x33, 0x53, 0x95, 0x9c, 0xfe, 0xb8, 0x74, 0x83, 0xfe,
+  0xc5, 0x90, 0x88, 0xfe, 0xaa, 0x5b, 0x64, 0xfe, 0x60, 0x1e, 0x41, 0xfe,
+  0x65, 0x17, 0x3c, 0xab, 0xa0, 0xfe, 0x5f, 0x10, 0x39, 0xfe, 0xa5, 0x4a,
+  0x5b, 0xfe, 0xcb, 0x4d, 0x52, 0xac, 0xb6, 0xa7, 0x68, 0xa9, 0x27, 0x59,
+  0xa9, 0x08, 0xa5, 0x36, 0x9e, 0x58, 0xa5, 0x38, 0xfe, 0xec, 0xb4, 0xa9,
+  0x9c, 0xab, 0xfe, 0xe6, 0xa2, 0x97, 0xfe, 0xd8, 0x6e, 0x75, 0xfe, 0x8b,
+  0x37, 0x52, 0xfe, 0x5a, 0x19, 0x44, 0xa6, 0xc4, 0xfe, 0x88, 0x30, 0x47,
+  0x8d, 0x6f, 0xfe, 0x7d, 0x34, 0x53, 0xfe, 0xad, 0x63, 0x70, 0xfe, 0xd1,
+  0x75, 0x63, 0xfe, 0xcf, 0x87, 0x77, 0x9f, 0x5c, 0x9b, 0xab, 0x9f, 0x6b,
+  0x9d, 0xa8, 0x4f, 0x9a, 0xa7, 0x9e, 0xc9, 0xfe, 0xf2, 0xb9, 0x7d, 0xfe,
+  0xf2, 0xc6, 0x93, 0xa4, 0x4a, 0xa0, 0x6b, 0xa0, 0x6c, 0xa4, 0x3f, 0x9f,
+  0xac, 0xfe, 0x78, 0x1f, 0x3f, 0xa6, 0xa4, 0x9c, 0xe9, 0xfe, 0xb3, 0x52,
+  0x61, 0xfe, 0xe3, 0x8b, 0x7c, 0xfe, 0xeb, 0x99, 0x7e, 0xa7, 0x71, 0xfe,
+  0xe5, 0x7b, 0x65, 0xfe, 0x97, 0x2e, 0x4a, 0xbf, 0x05, 0xa9, 0x79, 0xfe,
+  0x65, 0x24, 0x58, 0xa7, 0x64, 0x9c, 0x5d, 0xbf, 0x19, 0x9b, 0xe7, 0x95,
+  0x7a, 0xfe, 0x87, 0x5c, 0x8d, 0xfe, 0x7c, 0x40, 0x6d, 0xfe, 0xc7, 0x8c,
+  0x9d, 0xfe, 0xd8, 0xaf, 0xa4, 0xfe, 0xa9, 0x4e, 0x5a, 0xfe, 0x78, 0x3f,
+  0x56, 0xfe, 0x71, 0x22, 0x41, 0xfe, 0x5f, 0x12, 0x3a, 0xfe, 0x76, 0x25,
+  0x42, 0xfe, 0x66, 0x12, 0x39, 0xfe, 0x97, 0x41, 0x54, 0xfe, 0xbf, 0x41,
+  0x4a, 0xfe, 0xda, 0x5b, 0x5b, 0xa2, 0x97, 0xaa, 0x2a, 0xa4, 0x54, 0x84,
+  0xaf, 0xa8, 0x55, 0xa6, 0x97, 0x9b, 0x88, 0xfe, 0xd9, 0x59, 0x5a, 0xfe,
+  0xd5, 0x65, 0x68, 0x98, 0x6c, 0xac, 0x19, 0xfe, 0x57, 0x13, 0x41, 0xa8,
+  0x63, 0xfe, 0x6e, 0x24, 0x45, 0xfe, 0x88, 0x33, 0x48, 0xfe, 0x77, 0x21,
+  0x3e, 0xfe, 0x6d, 0x24, 0x4a, 0xfe, 0xc0, 0x72, 0x75, 0xfe, 0xd4, 0x79,
+  0x65, 0xfe, 0xce, 0x8a, 0x7a, 0x9a, 0xbc, 0x9c, 0x7d, 0x4f, 0x60, 0x40,
+  0x9a, 0xab, 0xa3, 0xa1, 0xfe, 0xf3, 0xc0, 0x87, 0xfe, 0xf2, 0xcc, 0xa0,
+  0x9f, 0x95, 0xa0, 0x5b, 0xa2, 0x5f, 0xa4, 0x4b, 0x74, 0xfe, 0x6d, 0x1d,
+  0x40, 0xfe, 0x7b, 0x21, 0x40, 0xa6, 0x86, 0xfe, 0xb7, 0x58, 0x66, 0xfe,
+  0xe5, 0x8c, 0x78, 0xfe, 0xed, 0x9d, 0x7d, 0xa4, 0x73, 0xfe, 0xdd, 0x79,
+  0x76, 0xfe, 0xae, 0x54, 0x6f, 0xfe, 0xa6, 0x40, 0x5d, 0xfe, 0xaa, 0x51,
+  0x71, 0xfe, 0x70, 0x2f, 0x5f, 0x87, 0x77, 0xfe, 0x70, 0x34, 0x6b, 0xfe,
+  0x88, 0x60, 0x92, 0xfe, 0x72, 0x38, 0x75, 0xb6, 0x50, 0x8d, 0x97, 0xfe,
+  0xb5, 0x68, 0x80, 0xfe, 0xde, 0x8b, 0x89, 0xfe, 0xb4, 0x63, 0x67, 0xfe,
+  0xa9, 0x6f, 0x70, 0xfe, 0x5b, 0x15, 0x40, 0xa0, 0xa2, 0xa3, 0xf6, 0xa8,
+  0xa5, 0x9d, 0x6c, 0xfe, 0x88, 0x36, 0x4c, 0xfe, 0xa8, 0x38, 0x48, 0xfe,
+  0xd0, 0x53, 0x53, 0xa4, 0x9b, 0xa9, 0x77, 0xfe, 0xe1, 0x72, 0x6f, 0xfe,
+  0xdf, 0x64, 0x64, 0xfe, 0xd7, 0x4f, 0x57, 0xfe, 0xe1, 0x51, 0x5e, 0xfe,
+  0xe5, 0x6e, 0x7f, 0xfe, 0xe8, 0x83, 0x91, 0x99, 0xcd, 0xfe, 0xdb, 0x72,
+  0x75, 0xfe, 0x8c, 0x37, 0x4f, 0xfe, 0x5d, 0x18, 0x41, 0x9d, 0x97, 0xfe,
+  0x6f, 0x1f, 0x41, 0xfe, 0x8e, 0x36, 0x4b, 0x92, 0x3f, 0xfe, 0x64, 0x18,
+  0x42, 0xfe, 0xd2, 0x84, 0x7c, 0xfe, 0xd3, 0x7e, 0x6d, 0xfe, 0xce, 0x8a,
+  0x78, 0x9c, 0x8e, 0x51, 0x9e, 0x49, 0x43, 0x9e, 0xc8, 0x97, 0x7d, 0xfe,
+  0xca, 0x82, 0x71, 0xfe, 0xf6, 0xcb, 0x99, 0xa3, 0x1c, 0x56, 0xa1, 0x5d,
+  0xa2, 0x7c, 0xa0, 0x75, 0x9d, 0xc5, 0xfe, 0x67, 0x1a, 0x3f, 0xfe, 0x70,
+  0x18, 0x3a, 0xb0, 0xb1, 0xfe, 0xb3, 0x4f, 0x5a, 0xfe, 0xe3, 0x86, 0x76,
+  0xfe, 0xed, 0xa0, 0x7e, 0xa2, 0x97, 0xfe, 0xe1, 0x7e, 0x75, 0xfe, 0x8c,
+  0x24, 0x42, 0xfe, 0xb3, 0x5c, 0x76, 0xfe, 0x86, 0x34, 0x5b, 0xfe, 0x7e,
+  0x46, 0x6e, 0xfe, 0x5e, 0x22, 0x56, 0xa7, 0xbe, 0xfe, 0x93, 0x6d, 0x9e,
+  0x8d, 0xff, 0xfe, 0x73, 0x3e, 0x77, 0xfe, 0x94, 0x65, 0x98, 0xfe, 0xae,
+  0x6d, 0x93, 0xfe, 0xce, 0x83, 0x88, 0xfe, 0xd4, 0x8a, 0x74, 0xfe, 0x57,
+  0x1b, 0x49, 0xfe, 0x65, 0x1f, 0x45, 0x9d, 0x68, 0xa0, 0xb8, 0xa6, 0xc2,
+  0x62, 0xfe, 0x80, 0x33, 0x4b, 0xfe, 0x8a, 0x29, 0x43, 0xfe, 0xbd, 0x45,
+  0x4b, 0xab, 0xa7, 0xac, 0x86, 0xa9, 0x5a, 0xa6, 0x63, 0x93, 0xfa, 0x9b,
+  0xa9, 0xfe, 0xd9, 0x53, 0x5d, 0xa7, 0x4e, 0xfe, 0xdb, 0x6e, 0x77, 0xfe,
+  0xc5, 0x62, 0x64, 0xfe, 0x57, 0x14, 0x40, 0xa4, 0xb5, 0xa6, 0xb1, 0xfe,
+  0x74, 0x21, 0x41, 0xfe, 0x8b, 0x34, 0x4b, 0x98, 0x7a, 0xfe, 0x66, 0x1a,
+  0x44, 0xfe, 0xd7, 0x8b, 0x80, 0x98, 0xa3, 0xfe, 0xcb, 0x8a, 0x79, 0x9e,
+  0x9c, 0x65, 0x9e, 0x4b, 0x07, 0x9c, 0x7b, 0x97, 0xa9, 0xfe, 0xca, 0x85,
+  0x74, 0xfe, 0xf7, 0xd4, 0xa5, 0x9c, 0x78, 0xa2, 0x7f, 0x4a, 0x99, 0xe0,
+  0x9d, 0x99, 0xa1, 0x99, 0xfe, 0x62, 0x17, 0x3e, 0x61, 0xfe, 0x96, 0x3a,
+  0x4d, 0xfe, 0xbb, 0x54, 0x5b, 0xfe, 0xe0, 0x80, 0x70, 0xfe, 0xec, 0x9c,
+  0x7d, 0xa2, 0xa8, 0xfe, 0xe3, 0x7b, 0x6a, 0xfe, 0x92, 0x28, 0x45, 0xfe,
+  0xa9, 0x52, 0x72, 0xfe, 0x7a, 0x33, 0x5f, 0x9b, 0x15, 0xfe, 0x61, 0x27,
+  0x59, 0x90, 0xff, 0xfe, 0x93, 0x70, 0x9e, 0x9c, 0xae, 0xfe, 0x87, 0x56,
+  0x8c, 0xfe, 0x8e, 0x51, 0x80, 0x9e, 0x96, 0xfe, 0xd4, 0x9c, 0x98, 0xfe,
+  0x66, 0x25, 0x48, 0x97, 0x7e, 0xfe, 0x69, 0x1e, 0x42, 0x9d, 0x3a, 0x9e,
+  0xc9, 0xa3, 0x95, 0xa4, 0xd4, 0x45, 0xa5, 0xc4, 0xfe, 0x9a, 0x2e, 0x3f,
+  0xfe, 0xbd, 0x45, 0x4d, 0xb3, 0xc5, 0xad, 0x06, 0xa3, 0x7a, 0xa7, 0x36,
+  0xa7, 0x47, 0xfe, 0xe6, 0x8b, 0x87, 0x98, 0xfa, 0x97, 0xab, 0xfe, 0x80,
+  0x29, 0x45, 0xfe, 0x54, 0x15, 0x42, 0xaa, 0xd1, 0xa1, 0xe3, 0xa4, 0xf7,
+  0xfe, 0x8f, 0x37, 0x4b, 0x96, 0x9b, 0xfe, 0x6b, 0x18, 0x41, 0xfe, 0xd9,
+  0x94, 0x86, 0x8e, 0xb7, 0xa9, 0x07, 0x9d, 0x6e, 0x9e, 0xc9, 0xa0, 0x38,
+  0x9c, 0x7c, 0x9a, 0x8a, 0x93, 0xae, 0xfe, 0xc7, 0x89, 0x79, 0xfe, 0xf7,
+  0xd8, 0xaa, 0x9a, 0xb9, 0x51, 0x42, 0x79, 0x9d, 0xa7, 0x74, 0xfe, 0x5f,
+  0x18, 0x3f, 0x9c, 0x7c, 0xfe, 0x8f, 0x35, 0x49, 0xfe, 0xbf, 0x56, 0x5a,
+  0xfe, 0xe2, 0x81, 0x71, 0xfe, 0xeb, 0x9c, 0x7b, 0xa3, 0x97, 0xfe, 0xe5,
+  0x7c, 0x67, 0xfe, 0x8d, 0x28, 0x44, 0xfe, 0x92, 0x3e, 0x5a, 0xfe, 0x61,
+  0x20, 0x50, 0xb6, 0x41, 0x93, 0xaf, 0x8d, 0x7f, 0xfe, 0x8c, 0x5e, 0x8d,
+  0xfe, 0x6a, 0x32, 0x6b, 0xfe, 0x92, 0x6c, 0xa2, 0x51, 0xfe, 0xa9, 0x5e,
+  0x83, 0xfe, 0x7d, 0x3f, 0x5a, 0xfe, 0x5b, 0x20, 0x4b, 0x9c, 0xe7, 0xfe,
+  0x71, 0x23, 0x45, 0x99, 0x2a, 0x47, 0x9c, 0x99, 0xa7, 0xe2, 0xa1, 0x69,
+  0xa3, 0xa5, 0xfe, 0x74, 0x1e, 0x3d, 0xfe, 0x83, 0x20, 0x39, 0xfe, 0xbb,
+  0x45, 0x4c, 0xb5, 0x98, 0xb0, 0x06, 0xad, 0x14, 0xfe, 0xe5, 0x8c, 0x8a,
+  0xa1, 0x96, 0xa0, 0x59, 0xfe, 0xd2, 0x6f, 0x70, 0xfe, 0x5d, 0x15, 0x41,
+  0xfe, 0x58, 0x21, 0x4c, 0xfe, 0x69, 0x25, 0x48, 0x96, 0xe8, 0xb1, 0xe3,
+  0xfe, 0x8f, 0x3b, 0x4f, 0x95, 0xda, 0xfe, 0x6e, 0x1d, 0x44, 0xfe, 0xda,
+  0x95, 0x8a, 0x8c, 0x78, 0xa7, 0x27, 0x9d, 0x8e, 0xa0, 0x58, 0xa0, 0x95,
+  0x99, 0x7e, 0x9b, 0x8a, 0x93, 0x8c, 0xfe, 0xd2, 0x9d, 0x85, 0xfe, 0xf7,
+  0xd9, 0xa9, 0x95, 0xf5, 0x2e, 0x9c, 0xb8, 0x9a, 0xe5, 0x9a, 0xe6, 0xfe,
+  0xd9, 0x95, 0x75, 0xfe, 0x5f, 0x18, 0x40, 0x99, 0x6b, 0xfe, 0x7b, 0x27,
+  0x41, 0xfe, 0xb2, 0x4b, 0x54, 0xfe, 0xe2, 0x84, 0x73, 0xfe, 0xea, 0x99,
+  0x7c, 0xa3, 0x95, 0xfe, 0xde, 0x73, 0x62, 0xfe, 0xa4, 0x5b, 0x72, 0xa1,
+  0x5d, 0xfe, 0x5d, 0x20, 0x4f, 0xfe, 0x6c, 0x27, 0x53, 0x9e, 0x48, 0xfe,
+  0x4f, 0x10, 0x46, 0xfe, 0x93, 0x71, 0x9f, 0xfe, 0x75, 0x3b, 0x70, 0xae,
+  0x26, 0xfe, 0x84, 0x5b, 0x93, 0xfe, 0xa3, 0x82, 0xaf, 0xfe, 0x9b, 0x6b,
+  0x8d, 0xfe, 0x5e, 0x2a, 0x58, 0xfe, 0x57, 0x1a, 0x47, 0xfe, 0x80, 0x2c,
+  0x46, 0xfe, 0x62, 0x1c, 0x3f, 0x9b, 0x8e, 0xa3, 0xb4, 0x9d, 0x9b, 0xab,
+  0x90, 0x61, 0xfe, 0x83, 0x29, 0x42, 0xa6, 0xd7, 0xb3, 0xd3, 0xb1, 0xb1,
+  0xae, 0x53, 0xae, 0xc8, 0xaf, 0x12, 0xfe, 0xe0, 0x88, 0x85, 0x9b, 0x9b,
+  0xfe, 0xca, 0x7d, 0x7b, 0xfe, 0x63, 0x2e, 0x55, 0x91, 0xac, 0xfe, 0x65,
+  0x22, 0x48, 0x99, 0xb8, 0xfe, 0x7c, 0x2d, 0x4a, 0xfe, 0x90, 0x41, 0x55,
+  0x96, 0xe9, 0xfe, 0x79, 0x25, 0x48, 0xfe, 0xd7, 0x8e, 0x81, 0xfe, 0xaa,
+  0x5a, 0x5d, 0xab, 0x66, 0xfe, 0xb5, 0x70, 0x72, 0xa9, 0x45, 0xa8, 0x36,
+  0x9d, 0x79, 0x99, 0x4b, 0xfe, 0x9f, 0x62, 0x6d, 0xfe, 0xe7, 0xba, 0x94,
+  0xfe, 0xf7, 0xd0, 0x9c, 0x9d, 0x8a, 0x9d, 0xca, 0x97, 0xd8, 0xfe, 0xd0,
+  0x86, 0x6c, 0xfe, 0x71, 0x25, 0x40, 0xfe, 0x5c, 0x11, 0x3b, 0xfe, 0x80,
+  0x38, 0x52, 0xfe, 0x66, 0x1b, 0x40, 0xfe, 0x71, 0x1d, 0x3e, 0xfe, 0x93,
+  0x33, 0x46, 0xfe, 0xe0, 0x7c, 0x6d, 0xfe, 0xe9, 0x95, 0x7c, 0xa3, 0x87,
+  0xfe, 0xe2, 0x8d, 0x85, 0xfe, 0x92, 0x41, 0x56, 0xfe, 0x80, 0x42, 0x62,
+  0xfe, 0x4e, 0x13, 0x42, 0xfe, 0x74, 0x2f, 0x59, 0x96, 0x5c, 0xa5, 0x99,
+  0xfe, 0x78, 0x46, 0x79, 0xb4, 0x34, 0xa1, 0x5d, 0x9a, 0x95, 0xa6, 0xaa,
+  0xfe, 0x84, 0x4e, 0x7d, 0xfe, 0xa7, 0x7b, 0x95, 0xfe, 0x5d, 0x25, 0x50,
+  0xfe, 0x7d, 0x29, 0x47, 0xfe, 0x66, 0x23, 0x47, 0x96, 0xae, 0xa1, 0xb5,
+  0x51, 0xa8, 0x73, 0x9e, 0xc8, 0xfe, 0x78, 0x24, 0x42, 0xfe, 0xbd, 0x4f,
+  0x58, 0xad, 0xd4, 0xa2, 0x59, 0xaa, 0x35, 0xa7, 0x87, 0xa2, 0x47, 0x5e,
+  0xfe, 0xe0, 0x92, 0x86, 0xfe, 0xe8, 0xb7, 0xa1, 0xaf, 0x14, 0xfe, 0xc0,
+  0x97, 0x95, 0xfe, 0x6f, 0x3a, 0x5a, 0xfe, 0x50, 0x11, 0x3c, 0xfe, 0x7d,
+  0x2f, 0x4b, 0xaf, 0x84, 0xfe, 0x8a, 0x33, 0x4b, 0xfe, 0x7e, 0x2e, 0x4f,
+  0xfe, 0xd1, 0x83, 0x78, 0xfe, 0xb8, 0x6a, 0x6a, 0x97, 0xda, 0x97, 0x9f,
+  0x9a, 0x49, 0xa3, 0x57, 0xaa, 0x07, 0xa5, 0x36, 0xfe, 0x99, 0x58, 0x67,
+  0xfe, 0xf3, 0xc4, 0x91, 0xa1, 0xa4, 0xa5, 0x1f, 0x9b, 0xc7, 0xfe, 0xcf,
+  0x87, 0x72, 0xfe, 0x69, 0x1b, 0x3e, 0xa7, 0xa5, 0xfe, 0x92, 0x37, 0x4b,
+  0xfe, 0xa9, 0x79, 0x87, 0xfe, 0x9a, 0x55, 0x67, 0xfe, 0x84, 0x2f, 0x47,
+  0x90, 0xbe, 0xfe, 0xde, 0x76, 0x6a, 0xfe, 0xea, 0x94, 0x7a, 0xa5, 0x58,
+  0xfe, 0xdf, 0x77, 0x66, 0xfe, 0xb2, 0x64, 0x7a, 0xfe, 0x65, 0x28, 0x4c,
+  0xfe, 0x4e, 0x0f, 0x3c, 0xfe, 0x85, 0x4a, 0x78, 0xfe, 0x62, 0x28, 0x5c,
+  0xfe, 0x85, 0x49, 0x75, 0xfe, 0x5b, 0x1f, 0x52, 0xfe, 0x84, 0x4f, 0x7f,
+  0xa4, 0x25, 0xfe, 0x72, 0x40, 0x78, 0xfe, 0x8f, 0x63, 0x96, 0xac, 0x71,
+  0xfe, 0x83, 0x4a, 0x70, 0x5d, 0xfe, 0x6d, 0x1e, 0x42, 0xfe, 0x69, 0x23,
+  0x44, 0xfe, 0x60, 0x19, 0x43, 0xa2, 0x56, 0xa5, 0x65, 0x9e, 0xe8, 0xfe,
+  0x78, 0x28, 0x46, 0x99, 0x4b, 0xfe, 0xb5, 0x4d, 0x56, 0xfe, 0xcb, 0x58,
+  0x5d, 0xa6, 0x39, 0xab, 0x93, 0xa2, 0x88, 0xa1, 0x59, 0xfe, 0xdc, 0x7b,
+  0x77, 0xfe, 0xe2, 0x9b, 0x89, 0xfe, 0xe6, 0xb0, 0x97, 0xa6, 0x57, 0xa9,
+  0x48, 0xae, 0x36, 0xfe, 0x9f, 0x7b, 0x85, 0xfe, 0x66, 0x1b, 0x3f, 0xfe,
+  0x83, 0x37, 0x50, 0xfe, 0x82, 0x2c, 0x45, 0xa8, 0x2f, 0xfe, 0xcf, 0x7f,
+  0x76, 0xfe, 0xc3, 0x7d, 0x77, 0x9a, 0x9c, 0x9a, 0xac, 0x95, 0xbc, 0x91,
+  0xbc, 0x91, 0x5e, 0xfe, 0xaf, 0x5b, 0x5a, 0xfe, 0x91, 0x39, 0x4c, 0xfe,
+  0xf2, 0xc0, 0x8d, 0xaa, 0x29, 0x5b, 0xfe, 0xcc, 0x82, 0x6a, 0xfe, 0x6e,
+  0x1e, 0x3e, 0xfe, 0x89, 0x31, 0x48, 0xaa, 0x93, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01
+};
+const unsigned lenna_qoi_len=sizeof(lenna_qoi);
+const unsigned char nyan_qoi[]={
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20,
+  0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f, 0xfd, 0xfd, 0xf3, 0xfe, 0xff, 0xff,
+  0xff, 0x0c, 0xfd, 0x26, 0x0c, 0xfd, 0xfc, 0x26, 0xc0, 0x0c, 0x26, 0x0c,
+  0x26, 0xc0, 0x0c, 0xdc, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x0c, 0xec, 0x35,
+  0xfe, 0xff, 0xcc, 0x99, 0xcf, 0x35, 0x0c, 0xca, 0x26, 0x0c, 0xdd, 0x35,
+  0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d, 0xc1, 0x35, 0x0c, 0xc9,
+  0x26, 0x0c, 0xc0, 0x26, 0x0c, 0xd3, 0xfe, 0xff, 0x00, 0x00, 0xc5, 0x35,
+  0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x20, 0x28,
+  0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xcc, 0x26, 0x0c, 0xcc, 0x32, 0xcc, 0x35,
+  0x1d, 0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d, 0x35, 0x0c, 0xd8, 0x32, 0xc8,
+  0xfe, 0xff, 0x99, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc8, 0x35, 0xc0, 0x28,
+  0xc0, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0x35, 0xc0, 0x0c, 0xc6, 0x26,
+  0xc0, 0x0c, 0x26, 0x0c, 0x26, 0xc0, 0x0c, 0xc6, 0x32, 0xc1, 0x2f, 0xcc,
+  0x35, 0x1d, 0x28, 0x26, 0x28, 0xc5, 0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0,
+  0x35, 0x28, 0xc2, 0x1d, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd4, 0x2f,
+  0xc8, 0xfe, 0xff, 0xff, 0x00, 0x35, 0xc2, 0x2d, 0xc0, 0x35, 0x26, 0x28,
+  0xc1, 0x26, 0x28, 0xc0, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0xc1, 0x35, 0x28,
+  0xc1, 0x1d, 0x35, 0x2c, 0xc1, 0x35, 0x0c, 0xc8, 0x26, 0x0c, 0xc9, 0x2f,
+  0xc1, 0x2d, 0xc6, 0x35, 0x2c, 0xc0, 0x35, 0xc0, 0x2d, 0x35, 0x1d, 0x28,
+  0xc7, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c, 0xc2, 0x35, 0x0c, 0xc8, 0x26,
+  0x0c, 0xc9, 0x2d, 0xc8, 0xfe, 0x33, 0xff, 0x00, 0x35, 0xc0, 0x2c, 0xc0,
+  0x35, 0xc0, 0x26, 0x1d, 0x28, 0xc1, 0x20, 0x26, 0x28, 0xc2, 0x35, 0x2c,
+  0xca, 0x35, 0x0c, 0xd4, 0x2d, 0xc1, 0x09, 0xc7, 0x35, 0xc0, 0x2c, 0xc0,
+  0x35, 0xc0, 0x1d, 0x28, 0xc5, 0x20, 0x35, 0x2c, 0xc1, 0x26, 0x35, 0x2c,
+  0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x09, 0xc8, 0xfe, 0x00,
+  0x99, 0xff, 0xc1, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x26, 0x28, 0x20, 0x28,
+  0x26, 0x28, 0xc2, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x09, 0xc1, 0x2b, 0xcb, 0x35, 0xc0, 0x1d,
+  0x28, 0x26, 0x28, 0xc1, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0xfe, 0xff, 0x99,
+  0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0x2b, 0xc8, 0xfe,
+  0x66, 0x33, 0xff, 0xc5, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc3, 0x35,
+  0x2c, 0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c,
+  0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0x2b, 0xc1, 0x1f, 0xcc, 0x35, 0x1d, 0xc1,
+  0x28, 0xc5, 0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xd4,
+  0x1f, 0xc8, 0x0c, 0xc4, 0x35, 0xc1, 0x1d, 0xc8, 0x35, 0x2c, 0xc8, 0x35,
+  0x0c, 0xd5, 0x1f, 0xc1, 0x0c, 0xca, 0x35, 0x2c, 0xc1, 0x35, 0xd3, 0x0c,
+  0xe5, 0x35, 0x2c, 0xc0, 0x35, 0xc0, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xc3, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xe6,
+  0x35, 0xc2, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0,
+  0x35, 0xc0, 0x0c, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d,
+  0x8f, 0xfd, 0xfd, 0xf0, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xfb, 0x26, 0x0c,
+  0xc1, 0x26, 0x0c, 0xfd, 0xfa, 0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xdf, 0xfe,
+  0x00, 0x00, 0x00, 0xcf, 0x0c, 0xec, 0x35, 0xfe, 0xff, 0xcc, 0x99, 0xcf,
+  0x35, 0x0c, 0xc5, 0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xde, 0x35, 0x1d, 0xc1,
+  0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d, 0xc1, 0x35, 0x0c, 0xc6, 0x26, 0x0c,
+  0xc0, 0x26, 0x0c, 0xd6, 0xfe, 0xff, 0x00, 0x00, 0xc5, 0x35, 0x1d, 0xc0,
+  0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x20, 0x28, 0xc3, 0x1d,
+  0xc0, 0x35, 0x0c, 0xc7, 0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xcd, 0x32, 0xcc,
+  0x35, 0x1d, 0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d, 0x35, 0x0c, 0xd8, 0x32,
+  0xc8, 0xfe, 0xff, 0x99, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc9, 0x35, 0xc0,
+  0x28, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0xc0, 0x35, 0xc0, 0x0c, 0xc2,
+  0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xc9, 0x32, 0xc1, 0x2f, 0xcc, 0x35, 0x1d,
+  0x28, 0xc8, 0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0xc1, 0x1d,
+  0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2f, 0xc8, 0xfe, 0xff,
+  0xff, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc4, 0x20, 0x28, 0xc1, 0x35, 0x2c,
+  0xc1, 0x35, 0x28, 0xc0, 0x1d, 0x35, 0xc0, 0x2c, 0xc1, 0x35, 0x0c, 0xc2,
+  0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xca, 0x2f, 0xc1, 0x2d, 0xc7, 0x35, 0xc0,
+  0x2d, 0xc1, 0x35, 0x1d, 0x28, 0xc8, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c,
+  0xc2, 0x35, 0x0c, 0xc4, 0x26, 0x0c, 0xcc, 0x2d, 0xc8, 0xfe, 0x33, 0xff,
+  0x00, 0x35, 0x2c, 0xc0, 0x35, 0x09, 0xc0, 0x35, 0x1d, 0x28, 0xc1, 0x20,
+  0x28, 0xc4, 0x35, 0x2c, 0xca, 0x35, 0x0c, 0xd3, 0x2d, 0xc1, 0x09, 0xc6,
+  0x35, 0x2c, 0xc0, 0x35, 0xc2, 0x1d, 0x28, 0xc5, 0x20, 0x28, 0x35, 0x2c,
+  0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd2,
+  0x09, 0xc8, 0xfe, 0x00, 0x99, 0xff, 0xc0, 0x35, 0x2c, 0xc2, 0x35, 0x1d,
+  0x28, 0x20, 0x28, 0xc5, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35,
+  0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd2, 0x09, 0xc1, 0x2b, 0xca, 0x35, 0x26,
+  0x35, 0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xfe, 0xff, 0x99,
+  0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0x2b, 0xc8, 0xfe,
+  0x66, 0x33, 0xff, 0xc4, 0x26, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc4,
+  0x35, 0x2c, 0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35,
+  0x2c, 0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0x2b, 0xc1, 0x1f, 0xc9, 0x26, 0xc0,
+  0x1f, 0x26, 0xc0, 0x1d, 0xc0, 0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc5,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x1f, 0xc8, 0x0c, 0xc4, 0x26, 0x35, 0xc0,
+  0x1d, 0xc9, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xd4, 0x1f, 0xc1, 0x0c, 0xcb,
+  0x26, 0x2c, 0xc0, 0x35, 0xd4, 0x0c, 0xe5, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0xe6, 0x35, 0xc1, 0x0c, 0xc1, 0x35, 0xc1, 0x0c,
+  0xc5, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20,
+  0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x0c, 0xec, 0x35, 0xfe, 0xff,
+  0xcc, 0x99, 0xcf, 0x35, 0x0c, 0xe3, 0xfe, 0xff, 0x00, 0x00, 0xc5, 0x35,
+  0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d, 0xc1, 0x35, 0x0c, 0xdb,
+  0x32, 0xcc, 0x35, 0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28,
+  0xc0, 0x20, 0x28, 0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xd8, 0x32, 0xc8, 0xfe,
+  0xff, 0x99, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d,
+  0x35, 0x0c, 0xd8, 0x32, 0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28, 0xc9, 0x35,
+  0xc0, 0x28, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0xc0, 0x35, 0xc0, 0x0c,
+  0xd4, 0x2f, 0xc8, 0xfe, 0xff, 0xff, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc8,
+  0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0xc1, 0x1d, 0x35, 0x0c,
+  0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2f, 0xc1, 0x2d, 0xcc, 0x35, 0x1d,
+  0x28, 0xc4, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xc1, 0x35, 0x28, 0xc0, 0x1d,
+  0x35, 0xc0, 0x2c, 0xc1, 0x35, 0x0c, 0xd3, 0x2d, 0xc8, 0xfe, 0x33, 0xff,
+  0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc8, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c,
+  0xc2, 0x35, 0x0c, 0xd3, 0x2d, 0xc1, 0x09, 0xcc, 0x35, 0x1d, 0x28, 0xc1,
+  0x20, 0x28, 0xc4, 0x35, 0x2c, 0xca, 0x35, 0x0c, 0xd3, 0x09, 0xc8, 0xfe,
+  0x00, 0x99, 0xff, 0xc1, 0xfe, 0xff, 0xff, 0xff, 0x35, 0xc2, 0x1d, 0x28,
+  0x20, 0x28, 0xc3, 0x20, 0x28, 0x35, 0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3,
+  0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd2, 0x09, 0xc1, 0x2b, 0xc6, 0x35,
+  0xc0, 0x26, 0x2c, 0xc1, 0x35, 0x1d, 0x28, 0xc7, 0x35, 0x2c, 0xc1, 0x35,
+  0xc0, 0x2c, 0xc3, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd2, 0x2b, 0xc8,
+  0xfe, 0x66, 0x33, 0xff, 0x35, 0x2c, 0xc1, 0x35, 0xc1, 0x1d, 0x28, 0xc3,
+  0x20, 0x28, 0xc1, 0x35, 0x2c, 0xfe, 0xff, 0x99, 0x99, 0xc0, 0x2c, 0xc7,
+  0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0x2b, 0xc1, 0x1f, 0xc5, 0x26, 0xc0, 0x35,
+  0x26, 0x35, 0x26, 0xc0, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc4, 0x35,
+  0x2c, 0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c,
+  0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0x1f, 0xc8, 0x0c, 0xc5, 0x35, 0x1d, 0xc1,
+  0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xd3,
+  0x1f, 0xc1, 0x0c, 0xc8, 0x26, 0x0c, 0xc1, 0x35, 0xc0, 0x1d, 0xc9, 0x35,
+  0x2c, 0xc8, 0x35, 0x0c, 0xe1, 0x26, 0x0c, 0xc1, 0x35, 0x2c, 0x35, 0xd4,
+  0x0c, 0xe6, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xe6,
+  0x35, 0xc1, 0x0c, 0xc1, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0,
+  0x35, 0xc1, 0x0c, 0xfd, 0xfd, 0xfd, 0xfb, 0x26, 0x0c, 0xfc, 0x26, 0x0c,
+  0x26, 0x0c, 0xfc, 0x26, 0x0c, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x0c, 0xec, 0x35,
+  0xfe, 0xff, 0xcc, 0x99, 0xcf, 0x35, 0x0c, 0xe3, 0xfe, 0xff, 0x00, 0x00,
+  0xc5, 0x35, 0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d, 0xc1, 0x35,
+  0x0c, 0xdb, 0x32, 0xcc, 0x35, 0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33,
+  0x99, 0x28, 0xc0, 0x20, 0x28, 0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xd8, 0x32,
+  0xc8, 0xfe, 0xff, 0x99, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc0, 0x20, 0x28,
+  0xcc, 0x1d, 0x35, 0x0c, 0xd8, 0x32, 0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28,
+  0xc9, 0x35, 0xc0, 0x28, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0xc0, 0x35,
+  0xc0, 0x0c, 0xd4, 0x2f, 0xc8, 0xfe, 0xff, 0xff, 0x00, 0xc5, 0x35, 0x1d,
+  0x28, 0xc8, 0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0xc1, 0x1d,
+  0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2f, 0xc1, 0x2d, 0xcc,
+  0x35, 0x1d, 0x28, 0xc4, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xc1, 0x35, 0x28,
+  0xc0, 0x1d, 0x35, 0xc0, 0x2c, 0xc1, 0x35, 0x0c, 0xd3, 0x2d, 0xc8, 0xfe,
+  0x33, 0xff, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc8, 0x35, 0x2c, 0xc2, 0x35,
+  0xc2, 0x2c, 0xc2, 0x35, 0x0c, 0xd3, 0x2d, 0xc1, 0x09, 0xcc, 0x35, 0x1d,
+  0x28, 0xc1, 0x20, 0x28, 0xc4, 0x35, 0x2c, 0xca, 0x35, 0x0c, 0xd3, 0x09,
+  0xc7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x99, 0xff, 0xc1, 0x35, 0xc0,
+  0x2c, 0xc0, 0x35, 0x1d, 0x28, 0x20, 0x28, 0xc3, 0x20, 0x28, 0x35, 0x2c,
+  0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd2,
+  0x09, 0xc1, 0x2b, 0xc2, 0x26, 0x2b, 0xc1, 0x26, 0x35, 0x2c, 0xc2, 0x35,
+  0x1d, 0x28, 0xc7, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd2, 0x2b, 0xc8, 0xfe, 0x66, 0x33, 0xff, 0x35,
+  0x2c, 0xc0, 0x35, 0xc2, 0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc1, 0x35, 0x2c,
+  0xfe, 0xff, 0x99, 0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd2,
+  0x2b, 0xc1, 0x1f, 0xc1, 0x26, 0x1f, 0xc2, 0x35, 0x26, 0x2c, 0x35, 0x1f,
+  0xc0, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc4, 0x35, 0x2c, 0x1e, 0xc0,
+  0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0x1e, 0xc0, 0x35,
+  0x0c, 0xd2, 0x1f, 0xc8, 0x0c, 0xc0, 0x35, 0xc0, 0x0c, 0xc1, 0x35, 0x1d,
+  0xc1, 0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c,
+  0xc9, 0x26, 0x0c, 0xc7, 0x1f, 0xc1, 0x0c, 0xc2, 0x26, 0x0c, 0xc1, 0x26,
+  0x0c, 0xc3, 0x35, 0xc0, 0x1d, 0xc9, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xca,
+  0x26, 0x0c, 0xd0, 0x26, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0xd5, 0x0c,
+  0xc8, 0x26, 0xc0, 0x0c, 0x26, 0xc0, 0x0c, 0xd5, 0x35, 0x2c, 0xc0, 0x35,
+  0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xcc, 0x26, 0x0c, 0xd7, 0x35, 0xc1, 0x0c,
+  0xc1, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1, 0x0c,
+  0xcc, 0x26, 0x0c, 0xfd, 0xfd, 0xe8, 0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xfa,
+  0x26, 0xc1, 0x0c, 0x26, 0xc0, 0x0c, 0xfb, 0x26, 0x0c, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xd2, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xfd, 0xfd,
+  0xfd, 0xca, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x0c, 0xec, 0x35, 0xfe, 0xff,
+  0xcc, 0x99, 0xcf, 0x35, 0x0c, 0xe3, 0xfe, 0xff, 0x00, 0x00, 0xc5, 0x35,
+  0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d, 0xc1, 0x35, 0x0c, 0xdb,
+  0x32, 0xcc, 0x35, 0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28,
+  0xc0, 0x20, 0x28, 0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xd8, 0x32, 0xc8, 0xfe,
+  0xff, 0x99, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d,
+  0x35, 0x0c, 0xd8, 0x32, 0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28, 0xc8, 0x35,
+  0xc0, 0x28, 0xc0, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0x35, 0xc0, 0x0c,
+  0xd5, 0x2f, 0xc8, 0xfe, 0xff, 0xff, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc7,
+  0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0xc2, 0x1d, 0x35, 0xc0,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd4, 0x2f, 0xc1, 0x2d, 0xcc, 0x35, 0x1d, 0x28,
+  0xc4, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0xc1, 0x26, 0x28, 0xc1, 0x1d, 0x35,
+  0x2c, 0xc1, 0x35, 0x0c, 0xd4, 0x2d, 0xc8, 0xfe, 0x33, 0xff, 0x00, 0x35,
+  0xc2, 0x09, 0xc0, 0x35, 0x1d, 0x28, 0xc7, 0x35, 0x2c, 0xc2, 0x35, 0xc2,
+  0x2c, 0xc2, 0x35, 0x0c, 0xd4, 0x2d, 0xc1, 0x09, 0xc5, 0x35, 0x2c, 0xc1,
+  0x35, 0xc2, 0x1d, 0x28, 0xc1, 0x20, 0x28, 0xc3, 0x35, 0x2c, 0xca, 0x35,
+  0x0c, 0xd4, 0x09, 0xc8, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0x1d, 0x28, 0x20,
+  0x28, 0xc3, 0x20, 0x35, 0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x09, 0xc1, 0xfe, 0x00, 0x99, 0xff, 0xca,
+  0x35, 0xc1, 0x1d, 0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3,
+  0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2b, 0xc8, 0xfe, 0x66, 0x33,
+  0xff, 0xc5, 0x35, 0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0xfe,
+  0xff, 0x99, 0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0x2b,
+  0xc1, 0x1f, 0xcc, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc3, 0x35, 0x2c,
+  0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0x1e,
+  0xc0, 0x35, 0x0c, 0xc5, 0x26, 0x0c, 0xcb, 0x1f, 0xc8, 0x0c, 0xc4, 0x35,
+  0xc0, 0x1d, 0xc1, 0x28, 0xc5, 0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0,
+  0x35, 0x0c, 0xc6, 0x26, 0x0c, 0xcb, 0x1f, 0xc1, 0x0c, 0xca, 0x35, 0xc2,
+  0x1d, 0xc8, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xe3, 0x35, 0x2c, 0xc1, 0x35,
+  0xd4, 0x0c, 0xc5, 0x26, 0xc0, 0x0c, 0x26, 0x0c, 0x26, 0xc0, 0x0c, 0xd6,
+  0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xc4, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xe6, 0x35, 0xc1,
+  0x0c, 0xc0, 0x26, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0, 0x35,
+  0xc1, 0x0c, 0xca, 0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xdc, 0x26, 0x0c, 0xc1,
+  0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xf7, 0x26, 0x0c, 0xfd,
+  0xc2, 0x26, 0xc0, 0x0c, 0x26, 0x0c, 0x26, 0xc0, 0x0c, 0xfd, 0xe3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d,
+  0x8f, 0xfd, 0xfd, 0xfd, 0xcc, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xfc, 0x26,
+  0x0c, 0x26, 0x0c, 0xfc, 0x26, 0x0c, 0xfd, 0xfd, 0xcc, 0xfe, 0x00, 0x00,
+  0x00, 0xcf, 0x0c, 0xec, 0x35, 0xfe, 0xff, 0xcc, 0x99, 0xcf, 0x35, 0x0c,
+  0xe3, 0xfe, 0xff, 0x00, 0x00, 0xc5, 0x35, 0x1d, 0xc1, 0xfe, 0xff, 0x99,
+  0xff, 0xcb, 0x1d, 0xc1, 0x35, 0x0c, 0xdb, 0x32, 0xcc, 0x35, 0x1d, 0xc0,
+  0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x20, 0x28, 0xc3, 0x1d,
+  0xc0, 0x35, 0x0c, 0xd8, 0x32, 0xc8, 0xfe, 0xff, 0x99, 0x00, 0xc5, 0x35,
+  0x1d, 0x28, 0xc0, 0x20, 0x28, 0xc5, 0x35, 0xc0, 0x28, 0xc3, 0x1d, 0x35,
+  0x0c, 0x35, 0xc0, 0x0c, 0xd5, 0x32, 0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28,
+  0xc7, 0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0x20, 0x28, 0xc0,
+  0x1d, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd4, 0x2f, 0xc8, 0xfe, 0xff,
+  0xff, 0x00, 0xc5, 0x35, 0x1d, 0x28, 0xc7, 0x26, 0x2c, 0xc1, 0x35, 0x28,
+  0xc1, 0x1d, 0x35, 0x2c, 0xc1, 0x35, 0x0c, 0xd4, 0x2f, 0xc1, 0x2d, 0xc7,
+  0x35, 0xc0, 0x2d, 0xc1, 0x35, 0x1d, 0x28, 0xc4, 0x20, 0x28, 0x26, 0x35,
+  0x26, 0x2c, 0xc1, 0x35, 0xc2, 0x2c, 0xc2, 0x35, 0x0c, 0xd4, 0x2d, 0xc8,
+  0xfe, 0x33, 0xff, 0x00, 0x35, 0x2c, 0xc0, 0x35, 0x09, 0xc0, 0x35, 0x1d,
+  0x28, 0xc7, 0x26, 0x2c, 0xca, 0x35, 0x0c, 0xd4, 0x2d, 0xc1, 0x09, 0xc6,
+  0x35, 0x2c, 0xc0, 0x35, 0xc2, 0x1d, 0x28, 0xc1, 0x20, 0x28, 0xc2, 0x35,
+  0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xd3, 0x09, 0xc8, 0xfe, 0x00, 0x99, 0xff, 0xc0, 0x35, 0x2c, 0xc2, 0x35,
+  0x1d, 0x28, 0x20, 0x28, 0xc3, 0x20, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c,
+  0xc3, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x09, 0xc1, 0x2b, 0xca,
+  0x35, 0xc1, 0x1d, 0x28, 0xc6, 0x35, 0x2c, 0xfe, 0xff, 0x99, 0x99, 0xc0,
+  0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0x2b, 0xc8, 0xfe, 0x66, 0x33,
+  0xff, 0xc5, 0x35, 0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0x1e,
+  0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0x1e, 0xc0,
+  0x35, 0x0c, 0xd3, 0x2b, 0xc1, 0x1f, 0xcc, 0x35, 0x1d, 0xc0, 0x28, 0x20,
+  0x28, 0xc4, 0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xc3,
+  0x26, 0x0c, 0xce, 0x1f, 0xc8, 0x0c, 0xc4, 0x35, 0xc0, 0x1d, 0xc1, 0x28,
+  0xc6, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xc2, 0x26, 0x0c, 0xc1, 0x26, 0x0c,
+  0xcc, 0x1f, 0xc1, 0x0c, 0xca, 0x35, 0x2c, 0x35, 0xc0, 0x1d, 0xc9, 0x35,
+  0xc8, 0x0c, 0xe4, 0x35, 0x2c, 0xc1, 0x35, 0xd0, 0x2c, 0x35, 0x0c, 0xc4,
+  0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xd9, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c,
+  0xc0, 0x35, 0x0c, 0xe6, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xc5,
+  0x35, 0xc1, 0x0c, 0xc1, 0x35, 0xc1, 0x0c, 0xc5, 0x26, 0x0c, 0xc1, 0x26,
+  0x0c, 0xfb, 0x26, 0x0c, 0xde, 0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xfb, 0x26,
+  0x0c, 0xc1, 0x26, 0x0c, 0xfd, 0xfa, 0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xfd,
+  0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69,
+  0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe,
+  0x0f, 0x4d, 0x8f, 0xe6, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xfd, 0x26, 0x0c,
+  0xda, 0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xdd, 0x26, 0xc0, 0x0c, 0x26, 0x0c,
+  0x26, 0xc0, 0x0c, 0xd5, 0x26, 0xc0, 0x0c, 0x26, 0xc0, 0x0c, 0xfb, 0x26,
+  0x0c, 0xe0, 0x26, 0x0c, 0xda, 0x26, 0x0c, 0xcb, 0xfe, 0x00, 0x00, 0x00,
+  0xcf, 0x0c, 0xc2, 0x26, 0x0c, 0xe7, 0x35, 0xfe, 0xff, 0xcc, 0x99, 0xcf,
+  0x35, 0x0c, 0xea, 0x35, 0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d,
+  0xc1, 0x35, 0x0c, 0xd8, 0xfe, 0xff, 0x00, 0x00, 0xc1, 0x0c, 0xcc, 0x35,
+  0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x20, 0x28,
+  0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xd8, 0x32, 0xc8, 0x0c, 0xc5, 0x35, 0x1d,
+  0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d, 0x35, 0x0c, 0xd8, 0xfe, 0xff, 0x99,
+  0x00, 0xc1, 0x32, 0xcc, 0x35, 0x1d, 0x28, 0xc8, 0x35, 0xc0, 0x28, 0xc0,
+  0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0x35, 0xc0, 0x0c, 0xd5, 0x2f, 0xc8,
+  0x32, 0xc5, 0x35, 0x1d, 0x28, 0xc2, 0x26, 0x28, 0x26, 0x28, 0xc0, 0x35,
+  0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0xc2, 0x1d, 0x35, 0xc0, 0x2c,
+  0xc0, 0x35, 0x0c, 0xd4, 0xfe, 0xff, 0xff, 0x00, 0xc1, 0x2f, 0xc6, 0x35,
+  0xc2, 0x2f, 0xc0, 0x35, 0x1d, 0x28, 0xc0, 0x26, 0x28, 0xc1, 0x26, 0x28,
+  0xc0, 0x35, 0x2c, 0xc1, 0x35, 0x28, 0xc1, 0x1d, 0x35, 0x2c, 0xc1, 0x35,
+  0x0c, 0xd4, 0x2d, 0xc8, 0x2f, 0x35, 0x2c, 0xc0, 0x35, 0xc0, 0x2f, 0x35,
+  0x1d, 0x28, 0xc2, 0x26, 0xc0, 0x28, 0x26, 0xc0, 0x35, 0x2c, 0xc2, 0x35,
+  0xc2, 0x2c, 0xc2, 0x35, 0x0c, 0xd4, 0xfe, 0x33, 0xff, 0x00, 0xc1, 0x2d,
+  0xc6, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0xc1, 0x1d, 0x28, 0x26, 0x28, 0x20,
+  0x28, 0xc0, 0x26, 0xc0, 0x28, 0x35, 0x2c, 0xca, 0x35, 0x0c, 0xd4, 0x09,
+  0xc8, 0x2d, 0xc0, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0xc0, 0x1d, 0x28, 0xc4,
+  0x26, 0x20, 0x35, 0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c,
+  0xc0, 0x35, 0x0c, 0xd3, 0xfe, 0x00, 0x99, 0xff, 0xc1, 0x09, 0xc8, 0x35,
+  0xc0, 0x2c, 0xc0, 0x35, 0x1d, 0x28, 0x20, 0x26, 0x28, 0xc1, 0x26, 0x28,
+  0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0, 0x2c, 0xc0, 0x35,
+  0x0c, 0xd3, 0x2b, 0xc8, 0x09, 0xc4, 0x35, 0xc0, 0x1d, 0x28, 0xc2, 0x26,
+  0x20, 0x28, 0xc0, 0x35, 0x2c, 0xfe, 0xff, 0x99, 0x99, 0xc0, 0x2c, 0xc7,
+  0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0xfe, 0x66, 0x33, 0xff, 0xc1, 0x2b, 0xcc,
+  0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc3, 0x35, 0x2c, 0x1e, 0xc0, 0x2c,
+  0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0x1e, 0xc0, 0x35, 0x0c,
+  0xd3, 0x1f, 0xc8, 0x2b, 0xc5, 0x35, 0x1d, 0xc1, 0x28, 0xc5, 0x35, 0x2c,
+  0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xd7, 0x1f, 0xcb, 0x35, 0xc1,
+  0x1d, 0xc8, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xdf, 0x1f, 0xc3, 0x35, 0x2c,
+  0xc1, 0x35, 0xd3, 0x0c, 0xe5, 0x35, 0x2c, 0xc0, 0x35, 0xc0, 0x0c, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0xc3, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c,
+  0xc0, 0x35, 0x0c, 0xe6, 0x35, 0xc2, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xc5,
+  0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc0, 0x0c, 0xfd, 0xe6, 0x26, 0x0c, 0xfc,
+  0x26, 0x0c, 0x26, 0x0c, 0xfc, 0x26, 0x0c, 0xfd, 0xfd, 0xfd, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d,
+  0x8f, 0xe3, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xd9, 0x26, 0x0c, 0xda, 0x26,
+  0x0c, 0xc2, 0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xd7, 0x26, 0x0c, 0xfd, 0xda,
+  0x26, 0x0c, 0xc1, 0x26, 0x0c, 0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xd6, 0x26,
+  0x0c, 0x26, 0xc1, 0x0c, 0xfd, 0xd8, 0x26, 0x0c, 0xc2, 0x26, 0x0c, 0xc1,
+  0x26, 0x0c, 0xd7, 0x26, 0x0c, 0xcf, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x0c,
+  0x26, 0x0c, 0xd9, 0x26, 0x0c, 0xce, 0x35, 0xfe, 0xff, 0xcc, 0x99, 0xcf,
+  0x35, 0x0c, 0xea, 0x35, 0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d,
+  0xc1, 0x35, 0x0c, 0xd8, 0xfe, 0xff, 0x00, 0x00, 0xc1, 0x0c, 0xcc, 0x35,
+  0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x20, 0x28,
+  0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xd8, 0x32, 0xc8, 0x0c, 0xc5, 0x35, 0x1d,
+  0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d, 0x35, 0x0c, 0xd8, 0xfe, 0xff, 0x99,
+  0x00, 0xc1, 0x32, 0xcc, 0x35, 0x1d, 0x28, 0xc0, 0x26, 0x28, 0xc6, 0x35,
+  0xc0, 0x28, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c, 0xc0, 0x35, 0xc0, 0x0c,
+  0xd4, 0x2f, 0xc8, 0x32, 0xc5, 0x35, 0x1d, 0x28, 0xc0, 0x26, 0x28, 0xc5,
+  0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28, 0xc1, 0x1d, 0x35, 0x0c,
+  0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0xfe, 0xff, 0xff, 0x00, 0xc1, 0x2f,
+  0xcc, 0x35, 0x1d, 0x28, 0xc4, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xc1, 0x35,
+  0x28, 0xc0, 0x1d, 0x35, 0xc0, 0x2c, 0xc1, 0x35, 0x0c, 0xd3, 0x2d, 0xc8,
+  0x2f, 0xc0, 0x35, 0xc0, 0x2f, 0xc1, 0x35, 0x26, 0xc0, 0x28, 0x26, 0x28,
+  0x26, 0xc0, 0x28, 0xc2, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c, 0xc2, 0x35,
+  0x0c, 0xd3, 0xfe, 0x33, 0xff, 0x00, 0xc1, 0x2d, 0xc6, 0x35, 0x2c, 0xc0,
+  0x35, 0x2d, 0xc0, 0x35, 0x1d, 0x28, 0xc1, 0x20, 0x28, 0xc4, 0x35, 0x2c,
+  0xca, 0x35, 0x0c, 0xd3, 0x09, 0xc8, 0x2d, 0x35, 0x2c, 0xc0, 0x35, 0xc2,
+  0x1d, 0x28, 0xc0, 0x26, 0x28, 0xc2, 0x20, 0x28, 0x35, 0x2c, 0xc1, 0x26,
+  0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd2, 0xfe, 0x00,
+  0x99, 0xff, 0xc1, 0x09, 0xc7, 0x35, 0x2c, 0xc2, 0x35, 0x1d, 0x28, 0x20,
+  0x26, 0x28, 0xc4, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd2, 0x2b, 0xc8, 0x09, 0xc3, 0x35, 0xc1, 0x1d,
+  0x28, 0xc3, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xfe, 0xff, 0x99, 0x99, 0xc0,
+  0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0xfe, 0x66, 0x33, 0xff, 0xc1,
+  0x2b, 0xcc, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc4, 0x35, 0x2c, 0x1e,
+  0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0x1e, 0xc0,
+  0x35, 0x0c, 0xd2, 0x1f, 0xc8, 0x2b, 0xc5, 0x35, 0x1d, 0xc1, 0x28, 0xc6,
+  0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xd6, 0x1f, 0xcc,
+  0x35, 0xc0, 0x1d, 0xc9, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xde, 0x1f, 0xc4,
+  0x35, 0x2c, 0xc0, 0x35, 0xd4, 0x0c, 0xe5, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0xe6, 0x35, 0xc1, 0x0c, 0xc1, 0x35, 0xc1, 0x0c,
+  0xc5, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xdf, 0x26, 0x0c, 0xfd,
+  0x26, 0x0c, 0xfb, 0x26, 0xc0, 0x0c, 0x26, 0xc0, 0x0c, 0xfb, 0x26, 0x0c,
+  0xfd, 0x26, 0x0c, 0xfd, 0xfd, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f, 0xfd, 0xfd, 0xc2, 0xfe,
+  0xff, 0xff, 0xff, 0x0c, 0xfd, 0xfd, 0xc2, 0x26, 0x0c, 0xeb, 0x26, 0x0c,
+  0xfd, 0x26, 0x0c, 0xce, 0x26, 0x0c, 0xfd, 0xd2, 0xfe, 0x00, 0x00, 0x00,
+  0xcf, 0x0c, 0xc5, 0x26, 0xc1, 0x0c, 0x26, 0x0c, 0x26, 0xc0, 0x0c, 0xdd,
+  0x35, 0xfe, 0xff, 0xcc, 0x99, 0xcf, 0x35, 0x0c, 0xd9, 0xfe, 0xff, 0x00,
+  0x00, 0xc1, 0x0c, 0xcc, 0x35, 0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb,
+  0x1d, 0xc1, 0x35, 0x0c, 0xc7, 0x26, 0x0c, 0xce, 0x32, 0xc8, 0x0c, 0xc5,
+  0x35, 0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x20,
+  0x28, 0xc3, 0x1d, 0xc0, 0x35, 0x0c, 0xc7, 0x26, 0x0c, 0xce, 0xfe, 0xff,
+  0x99, 0x00, 0xc1, 0x32, 0xcc, 0x35, 0x26, 0x28, 0xc0, 0x20, 0x28, 0xcc,
+  0x1d, 0x35, 0x0c, 0xd8, 0x2f, 0xc8, 0x32, 0xc4, 0x26, 0x35, 0x1d, 0x28,
+  0x26, 0x28, 0xc7, 0x35, 0xc0, 0x28, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0x0c,
+  0xc0, 0x35, 0xc0, 0x0c, 0xd4, 0xfe, 0xff, 0xff, 0x00, 0xc1, 0x2f, 0xcc,
+  0x35, 0x1d, 0x28, 0xc8, 0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35, 0x28,
+  0xc1, 0x1d, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2d, 0xc8,
+  0x2f, 0xc3, 0x26, 0x2f, 0x35, 0x1d, 0x28, 0xc0, 0x26, 0x28, 0xc1, 0x20,
+  0x28, 0xc1, 0x35, 0x2c, 0xc1, 0x35, 0x28, 0xc0, 0x1d, 0x35, 0xc0, 0x2c,
+  0xc1, 0x35, 0x0c, 0xd3, 0xfe, 0x33, 0xff, 0x00, 0xc1, 0x2d, 0xcc, 0x35,
+  0x1d, 0x28, 0xc8, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c, 0xc2, 0x35, 0x0c,
+  0xd3, 0x09, 0xc8, 0x2d, 0xc4, 0x26, 0x35, 0x1d, 0x28, 0x26, 0x28, 0x20,
+  0x28, 0xc4, 0x35, 0x2c, 0xca, 0x35, 0x0c, 0xd3, 0xfe, 0x00, 0x99, 0xff,
+  0xc1, 0x09, 0xc8, 0x35, 0xc3, 0x26, 0x28, 0x20, 0x28, 0xc3, 0x20, 0x28,
+  0x35, 0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35,
+  0x0c, 0xd2, 0x2b, 0xc8, 0x09, 0x35, 0xc0, 0x2c, 0xc2, 0x35, 0x1d, 0x28,
+  0xc7, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0, 0x2c, 0xc0,
+  0x35, 0x0c, 0xd2, 0xfe, 0x66, 0x33, 0xff, 0xc1, 0x2b, 0xc6, 0x35, 0x2c,
+  0xc1, 0x35, 0xc1, 0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xfe,
+  0xff, 0x99, 0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0x1f,
+  0xc8, 0x2b, 0xc0, 0x35, 0xc2, 0x2b, 0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28,
+  0xc4, 0x35, 0x2c, 0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0,
+  0x35, 0x2c, 0x1e, 0xc0, 0x35, 0x0c, 0xd5, 0x1f, 0xcc, 0x35, 0x1d, 0xc1,
+  0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xdd,
+  0x1f, 0xc5, 0x35, 0xc0, 0x1d, 0xc9, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xe5,
+  0x35, 0x2c, 0x35, 0xd4, 0x0c, 0xdb, 0x26, 0x0c, 0xc8, 0x35, 0x2c, 0xc0,
+  0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35,
+  0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xdb, 0x26, 0x0c, 0xc8, 0x35, 0xc1,
+  0x0c, 0xc1, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1,
+  0x0c, 0xfd, 0xd9, 0x26, 0xc0, 0x0c, 0xc0, 0x26, 0x0c, 0x26, 0xc0, 0x0c,
+  0xfd, 0xfc, 0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xfd, 0xf9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f, 0xfd,
+  0xfd, 0xd9, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xfc, 0x26, 0x0c, 0x26, 0x0c,
+  0xfc, 0x26, 0x0c, 0xd1, 0x26, 0x0c, 0xfb, 0x26, 0x0c, 0xc1, 0x26, 0x0c,
+  0xfd, 0xe5, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x0c, 0xc2, 0x26, 0x0c, 0xc3,
+  0x26, 0x0c, 0xe1, 0x35, 0xfe, 0xff, 0xcc, 0x99, 0xca, 0x26, 0x1d, 0xc2,
+  0x35, 0x0c, 0xd9, 0xfe, 0xff, 0x00, 0x00, 0xc1, 0x0c, 0xcc, 0x35, 0x1d,
+  0xc1, 0xfe, 0xff, 0x99, 0xff, 0xc8, 0x26, 0x28, 0xc0, 0x1d, 0xc1, 0x35,
+  0x0c, 0xc1, 0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xd0, 0x32, 0xc8, 0x0c, 0xc5,
+  0x35, 0x1d, 0xc0, 0x28, 0xc4, 0xfe, 0xff, 0x33, 0x99, 0x28, 0xc0, 0x26,
+  0xc0, 0x28, 0x26, 0xc0, 0x28, 0x1d, 0xc0, 0x35, 0x0c, 0xc3, 0x26, 0x0c,
+  0xd2, 0xfe, 0xff, 0x99, 0x00, 0xc1, 0x32, 0xcc, 0x35, 0x1d, 0x28, 0xc0,
+  0x20, 0x28, 0xc7, 0x26, 0x28, 0xc2, 0x1d, 0x35, 0x0c, 0xd8, 0x2f, 0xc8,
+  0x32, 0xc5, 0x35, 0x1d, 0x28, 0xc9, 0x35, 0x26, 0x28, 0x20, 0x28, 0xc0,
+  0x1d, 0x35, 0x0c, 0xc0, 0x35, 0xc0, 0x0c, 0xd4, 0xfe, 0xff, 0xff, 0x00,
+  0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28, 0xc8, 0x35, 0xfe, 0x99, 0x99, 0x99,
+  0xc0, 0x35, 0x28, 0xc1, 0x1d, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xd3, 0x2d, 0xc8, 0x2f, 0xc5, 0x35, 0x1d, 0x28, 0xc4, 0x20, 0x28, 0xc1,
+  0x35, 0x2c, 0xc1, 0x35, 0x28, 0xc0, 0x1d, 0x35, 0xc0, 0x2c, 0xc1, 0x35,
+  0x0c, 0xd3, 0xfe, 0x33, 0xff, 0x00, 0xc1, 0x2d, 0xcc, 0x35, 0x1d, 0x28,
+  0xc8, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c, 0xc2, 0x35, 0x0c, 0xd3, 0x09,
+  0xc8, 0x2d, 0xc5, 0x35, 0x1d, 0x28, 0xc1, 0x20, 0x28, 0xc4, 0x35, 0x2c,
+  0xca, 0x35, 0x0c, 0xd3, 0xfe, 0x00, 0x99, 0xff, 0xc1, 0x09, 0xc8, 0x35,
+  0xc0, 0x2c, 0xc0, 0x35, 0x1d, 0x28, 0x20, 0x28, 0xc3, 0x20, 0x28, 0x35,
+  0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xd2, 0x2b, 0xc8, 0x09, 0xc0, 0x35, 0x2c, 0xc2, 0x35, 0x1d, 0x28, 0xc7,
+  0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0, 0x2c, 0xc0, 0x35,
+  0x0c, 0xd2, 0xfe, 0x66, 0x33, 0xff, 0xc1, 0x2b, 0xc6, 0x35, 0x2c, 0xc0,
+  0x35, 0xc2, 0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc1, 0x35, 0x2c, 0xfe, 0xff,
+  0x99, 0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd2, 0x1f, 0xc8,
+  0x2b, 0x35, 0x2c, 0xc0, 0x35, 0x2b, 0xc0, 0x35, 0x1d, 0xc0, 0x28, 0x20,
+  0x28, 0xc4, 0x35, 0x2c, 0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c,
+  0xc0, 0x35, 0x2c, 0x1e, 0xc0, 0x35, 0x0c, 0xd5, 0x1f, 0xc7, 0x35, 0xc0,
+  0x1f, 0xc1, 0x35, 0x1d, 0xc1, 0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc5,
+  0x2c, 0xc0, 0x35, 0x0c, 0xdd, 0x1f, 0xc5, 0x35, 0xc0, 0x1d, 0xc9, 0x35,
+  0x2c, 0xc8, 0x35, 0x0c, 0xe4, 0x35, 0x2c, 0xc0, 0x35, 0xd5, 0x0c, 0xd6,
+  0x26, 0x0c, 0xcb, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35,
+  0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xd6, 0x26, 0x0c, 0xc1, 0x26, 0x0c, 0xc9, 0x35, 0xc1, 0x0c, 0xc1, 0x35,
+  0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xfd, 0xdd,
+  0x26, 0x0c, 0xd5, 0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xe0, 0x26, 0x0c, 0xc1,
+  0x26, 0x0c, 0xfb, 0x26, 0x0c, 0xd4, 0x26, 0xc1, 0x0c, 0x26, 0x0c, 0x26,
+  0xc0, 0x0c, 0xfd, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20,
+  0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f, 0xfd, 0xd4, 0xfe, 0xff, 0xff, 0xff,
+  0x0c, 0xfd, 0x26, 0x0c, 0xfb, 0x26, 0xc0, 0x0c, 0x26, 0xc0, 0x0c, 0xfb,
+  0x26, 0x0c, 0xfd, 0x26, 0x0c, 0xfd, 0xfd, 0xc0, 0xfe, 0x00, 0x00, 0x00,
+  0xc7, 0x26, 0x35, 0xc5, 0x0c, 0xec, 0x35, 0xfe, 0xff, 0xcc, 0x99, 0xc7,
+  0x26, 0x1d, 0xc5, 0x26, 0x0c, 0xd9, 0xfe, 0xff, 0x00, 0x00, 0xc1, 0x0c,
+  0xcc, 0x35, 0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xcb, 0x1d, 0xc1, 0x35,
+  0x0c, 0xd8, 0x32, 0xc8, 0x0c, 0xc5, 0x35, 0x1d, 0xc0, 0x28, 0xc3, 0x26,
+  0xc0, 0x28, 0x26, 0xfe, 0xff, 0x33, 0x99, 0x26, 0xc0, 0x28, 0xc1, 0x1d,
+  0xc0, 0x35, 0x0c, 0xd8, 0xfe, 0xff, 0x99, 0x00, 0xc1, 0x32, 0xcc, 0x35,
+  0x1d, 0x28, 0xc0, 0x20, 0x28, 0xcc, 0x1d, 0x35, 0x0c, 0xd8, 0x2f, 0xc8,
+  0x32, 0xc5, 0x35, 0x1d, 0x28, 0xc7, 0x26, 0x35, 0xc0, 0x28, 0xc0, 0x20,
+  0x28, 0xc0, 0x1d, 0x35, 0x0c, 0x35, 0xc0, 0x0c, 0xd5, 0xfe, 0xff, 0xff,
+  0x00, 0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28, 0xc7, 0x26, 0xfe, 0x99, 0x99,
+  0x99, 0xc0, 0x35, 0x28, 0xc2, 0x1d, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c,
+  0xd4, 0x2d, 0xc8, 0x2f, 0xc5, 0x35, 0x1d, 0x28, 0xc4, 0x20, 0x28, 0xc0,
+  0x35, 0x2c, 0xc1, 0x35, 0x28, 0xc1, 0x1d, 0x35, 0x2c, 0xc1, 0x35, 0x0c,
+  0xd4, 0xfe, 0x33, 0xff, 0x00, 0xc1, 0x2d, 0xc6, 0x35, 0xc2, 0x2d, 0xc0,
+  0x35, 0x1d, 0x28, 0xc7, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c, 0xc2, 0x35,
+  0x0c, 0xd4, 0x09, 0xc8, 0x35, 0x2c, 0xc1, 0x35, 0xc2, 0x1d, 0x28, 0xc1,
+  0x20, 0x28, 0xc3, 0x35, 0x2c, 0xca, 0x35, 0x0c, 0xd4, 0xfe, 0x00, 0x99,
+  0xff, 0xc1, 0x09, 0xc5, 0x26, 0x35, 0x2c, 0xc3, 0x35, 0x1d, 0x28, 0x20,
+  0x28, 0xc3, 0x20, 0x35, 0x2c, 0xc1, 0x26, 0x35, 0x2c, 0xc3, 0x26, 0x35,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2b, 0xc8, 0x09, 0xc3, 0x35, 0xc1, 0x1d,
+  0x28, 0xc6, 0x35, 0x2c, 0xc1, 0x35, 0xc0, 0x2c, 0xc3, 0x35, 0xc0, 0x2c,
+  0xc0, 0x35, 0x0c, 0xd3, 0xfe, 0x66, 0x33, 0xff, 0xc1, 0x2b, 0xcc, 0x35,
+  0x1d, 0x28, 0xc3, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0xfe, 0xff, 0x99, 0x99,
+  0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0x1f, 0xc8, 0x2b, 0xc5,
+  0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc3, 0x35, 0x2c, 0x1e, 0xc0, 0x2c,
+  0x35, 0x2c, 0xc0, 0x35, 0x2c, 0xc0, 0x35, 0x2c, 0x1e, 0xc0, 0x35, 0x0c,
+  0xd6, 0x1f, 0xcb, 0x35, 0xc0, 0x1d, 0xc1, 0x28, 0xc5, 0x35, 0x2c, 0xc1,
+  0x35, 0xc5, 0x2c, 0xc0, 0x35, 0x0c, 0xde, 0x1f, 0xc3, 0x35, 0xc2, 0x1d,
+  0xc8, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xe3, 0x35, 0x2c, 0xc1, 0x35, 0xd4,
+  0x0c, 0xe4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c,
+  0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xe6,
+  0x35, 0xc1, 0x0c, 0xc1, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1, 0x0c, 0xc0,
+  0x35, 0xc1, 0x0c, 0xfd, 0xf3, 0x26, 0x0c, 0xfb, 0x26, 0x0c, 0xc1, 0x26,
+  0x0c, 0xfd, 0xfa, 0x26, 0x0c, 0xc3, 0x26, 0x0c, 0xfd, 0xe3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x6f, 0x69, 0x66, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0xfe, 0x0f, 0x4d, 0x8f,
+  0xce, 0xfe, 0xff, 0xff, 0xff, 0x0c, 0xfd, 0x26, 0x0c, 0xfd, 0xfc, 0x26,
+  0xc0, 0x0c, 0x26, 0x0c, 0x26, 0xc0, 0x0c, 0xfd, 0xfc, 0x26, 0x0c, 0xf2,
+  0x26, 0x0c, 0xc8, 0x26, 0x0c, 0xfd, 0xc2, 0xfe, 0x00, 0x00, 0x00, 0xc3,
+  0x26, 0x35, 0xc5, 0x26, 0x35, 0xc1, 0x0c, 0xec, 0x35, 0xfe, 0xff, 0xcc,
+  0x99, 0xc1, 0x26, 0x1d, 0xc1, 0x26, 0x1d, 0xc2, 0x26, 0x1d, 0x26, 0x1d,
+  0xc0, 0x35, 0x0c, 0xd9, 0xfe, 0xff, 0x00, 0x00, 0xc1, 0x0c, 0xcc, 0x35,
+  0x1d, 0xc1, 0xfe, 0xff, 0x99, 0xff, 0xc9, 0x26, 0x28, 0x1d, 0xc1, 0x35,
+  0x0c, 0xd8, 0x32, 0xc8, 0x0c, 0xc5, 0x35, 0x1d, 0xc0, 0x28, 0x26, 0x28,
+  0xc2, 0xfe, 0xff, 0x33, 0x99, 0x26, 0x28, 0x20, 0x28, 0xc3, 0x1d, 0xc0,
+  0x35, 0x0c, 0xd8, 0xfe, 0xff, 0x99, 0x00, 0xc1, 0x32, 0xcc, 0x35, 0x1d,
+  0x28, 0xc0, 0x20, 0x28, 0xc5, 0x35, 0xc0, 0x28, 0xc3, 0x1d, 0x35, 0x0c,
+  0x35, 0xc0, 0x0c, 0xd5, 0x2f, 0xc8, 0x32, 0xc5, 0x35, 0x1d, 0x28, 0xc1,
+  0x26, 0x28, 0xc1, 0x26, 0x28, 0x35, 0xfe, 0x99, 0x99, 0x99, 0xc0, 0x35,
+  0x28, 0x20, 0x28, 0xc0, 0x1d, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd4,
+  0xfe, 0xff, 0xff, 0x00, 0xc1, 0x2f, 0xcc, 0x35, 0x1d, 0x28, 0xc3, 0x26,
+  0x28, 0xc1, 0x35, 0x2c, 0xc1, 0x35, 0x28, 0xc1, 0x1d, 0x35, 0x2c, 0xc1,
+  0x35, 0x0c, 0xd4, 0x2d, 0xc8, 0x2f, 0xc0, 0x35, 0xc0, 0x2f, 0xc1, 0x35,
+  0x1d, 0x28, 0xc4, 0x20, 0x28, 0xc0, 0x35, 0x2c, 0xc2, 0x35, 0xc2, 0x2c,
+  0xc2, 0x35, 0x0c, 0xd4, 0xfe, 0x33, 0xff, 0x00, 0xc1, 0x2d, 0xc6, 0x35,
+  0x2c, 0xc0, 0x35, 0x2d, 0xc0, 0x35, 0x1d, 0x28, 0xc7, 0x35, 0x2c, 0xca,
+  0x35, 0x0c, 0xd4, 0x09, 0xc4, 0x26, 0x09, 0xc1, 0x2d, 0x35, 0x2c, 0xc0,
+  0x35, 0xc2, 0x1d, 0x28, 0xc1, 0x20, 0x28, 0xc2, 0x35, 0x2c, 0xc1, 0x26,
+  0x35, 0x2c, 0xc3, 0x26, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0xfe, 0x00,
+  0x99, 0xff, 0xc1, 0x09, 0xc0, 0x26, 0x09, 0x26, 0x09, 0xc2, 0x35, 0x2c,
+  0xc2, 0x35, 0x1d, 0x28, 0x20, 0x28, 0xc3, 0x20, 0x35, 0x2c, 0xc1, 0x35,
+  0xc0, 0x2c, 0xc3, 0x35, 0xc0, 0x2c, 0xc0, 0x35, 0x0c, 0xd3, 0x2b, 0xc4,
+  0x26, 0x2b, 0xc1, 0x09, 0xc3, 0x35, 0xc1, 0x1d, 0x28, 0xc6, 0x35, 0x2c,
+  0xfe, 0xff, 0x99, 0x99, 0xc0, 0x2c, 0xc7, 0x1e, 0xc0, 0x35, 0x0c, 0xd3,
+  0xfe, 0x66, 0x33, 0xff, 0xc1, 0x2b, 0xcc, 0x35, 0x1d, 0x28, 0xc3, 0x20,
+  0x28, 0xc0, 0x35, 0x2c, 0x1e, 0xc0, 0x2c, 0x35, 0x2c, 0xc0, 0x35, 0x2c,
+  0xc0, 0x35, 0x2c, 0x1e, 0xc0, 0x35, 0x0c, 0xd3, 0x1f, 0xc8, 0x2b, 0xc5,
+  0x35, 0x1d, 0xc0, 0x28, 0x20, 0x28, 0xc4, 0x35, 0x2c, 0xc1, 0x35, 0xc5,
+  0x2c, 0xc0, 0x35, 0x0c, 0xd7, 0x1f, 0xcb, 0x35, 0xc0, 0x1d, 0xc1, 0x28,
+  0xc6, 0x35, 0x2c, 0xc8, 0x35, 0x0c, 0xdf, 0x1f, 0xc3, 0x35, 0x2c, 0x35,
+  0xc0, 0x1d, 0xc9, 0x35, 0xc8, 0x0c, 0xe4, 0x35, 0x2c, 0xc1, 0x35, 0xd0,
+  0x2c, 0x35, 0x0c, 0xe6, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0,
+  0x35, 0x0c, 0xc4, 0x35, 0x2c, 0xc0, 0x35, 0x0c, 0x35, 0x2c, 0xc0, 0x35,
+  0x0c, 0xe6, 0x35, 0xc1, 0x0c, 0xc0, 0x35, 0xc1, 0x0c, 0xc5, 0x35, 0xc1,
+  0x0c, 0xc1, 0x35, 0xc1, 0x0c, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+const unsigned nyan_qoi_len=sizeof(nyan_qoi);
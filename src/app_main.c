@@ -14,7 +14,9 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -22,11 +24,56 @@
 #include "freertos/queue.h"
 
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "anim.h"
 #include "val2pwm.h"
-#include "i2s_parallel.h"
+#include "output.h"
+#include "encoder.h"
+#include "framebuf.h"
+#include "enc_check.h"
+#include "framerec.h"
+#include "tasks.h"
+#include "console.h"
+#include "asset.h"
+#include "gfx.h"
+#include "gif.h"
+#include "qoi.h"
+#include "blockvid.h"
+#include "netrx.h"
+#include "vidfile.h"
+#include "spectrum.h"
+#include "audio_in.h"
+#include "life.h"
+#include "rotozoom.h"
+#include "blur.h"
+#include "chart.h"
+#include "psram.h"
 
-#include "driver/gpio.h"
+//Network pixel receiver (E1.31 / DDP) instead of the demo sequence, build with
+//-DNETRX_SSID=\"ssid\" -DNETRX_PASS=\"password\" and optionally -DNETRX_PROTO=NETRX_DDP
+#ifdef NETRX_SSID
+#include "esp_wifi.h"
+#include "esp_event.h"
+#include "nvs_flash.h"
+#ifndef NETRX_PROTO
+#define NETRX_PROTO NETRX_E131
+#endif
+#endif
+
+//Spectrum bars of the microphone (src/audio_in.h) in the demo sequence, build with -DAUDIO_IN
+//(and -DAUDIO_ADC for an analogue microphone on the ADC)
+#define AUDIO_RATE 16000
+
+//Long video from the filesystem in the demo sequence: raw RGB24 frames of the display size
+//(tools/transcode.c -f raw) at VIDFILE_FPS, e.g. -DVIDFILE_PATH=\"/spiffs/clip.rgb\".
+//A frame recording made with the console command record plays in the demo sequence with
+//e.g. -DREPLAY_PATH=\"/spiffs/demo.frec\". The SPIFFS partition is mounted at /spiffs.
+#include "esp_spiffs.h"
+#ifdef VIDFILE_PATH
+#ifndef VIDFILE_FPS
+#define VIDFILE_FPS 25
+#endif
+#endif
 
 
 
@@ -83,143 +130,358 @@ luminance correction is used. See val2pwm.c for more info.
 Note: Because every subframe contains one bit of grayscale information, they are also referred to as 'bitplanes' by the code below.
 */
 
-// -----------------
-//  LED panel GPIOs
-// -----------------
-// Upper half RGB
-#define GPIO_R1 GPIO_NUM_22
-#define GPIO_G1 GPIO_NUM_21
-#define GPIO_B1 GPIO_NUM_23
-// Lower half RGB
-#define GPIO_R2 GPIO_NUM_18
-#define GPIO_G2 GPIO_NUM_5
-#define GPIO_B2 GPIO_NUM_19
-// Control signals
-#define GPIO_A GPIO_NUM_16
-#define GPIO_B GPIO_NUM_17
-#define GPIO_C GPIO_NUM_2
-#define GPIO_D GPIO_NUM_4
-#define GPIO_E GPIO_NUM_32
-#define GPIO_LAT GPIO_NUM_15
-#define GPIO_OE GPIO_NUM_33
-#define GPIO_CLK GPIO_NUM_13
-
-
-#define DISPLAY_WIDTH  128
-#define DISPLAY_HEIGHT  32
+//Where the bitplanes go (src/output.h): out_i2s drives the panel, out_host simulates one
+#ifndef OUTPUT_BACKEND
+#define OUTPUT_BACKEND out_i2s
+#endif
+//Refresh rate of the simulated panel of out_host
+#define OUTPUT_REFRESH_HZ 100
+
 
 //This is the bit depth, per RGB subpixel, of the data that is sent to the display.
 //The effective bit depth (in computer pixel terms) is less because of the PWM correction. With
 //a bitplane count of 7, you should be able to reproduce an 16-bit image more or less faithfully, though.
 #define BITPLANE_CNT 7
 
+//Number of fine bitplanes, shown with a narrower OE window instead of more slots (see enc_weights_t).
+//Their weights and code table put the lumConvTab brightness curve into the timing.
+//0 = plain binary planes, pixel values are shown linearly. Needs brightness > 2 to make a difference.
+#ifndef BITPLANE_FINE
+#define BITPLANE_FINE 0
+#endif
+
 //64*32 RGB leds, 2 pixels per 16-bit value...
 #define BITPLANE_SZ (DISPLAY_WIDTH * DISPLAY_HEIGHT / 2)
 
+//The nyan cat animation at the start of `anim`
+#define NYAN_FRAMES 12
+#define NYAN_FRAME_SZ (64 * 32 * 3)
+
+//Encoder used by update_frame(), any entry of enc_variants[] which reads FB_LAYOUT
+#if FB_LAYOUT == ENC_FMT_ROWPAIR
+#define ENCODER "rowpair"
+#elif FB_LAYOUT == ENC_FMT_PLANAR
+#define ENCODER "planar"
+#else
+#define ENCODER "runs"
+#endif
+
+//Number of random cases the encoder self-check runs at boot, 0 to skip it
+#define ENC_CHECK_CASES 200
 
-// -------------------------------------------
-//  Meaning of the bits in a 16 bit DMA word
-// -------------------------------------------
-//Upper half RGB
-#define BIT_R1 (1<<0)
-#define BIT_G1 (1<<1)
-#define BIT_B1 (1<<2)
-//Lower half RGB
-#define BIT_R2 (1<<3)
-#define BIT_G2 (1<<4)
-#define BIT_B2 (1<<5)
-// -1 = don't care
-// -1
-#define BIT_A (1<<8)
-#define BIT_B (1<<9)
-#define BIT_C (1<<10)
-#define BIT_D (1<<11)
-#define BIT_LAT (1<<12)
-#define BIT_OE_N (1<<13)
-// -1
-// -1
-
-// 16 bit parallel mode - Save the calculated value to the bitplane memory
-// in reverse order to account for I2S Tx FIFO mode1 ordering
-#define ESP32_TX_FIFO_POSITION_ADJUST(x_coord) (((x_coord)&1U) ? (x_coord - 1) : (x_coord + 1))
 
 //Change to set the global brightness of the display, range 0 .. DISPLAY_WIDTH - 2
 // int brightness=126;
 int brightness=2;
 
 uint16_t *bitplane[2][BITPLANE_CNT];
-uint32_t framebuf[DISPLAY_WIDTH * DISPLAY_HEIGHT];
 
-static uint32_t getPixel(int x, int y)
+static const out_backend_t *out=&OUTPUT_BACKEND;
+
+static const enc_variant_t *encoder=NULL;
+
+#if BITPLANE_FINE > 0
+static enc_weights_t weights;
+static int weights_br;  //brightness the weights were set up for
+#endif
+
+//Low resolution source of the next frame instead of framebuf, see update_frame_lowres()
+static const uint32_t *lowres_src=NULL;
+static unsigned lowres_sx, lowres_sy;
+//1 bit per pixel source of the next frame, see update_frame_mono()
+static const uint32_t *mono_src=NULL;
+static uint32_t mono_on, mono_off;
+//Canvas the next frame is a window of, see update_frame_canvas()
+static const uint32_t *canvas_src=NULL;
+static unsigned canvas_stride;
+static bool canvas_burst=true;
+//Rows of the canvas are copied here in bursts before encoding
+static uint32_t canvas_stage[2 * DISPLAY_WIDTH];
+
+//Scan rows which changed since the last frame, see update_frame_partial()
+static uint32_t frame_dirty=FB_ROWS_ALL;
+
+// Encode task handshake and statistics
+static TaskHandle_t encode_task_h=NULL, render_task_h=NULL;
+static int64_t t_submit, t_wait_max, t_enc_sum, t_enc_max;
+static unsigned n_encoded;
+//Time the last encoder call took, without waiting for vsync
+static int64_t t_encoder;
+
+//Convert framebuf into the DMA backbuffer and flip to it. Runs in the encode task.
+static void encode_frame()
 {
-    return framebuf[(x + y * DISPLAY_WIDTH)];
+    static int backbuf_id=0; //which buffer is the backbuffer, as in, which one is not active so we can write to it
+    static uint32_t prev_dirty=FB_ROWS_ALL;
+    static int prev_br=-1;
+
+    //The backbuffer may only be written once the panel shows the last flip
+    out->wait_vsync();
+
+    enc_cfg_t cfg = {
+        .width = DISPLAY_WIDTH,
+        .rows = DISPLAY_HEIGHT / 2,
+        .n_planes = BITPLANE_CNT,
+        .brightness = brightness,
+    };
+    //The backbuffer holds the frame before the last one, rows which changed in either need encoding.
+    //Brightness changes, low resolution, mono and canvas frames redo both buffers.
+    uint32_t dirty = frame_dirty | prev_dirty;
+    prev_dirty = frame_dirty;
+    if (lowres_src || mono_src || canvas_src || brightness != prev_br)
+        dirty = prev_dirty = FB_ROWS_ALL;
+    prev_br = brightness;
+    cfg.skip = ~dirty & FB_ROWS_ALL;
+#if BITPLANE_FINE > 0
+    //The OE windows of the fine planes follow the brightness, the slots stay the same
+    if (brightness != weights_br) {
+        enc_weights_init(&weights, &cfg, BITPLANE_FINE, lumConvTab);
+        weights_br = brightness;
+    }
+    cfg.code = weights.code;
+    cfg.code_spread = weights.spread;
+#endif
+    int64_t t0 = esp_timer_get_time();
+    if (lowres_src)
+        enc_lowres(bitplane[backbuf_id], lowres_src, lowres_sx, lowres_sy, &cfg);
+    else if (mono_src)
+        enc_mono(bitplane[backbuf_id], mono_src, mono_on, mono_off, &cfg);
+    else if (canvas_src)
+        enc_canvas(bitplane[backbuf_id], canvas_src, canvas_stride, canvas_burst ? canvas_stage : NULL, &cfg);
+    else
+        encoder->fn(bitplane[backbuf_id], framebuf, &cfg);
+    t_encoder = esp_timer_get_time() - t0;
+#if BITPLANE_FINE > 0
+    enc_weights_oe(bitplane[backbuf_id], &cfg, &weights);
+#endif
+
+    //Show our work!
+    out->flip(backbuf_id);
+    backbuf_id ^= 1;
 }
 
-// col is in format: MSB {x, R, G, B} LSB
-static void setPixel(unsigned x, unsigned y, unsigned col)
+static void encode_task(void *arg)
 {
-    framebuf[(x + y * DISPLAY_WIDTH)] = col;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t t0 = esp_timer_get_time();
+        if (t0 - t_submit > t_wait_max)
+            t_wait_max = t0 - t_submit;
+
+        encode_frame();
+
+        int64_t t = esp_timer_get_time() - t0;
+        t_enc_sum += t;
+        if (t > t_enc_max)
+            t_enc_max = t;
+        n_encoded++;
+        xTaskNotifyGive(render_task_h);
+    }
 }
 
-// set all pixels of a layer to a color
-static void setAll(unsigned col)
+//Recording of the frames passed to update_frame(), started and stopped by the console command
+//record. The render task copies each frame into one of REC_BUFS buffers and the writer task
+//appends them to the file, so the file I/O stays off the encode task. A frame is dropped
+//if the writer is still busy with all buffers.
+#define REC_BUFS 2
+
+typedef struct {
+    uint32_t *pix;  //NULL stops the writer
+    int64_t t;
+} rec_frame_t;
+
+static framerec_t rec;
+static FILE *rec_file;
+static QueueHandle_t rec_free_q, rec_full_q;
+static volatile bool rec_on, rec_stop;
+static unsigned rec_dropped;
+
+static void rec_writer_task(void *arg)
 {
-    for (int i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT; i++)
-        framebuf[i] = col;
+    rec_frame_t fr;
+    bool ok=true;
+    while (xQueueReceive(rec_full_q, &fr, portMAX_DELAY) == pdTRUE && fr.pix) {
+        if (ok && framerec_write(&rec, fr.pix, fr.t)) {
+            printf("Recording failed after %u frames\n", rec.n_frames);
+            ok = false;
+        }
+        xQueueSend(rec_free_q, &fr, 0);
+    }
+    printf("Recorded %u frames, %u dropped, %u bytes\n", rec.n_frames, rec_dropped, (unsigned)rec.n_bytes);
+    framerec_close(&rec);
+    fclose(rec_file);
+    //All frames before the stop marker are written, so every buffer is back
+    while (xQueueReceive(rec_free_q, &fr, 0) == pdTRUE)
+        free(fr.pix);
+    rec_on = false;
+    vTaskDelete(NULL);
 }
 
+//Runs in the render task. Low resolution, mono and canvas frames are not recorded, they don't
+//come from framebuf.
+static void rec_frame()
+{
+    if (rec_stop) {
+        rec_frame_t fr={NULL, 0};
+        rec_stop = false;
+        xQueueSend(rec_full_q, &fr, portMAX_DELAY);
+        return;
+    }
+    if (lowres_src || mono_src || canvas_src)
+        return;
+    rec_frame_t fr;
+    if (xQueueReceive(rec_free_q, &fr, 0) != pdTRUE) {
+        rec_dropped++;
+        return;
+    }
+    memcpy(fr.pix, fb_linear(), FB_PIXELS * sizeof(uint32_t));
+    fr.t = esp_timer_get_time();
+    xQueueSend(rec_full_q, &fr, portMAX_DELAY);
+}
+
+static int cmd_record(int argc, char **argv)
+{
+    if (argc > 2)
+        return 1;
+    if (argc == 1) {
+        if (!rec_on)
+            printf("Not recording\n");
+        else
+            rec_stop = true;
+        return 0;
+    }
+    if (rec_on) {
+        printf("Already recording\n");
+        return 0;
+    }
+    if (!rec_free_q) {
+        rec_free_q = xQueueCreate(REC_BUFS, sizeof(rec_frame_t));
+        rec_full_q = xQueueCreate(REC_BUFS + 1, sizeof(rec_frame_t));
+    }
+    for (unsigned i=0; i<REC_BUFS; i++) {
+        rec_frame_t fr={psram_alloc(FB_PIXELS * sizeof(uint32_t), NULL), 0};
+        if (!fr.pix)
+            break;
+        xQueueSend(rec_free_q, &fr, 0);
+    }
+    rec_file = fopen(argv[1], "wb");
+    if (uxQueueMessagesWaiting(rec_free_q) < REC_BUFS || !rec_file || framerec_open_write(&rec, rec_file, DISPLAY_WIDTH, DISPLAY_HEIGHT)) {
+        printf("Can't record to %s\n", argv[1]);
+        rec_frame_t fr;
+        while (xQueueReceive(rec_free_q, &fr, 0) == pdTRUE)
+            free(fr.pix);
+        framerec_close(&rec);
+        if (rec_file)
+            fclose(rec_file);
+        return 0;
+    }
+    rec_dropped = 0;
+    rec_stop = false;
+    tasks_start(TASK_ASSET, rec_writer_task, NULL);
+    rec_on = true;
+    printf("Recording to %s, record to stop\n", argv[1]);
+    return 0;
+}
 
+//Hand framebuf to the encode task and wait until it is safe to draw again
 void update_frame()
 {
-    static int backbuf_id=0; //which buffer is the backbuffer, as in, which one is not active so we can write to it
+    if (rec_on)
+        rec_frame();
+    render_task_h = xTaskGetCurrentTaskHandle();
+    t_submit = esp_timer_get_time();
+    xTaskNotifyGive(encode_task_h);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
 
-    // center the output enable between 2 strobes
-    int br = brightness;
-    if (br > (DISPLAY_WIDTH - 2))
-        br = (DISPLAY_WIDTH - 2);
-
-    int oe_start = (DISPLAY_WIDTH - br) / 2;
-    int oe_stop = (DISPLAY_WIDTH + br) / 2;
-
-    for (int pl=0; pl<BITPLANE_CNT; pl++) {
-        int mask=(1<<(8-BITPLANE_CNT+pl)); //bitmask for pixel data in input for this bitplane
-        uint16_t *p=bitplane[backbuf_id][pl]; //bitplane location to write to
-        for (unsigned int y=0; y<16; y++) {
-            int lbits=0;                //Precalculate line bits of the *previous* line, which is the one we're displaying now
-            if ((y-1)&1) lbits|=BIT_A;
-            if ((y-1)&2) lbits|=BIT_B;
-            if ((y-1)&4) lbits|=BIT_C;
-            if ((y-1)&8) lbits|=BIT_D;
-            for (int x=0; x<DISPLAY_WIDTH; x++) {
-                int x_ = ESP32_TX_FIFO_POSITION_ADJUST(x);
-                int v = lbits;
-
-                // Do not show image while the line bits are changing
-                if (!(x_ >= oe_start && x_ < oe_stop))
-                    v |= BIT_OE_N;
-
-                // latch pulse at the end of shifting in row - data
-                if (x_ == (DISPLAY_WIDTH - 1))
-                    v |= BIT_LAT;
-
-                int c1, c2;
-                c1 = getPixel(x_, y);
-                c2 = getPixel(x_, y + 16);
-                if (c1 & (mask<<16)) v|=BIT_R1;
-                if (c1 & (mask<<8)) v|=BIT_G1;
-                if (c1 & (mask<<0)) v|=BIT_B1;
-                if (c2 & (mask<<16)) v|=BIT_R2;
-                if (c2 & (mask<<8)) v|=BIT_G2;
-                if (c2 & (mask<<0)) v|=BIT_B2;
-
-                //Save the calculated value to the bitplane memory
-                *p++=v;
-            }
-        }
+//Show a linear frame of (DISPLAY_WIDTH / sx) x (DISPLAY_HEIGHT / sy) pixels, pixel doubled
+//by the encoder (sx, sy = 1 or 2). framebuf is not touched.
+void update_frame_lowres(const uint32_t *src, unsigned sx, unsigned sy)
+{
+    lowres_src = src;
+    lowres_sx = sx;
+    lowres_sy = sy;
+    update_frame();
+    lowres_src = NULL;
+}
+
+//Show a 1 bit per pixel bitmap (see enc_mono()), set pixels in colour on, clear ones in off.
+//framebuf is not touched.
+void update_frame_mono(const uint32_t *bits, uint32_t on, uint32_t off)
+{
+    mono_src = bits;
+    mono_on = on;
+    mono_off = off;
+    update_frame();
+    mono_src = NULL;
+}
+
+//Show the display sized window at (x, y) of a canvas, clamped to its edges. framebuf is not touched.
+void update_frame_canvas(const canvas_t *cv, int x, int y)
+{
+    x = x < 0 ? 0 : x > (int)(cv->w - DISPLAY_WIDTH) ? (int)(cv->w - DISPLAY_WIDTH) : x;
+    y = y < 0 ? 0 : y > (int)(cv->h - DISPLAY_HEIGHT) ? (int)(cv->h - DISPLAY_HEIGHT) : y;
+    canvas_src = &cv->pix[x + y * cv->w];
+    canvas_stride = cv->w;
+    update_frame();
+    canvas_src = NULL;
+}
+
+//Like update_frame(), when only the scan rows in dirty (fb_row_mask()) changed since the last
+//frame. The encoder leaves the other rows of the backbuffer as they are.
+void update_frame_partial(uint32_t dirty)
+{
+    frame_dirty = dirty;
+    update_frame();
+    frame_dirty = FB_ROWS_ALL;
+}
+
+static int cmd_pipeline(int argc, char **argv)
+{
+    if (n_encoded)
+        printf(
+            "%u frames, encode mean %lld us, max %lld us, max wait for encode task %lld us\n",
+            n_encoded, (long long)(t_enc_sum / n_encoded), (long long)t_enc_max, (long long)t_wait_max
+        );
+    n_encoded = 0;
+    t_enc_sum = t_enc_max = t_wait_max = 0;
+    return 0;
+}
+
+static int cmd_output(int argc, char **argv)
+{
+    out_print_stats(out);
+    return 0;
+}
+
+static int cmd_flashbench(int argc, char **argv)
+{
+    asset_bench(anim, NYAN_FRAMES * NYAN_FRAME_SZ);
+    return 0;
+}
+
+static int cmd_encoder(int argc, char **argv)
+{
+    if (argc == 2) {
+        const enc_variant_t *e = enc_find(argv[1]);
+        if (!e || e->fmt != FB_LAYOUT)
+            return -1;
+        encoder = e;
     }
-    //Show our work!
-    i2s_parallel_flip_to_buffer(&I2S1, backbuf_id);
-    backbuf_id ^= 1;
+    printf("Encoders:");
+    for (unsigned i = 0; i < enc_variant_cnt; i++)
+        if (enc_variants[i].fmt == FB_LAYOUT)
+            printf(" %s%s", enc_variants[i].name, &enc_variants[i] == encoder ? "*" : "");
+    printf("\n");
+    return 0;
+}
+
+static int cmd_brightness(int argc, char **argv)
+{
+    if (argc != 2)
+        return -1;
+    brightness = atoi(argv[1]);
+    return 0;
 }
 
 void tp_diagonal()
@@ -259,10 +521,12 @@ void tp_stripes_sequence(bool isY)
 
 void tp_nyan(unsigned n_frames)
 {
+    //Frames are streamed from flash into RAM by the asset task, one frame ahead
+    asset_prefetch_start(anim, NYAN_FRAME_SZ, NYAN_FRAMES);
     for (unsigned i=0; i<n_frames; i++) {
         memset(framebuf, 0, sizeof(framebuf));
         //Fill bitplanes with the data for the current image
-        const uint8_t *pix = &anim[(i % 12) * 64 * 32 * 3]; //pixel data for this animation frame
+        const uint8_t *pix = asset_prefetch_get(i); //pixel data for this animation frame
         for (unsigned y=0; y<32; y++) {
             for (unsigned x=0; x<64; x++) {
                 const uint8_t *p = &pix[(x + y * 64) * 3];
@@ -275,73 +539,534 @@ void tp_nyan(unsigned n_frames)
         //Bitplanes are updated, new image shows now.
         vTaskDelay(50 / portTICK_PERIOD_MS); //animation has an 100ms interval
     }
+    asset_prefetch_stop();
 }
 
-void app_main()
+//Two analogue gauges drawn with the anti-aliased vector graphics, needles sweeping
+void tp_gauges(unsigned n_frames)
 {
+    int64_t t_draw=0;
+    for (unsigned i=0; i<n_frames; i++) {
+        int64_t t0=esp_timer_get_time();
+        setAll(0);
+        for (int g=0; g<2; g++) {
+            int32_t cx=GFX_FX(32 + 64 * g), cy=GFX_FX(16);
+            gfx_circle(cx, cy, GFX_FX(14.5), GFX_FX(1), 0x404040);
+            //ticks every 30 degrees
+            for (int k=0; k<12; k++) {
+                float a=k * (float)M_PI / 6;
+                gfx_line(
+                    cx + GFX_FX(11 * cosf(a)), cy + GFX_FX(11 * sinf(a)),
+                    cx + GFX_FX(13.5f * cosf(a)), cy + GFX_FX(13.5f * sinf(a)), 0x808080
+                );
+            }
+            float a=(g ? -1 : 1) * i * 0.05f;
+            float c=cosf(a), s=sinf(a);
+            gfx_pt_t needle[]={
+                {cx + GFX_FX(12 * c), cy + GFX_FX(12 * s)},
+                {cx + GFX_FX(-1.5f * s), cy + GFX_FX(1.5f * c)},
+                {cx + GFX_FX(-3 * c), cy + GFX_FX(-3 * s)},
+                {cx + GFX_FX(1.5f * s), cy + GFX_FX(-1.5f * c)},
+            };
+            gfx_polygon(needle, 4, g ? 0xFF4000 : 0x00C0FF);
+            gfx_circle(cx, cy, GFX_FX(2), 0, 0xFFFFFF);
+        }
+        t_draw += esp_timer_get_time() - t0;
+        update_frame();
+        vTaskDelay(20 / portTICK_PERIOD_MS);
+    }
+    if (n_frames)
+        printf("Gauges: %lld us per frame to draw\n", (long long)(t_draw / n_frames));
+}
 
-    i2s_parallel_buffer_desc_t bufdesc[2][1<<BITPLANE_CNT];
-    i2s_parallel_config_t cfg={
-        // .gpio_bus={2, 15, 4, 16, 27, 17, -1, -1, 5, 18, 19, 21, 26, 25, -1, -1},
-        // .gpio_clk=22,
-
-        // -------------------
-        //  Espirgbani pinout
-        // -------------------
-        .gpio_bus={GPIO_R1, GPIO_G1, GPIO_B1, GPIO_R2, GPIO_G2, GPIO_B2, -1, -1, GPIO_A, GPIO_B, GPIO_C, GPIO_D, GPIO_LAT, GPIO_OE, -1, -1},
-        .gpio_clk=GPIO_CLK,
-
-        .bits=I2S_PARALLEL_BITS_16,
-        // .clk_div=1,     // illegal
-        .clk_div=2,     // = 20 MHz
-        // .clk_div=3,     // = 13.33 MHz
-        // .clk_div=4,     // = 10 MHz
-        // .clk_div=8,     // = 5 MHz
-        // .clk_div=16,     // = 2.5 MHz
-
-        .is_clk_inverted=false,
-        .bufa=bufdesc[0],
-        .bufb=bufdesc[1],
-    };
+//Play a GIF from memory with its own timing, centred, decoded frame by frame into framebuf
+void tp_gif(const uint8_t *data, size_t len, unsigned n_loops)
+{
+    static gif_t gif;   //holds the LZW dictionary, too big for the stack
+    if (gif_open(&gif, data, len)) {
+        printf("GIF: can't open\n");
+        return;
+    }
+    setAll(0);
+    unsigned n_frames=0, delay, delay_sum=0;
+    int64_t t_dec=0, t_dec_max=0;
+    int x0=((int)DISPLAY_WIDTH - (int)gif.width) / 2, y0=((int)DISPLAY_HEIGHT - (int)gif.height) / 2;
+    for (unsigned i=0; i<n_loops; i++) {
+        gif_rewind(&gif);
+        while (1) {
+            int64_t t0=esp_timer_get_time();
+            int ret=gif_next_frame(&gif, x0, y0, &delay);
+            int64_t t=esp_timer_get_time() - t0;
+            if (ret) {
+                if (ret < 0)
+                    printf("GIF: decode error in frame %u\n", gif.n_frames);
+                break;
+            }
+            t_dec += t;
+            if (t > t_dec_max)
+                t_dec_max = t;
+            n_frames++;
+            delay_sum += delay;
+            update_frame();
+            vTaskDelay((delay ? delay : 100) / portTICK_PERIOD_MS);
+        }
+    }
+    if (n_frames)
+        printf(
+            "GIF: %u frames, decode mean %lld us, max %lld us, frame interval %u ms\n",
+            n_frames, (long long)(t_dec / n_frames), (long long)t_dec_max, delay_sum / n_frames
+        );
+    gif_close(&gif);
+}
 
-    for (int i=0; i<BITPLANE_CNT; i++) {
-        for (int j=0; j<2; j++) {
-            bitplane[j][i]=heap_caps_malloc(BITPLANE_SZ*2, MALLOC_CAP_DMA);
-            assert(bitplane[j][i] && "Can't allocate bitplane memory");
+//Show QOI images stored back to back, centred, each for delay_ms
+void tp_qoi(const uint8_t *data, size_t len, unsigned n_loops, unsigned delay_ms)
+{
+    qoi_info_t info;
+    unsigned n_frames=0;
+    int64_t t_dec=0, t_dec_max=0;
+    for (unsigned i=0; i<n_loops; i++) {
+        size_t pos=0;
+        while (pos < len && qoi_info(&info, &data[pos], len - pos) == 0) {
+            int x0=((int)DISPLAY_WIDTH - (int)info.width) / 2, y0=((int)DISPLAY_HEIGHT - (int)info.height) / 2;
+            int64_t t0=esp_timer_get_time();
+            int n=qoi_decode(&data[pos], len - pos, x0, y0);
+            int64_t t=esp_timer_get_time() - t0;
+            if (n < 0) {
+                printf("QOI: decode error at %u\n", (unsigned)pos);
+                return;
+            }
+            pos += n;
+            t_dec += t;
+            if (t > t_dec_max)
+                t_dec_max = t;
+            n_frames++;
+            update_frame();
+            vTaskDelay(delay_ms / portTICK_PERIOD_MS);
         }
     }
+    if (n_frames)
+        printf("QOI: %u frames, decode mean %lld us, max %lld us\n", n_frames, (long long)(t_dec / n_frames), (long long)t_dec_max);
+}
 
-    //Do binary time division setup. Essentially, we need n of plane 0, 2n of plane 1, 4n of plane 2 etc, but that
-    //needs to be divided evenly over time to stop flicker from happening. This little bit of code tries to do that
-    //more-or-less elegantly.
-    int times[BITPLANE_CNT]={0};
-    printf("Bitplane order: ");
-    for (int i=0; i<((1<<BITPLANE_CNT)-1); i++) {
-        int ch=0;
-        //Find plane that needs insertion the most
-        for (int j=0; j<BITPLANE_CNT; j++) {
-            if (times[j]<=times[ch]) ch=j;
+//Play a block video from memory, centred. Only the rows the decoder touched get encoded.
+void tp_blockvid(const uint8_t *data, size_t len, unsigned n_loops)
+{
+    bv_t bv;
+    if (bv_open(&bv, data, len)) {
+        printf("Block video: can't open\n");
+        return;
+    }
+    setAll(0);
+    update_frame();
+    unsigned n_frames=0, n_rows=0, delay;
+    uint32_t dirty;
+    int64_t t_dec=0, t_dec_max=0;
+    int x0=((int)DISPLAY_WIDTH - (int)bv.width) / 2, y0=((int)DISPLAY_HEIGHT - (int)bv.height) / 2;
+    for (unsigned i=0; i<n_loops; i++) {
+        bv_rewind(&bv);
+        while (1) {
+            int64_t t0=esp_timer_get_time();
+            int ret=bv_next_frame(&bv, x0, y0, &delay, &dirty);
+            int64_t t=esp_timer_get_time() - t0;
+            if (ret) {
+                if (ret < 0)
+                    printf("Block video: decode error in frame %u\n", bv.frame);
+                break;
+            }
+            t_dec += t;
+            if (t > t_dec_max)
+                t_dec_max = t;
+            n_frames++;
+            n_rows += __builtin_popcount(dirty);
+            update_frame_partial(dirty);
+            vTaskDelay(delay / portTICK_PERIOD_MS);
         }
-        printf("%d ", ch);
-        //Insert the plane
-        for (int j=0; j<2; j++) {
-            bufdesc[j][i].memory=bitplane[j][ch];
-            bufdesc[j][i].size=BITPLANE_SZ*2;
+    }
+    if (n_frames)
+        printf(
+            "Block video: %u frames, decode mean %lld us, max %lld us, %u of %u rows encoded per frame\n",
+            n_frames, (long long)(t_dec / n_frames), (long long)t_dec_max, n_rows / n_frames, DISPLAY_HEIGHT / 2
+        );
+}
+
+//Nyan cat stretched over the full panel width, encoded straight from the 64x32 frame
+void tp_nyan_wide(unsigned n_frames)
+{
+    uint32_t *frame = malloc(64 * 32 * sizeof(uint32_t));
+    assert(frame && "Can't allocate nyan frame");
+    asset_prefetch_start(anim, NYAN_FRAME_SZ, NYAN_FRAMES);
+    for (unsigned i=0; i<n_frames; i++) {
+        const uint8_t *pix = asset_prefetch_get(i);
+        for (unsigned j=0; j<64 * 32; j++)
+            frame[j] = (pix[3 * j] << 16) | (pix[3 * j + 1] << 8) | pix[3 * j + 2];
+        update_frame_lowres(frame, DISPLAY_WIDTH / 64, DISPLAY_HEIGHT / 32);
+        vTaskDelay(50 / portTICK_PERIOD_MS);
+    }
+    asset_prefetch_stop();
+    free(frame);
+}
+
+//Game of Life, a generation per frame straight from the bit-packed grid. Reseeds when the
+//grid dies down or settles into still lifes and blinkers.
+void tp_life(unsigned n_frames)
+{
+    static life_t life;
+    unsigned quiet=0;
+    int64_t t_step=0, t_step_max=0;
+    life_init(&life, LIFE_B3_S23);
+    life_seed(&life, esp_timer_get_time(), 80);
+    for (unsigned i=0; i<n_frames; i++) {
+        update_frame_mono(life_cells(&life), 0x30FF60, 0x000008);
+        int64_t t0=esp_timer_get_time();
+        unsigned changed=life_step(&life);
+        int64_t t=esp_timer_get_time() - t0;
+        t_step += t;
+        if (t > t_step_max)
+            t_step_max = t;
+        //Period 2 oscillators flip the same cells back and forth forever
+        quiet = changed < 16 || life.generation > 2000 ? quiet + 1 : 0;
+        if (quiet > 50)
+            life_seed(&life, esp_timer_get_time(), 80);
+        vTaskDelay(30 / portTICK_PERIOD_MS);
+    }
+    if (n_frames)
+        printf(
+            "Life: %u generations, step mean %lld us, max %lld us\n",
+            n_frames, (long long)(t_step / n_frames), (long long)t_step_max
+        );
+}
+
+//Nyan cat frames spinning and zooming, tiled over the panel for the first half, then on their
+//own against a border colour. No delay, out->wait_vsync() in the encode task paces it to the refresh rate.
+void tp_rotozoom(unsigned n_frames)
+{
+    rz_tex_t tex={.w = 64, .h = 32, .mode = RZ_WRAP, .border = 0x000010};
+    rz_map_t map;
+    int64_t t_draw=0, t_draw_max=0, t_start=esp_timer_get_time();
+    for (unsigned i=0; i<n_frames; i++) {
+        if (i == n_frames / 2)
+            tex.mode = RZ_BORDER;
+        //The animation runs at 10 frames per second whatever the output's rate, the texture
+        //comes straight from flash
+        tex.pix = anim + (esp_timer_get_time() - t_start) / 100000 % NYAN_FRAMES * NYAN_FRAME_SZ;
+        float a=i * 0.02f;
+        rz_map(&map, RZ_FX(32), RZ_FX(16), a, 1.5f + sinf(a * 1.7f));
+        int64_t t0=esp_timer_get_time();
+        rz_draw(&tex, &map);
+        int64_t t=esp_timer_get_time() - t0;
+        t_draw += t;
+        if (t > t_draw_max)
+            t_draw_max = t;
+        update_frame();
+    }
+    if (n_frames)
+        printf(
+            "Rotozoom: %u frames at %lld fps, draw mean %lld us, max %lld us\n",
+            n_frames, (long long)(n_frames * 1000000LL / (esp_timer_get_time() - t_start)),
+            (long long)(t_draw / n_frames), (long long)t_draw_max
+        );
+}
+
+//A wave drawn with the vector graphics over the nyan cat, on a dark band with a glow behind it
+//to lift it off the busy background
+void tp_glow(unsigned n_frames)
+{
+    int64_t t_glow=0, t_glow_max=0, t_start=esp_timer_get_time();
+    const int y0=10, h=12;
+    for (unsigned i=0; i<n_frames; i++) {
+        //10 frames per second, like tp_rotozoom()
+        const uint8_t *pix=anim + (esp_timer_get_time() - t_start) / 100000 % NYAN_FRAMES * NYAN_FRAME_SZ;
+        for (unsigned y=0; y<DISPLAY_HEIGHT; y++)
+            for (unsigned x=0; x<DISPLAY_WIDTH; x++) {
+                const uint8_t *p=&pix[(x % 64 + y * 64) * 3];
+                setPixel(x, y, (p[0] << 16) | (p[1] << 8) | p[2]);
+            }
+        for (int y=y0; y<y0 + h; y++)
+            for (int x=0; x<DISPLAY_WIDTH; x++)
+                setPixel(x, y, (getPixel(x, y) >> 2) & 0x3F3F3F);
+        for (int x=0; x<DISPLAY_WIDTH; x+=4) {
+            float a=(x + (int)i) * 0.1f, b=(x + 4 + (int)i) * 0.1f;
+            gfx_line(
+                GFX_FX(x), GFX_FX(y0 + h / 2 + 3.5f * sinf(a)),
+                GFX_FX(x + 4), GFX_FX(y0 + h / 2 + 3.5f * sinf(b)), 0xFFFFFF
+            );
         }
-        //Magic to make sure we choose this bitplane an appropriate time later next time
-        times[ch]+=(1<<(BITPLANE_CNT-ch));
+        int64_t t0=esp_timer_get_time();
+        blur_glow(0, y0, DISPLAY_WIDTH, h, 2, 2, 384);
+        int64_t t=esp_timer_get_time() - t0;
+        t_glow += t;
+        if (t > t_glow_max)
+            t_glow_max = t;
+        update_frame();
+        vTaskDelay(20 / portTICK_PERIOD_MS);
     }
-    printf("\n");
+    if (n_frames)
+        printf(
+            "Glow: %u frames, %dx%d, glow mean %lld us, max %lld us\n",
+            n_frames, DISPLAY_WIDTH, h, (long long)(t_glow / n_frames), (long long)t_glow_max
+        );
+}
 
-    //End markers
-    bufdesc[0][((1<<BITPLANE_CNT)-1)].memory=NULL;
-    bufdesc[1][((1<<BITPLANE_CNT)-1)].memory=NULL;
+//Live pipeline metrics as charts. Each frame only the charts which got a sample are scrolled and
+//re-encoded: the encode time every frame, the frame interval every 4th, free heap every 25th.
+void tp_charts(unsigned n_frames)
+{
+    static chart_t enc, interval, heap;
+    setAll(0);
+    //Display rows y and y + 16 share a scan row, the top and bottom charts are on different ones
+    int ret=chart_init(&enc, CHART_LINE, 0, 0, DISPLAY_WIDTH, 8, 1, 0, 2000, 0x40FF40, 0x001000);
+    ret|=chart_init(&interval, CHART_BARS, 0, 24, DISPLAY_WIDTH / 2 - 2, 8, 3, 0, 40000, 0xFFA020, 0x100800);
+    ret|=chart_init(&heap, CHART_LINE, DISPLAY_WIDTH / 2 + 2, 24, DISPLAY_WIDTH / 2 - 2, 8, 2,
+                    0, heap_caps_get_free_size(MALLOC_CAP_INTERNAL), 0x40A0FF, 0x000818);
+    assert(ret == 0 && "Chart doesn't fit");
+    update_frame();
+    unsigned n_rows=0, prev_encoded=n_encoded;
+    int64_t prev_enc_sum=t_enc_sum, t_prev=esp_timer_get_time();
+    for (unsigned i=0; i<n_frames; i++) {
+        //mean encode time of the frames since the last sample
+        unsigned n=n_encoded - prev_encoded;
+        uint32_t dirty=chart_push(&enc, n ? (t_enc_sum - prev_enc_sum) / n : 0);
+        prev_encoded = n_encoded;
+        prev_enc_sum = t_enc_sum;
+        if (i % 4 == 0) {
+            int64_t t=esp_timer_get_time();
+            dirty |= chart_push(&interval, t - t_prev);
+            t_prev = t;
+        }
+        if (i % 25 == 0)
+            dirty |= chart_push(&heap, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+        n_rows += __builtin_popcount(dirty);
+        update_frame_partial(dirty);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+    }
+    if (n_frames)
+        printf("Charts: %u frames, %u of %u rows encoded per frame\n", n_frames, n_rows / n_frames, DISPLAY_HEIGHT / 2);
+}
+
+//Pan around a canvas tiled with nyan cats and compare the encoder reading it from internal RAM
+//and from PSRAM, straight or in row bursts. Internal RAM only has room for a small canvas.
+void tp_canvas(unsigned n_frames)
+{
+    static const struct {
+        bool psram, burst;
+        const char *name;
+    } modes[]={
+        {false, false, "internal, direct"},
+        {false, true, "internal, bursts"},
+        {true, false, "PSRAM, direct"},
+        {true, true, "PSRAM, bursts"},
+    };
+    for (unsigned m=0; m<sizeof(modes) / sizeof(modes[0]); m++) {
+        canvas_t cv;
+        unsigned w=modes[m].psram ? 4 * DISPLAY_WIDTH : DISPLAY_WIDTH + 32;
+        unsigned h=modes[m].psram ? 4 * DISPLAY_HEIGHT : DISPLAY_HEIGHT + 8;
+        if (canvas_init(&cv, w, h, modes[m].psram) || cv.in_psram != modes[m].psram) {
+            printf("Canvas %s: no room for %ux%u\n", modes[m].name, w, h);
+            canvas_free(&cv);
+            continue;
+        }
+        for (unsigned y=0; y<h; y++)
+            for (unsigned x=0; x<w; x++) {
+                const uint8_t *p=anim + (x / 64 + y / 32) % NYAN_FRAMES * NYAN_FRAME_SZ + (x % 64 + y % 32 * 64) * 3;
+                canvas_set(&cv, x, y, (p[0] << 16) | (p[1] << 8) | p[2]);
+            }
+        canvas_burst = modes[m].burst;
+        int64_t t_sum=0, t_max=0;
+        for (unsigned i=0; i<n_frames; i++) {
+            float cx=(w - DISPLAY_WIDTH) / 2.0f, cy=(h - DISPLAY_HEIGHT) / 2.0f;
+            update_frame_canvas(&cv, cx * (1 + sinf(i * 0.013f)), cy * (1 + sinf(i * 0.021f)));
+            t_sum += t_encoder;
+            if (t_encoder > t_max)
+                t_max = t_encoder;
+            vTaskDelay(10 / portTICK_PERIOD_MS);
+        }
+        if (n_frames && t_sum)
+            printf(
+                "Canvas %s, %ux%u: encode mean %lld us, max %lld us, %.2f MB/s of pixels read\n",
+                modes[m].name, w, h, (long long)(t_sum / n_frames), (long long)t_max,
+                (double)FB_PIXELS * sizeof(uint32_t) * n_frames / t_sum
+            );
+        canvas_free(&cv);
+    }
+    canvas_burst = true;
+}
+
+//Play back a recording made with framerec (the console command record or tools/frec.c) with its
+//original timing
+void tp_replay(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        printf("Replay: can't open %s\n", path);
+        return;
+    }
+    framerec_t rec;
+    if (framerec_open_read(&rec, f) || rec.width != DISPLAY_WIDTH || rec.height != DISPLAY_HEIGHT) {
+        printf("Replay: %s is not a %dx%d recording\n", path, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        framerec_close(&rec);
+        fclose(f);
+        return;
+    }
+
+    uint32_t *frame = malloc(FB_PIXELS * sizeof(uint32_t));
+    assert(frame && "Can't allocate replay frame");
+    uint32_t dt;
+    unsigned n_late=0;
+    int64_t t_enc=0, t_enc_max=0;
+    int64_t t_next=esp_timer_get_time();
+    while (framerec_read(&rec, frame, &dt) == 0) {
+        t_next += dt;
+        int64_t wait = t_next - esp_timer_get_time();
+        if (wait < 0) {
+            n_late++;
+        } else {
+            //Sleep most of the way, then spin for the exact timestamp
+            if (wait > 2000)
+                vTaskDelay((wait - 1000) / 1000 / portTICK_PERIOD_MS);
+            while (esp_timer_get_time() < t_next);
+        }
+        int64_t t0 = esp_timer_get_time();
+        fb_load(frame);
+        update_frame();
+        int64_t t = esp_timer_get_time() - t0;
+        t_enc += t;
+        if (t > t_enc_max)
+            t_enc_max = t;
+    }
+    if (rec.n_frames)
+        printf(
+            "Replay: %u frames, %u late, load + update_frame() mean %lld us, max %lld us\n",
+            rec.n_frames, n_late, (long long)(t_enc / rec.n_frames), (long long)t_enc_max
+        );
+    framerec_close(&rec);
+    fclose(f);
+    free(frame);
+}
+
+//Play a raw RGB24 video file of the display size at fps, from any VFS path (SPIFFS, FAT on SD, ..).
+//Chunks are read by the asset task while the previous one is decoded.
+void tp_vidfile(const char *path, unsigned fps)
+{
+    vf_t vf;
+    if (vf_open(&vf, path, FB_PIXELS * 3, 0)) {
+        printf("Video file: can't open %s\n", path);
+        return;
+    }
+    const uint8_t *pix;
+    unsigned n_late=0;
+    int64_t period=1000000 / fps, t_next=esp_timer_get_time();
+    while ((pix = vf_next_frame(&vf))) {
+        for (unsigned i=0; i<FB_PIXELS; i++, pix+=3)
+            setPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH, (pix[0] << 16) | (pix[1] << 8) | pix[2]);
+        update_frame();
+        t_next += period;
+        int64_t wait = t_next - esp_timer_get_time();
+        if (wait < 0)
+            n_late++;
+        else
+            vTaskDelay(wait / 1000 / portTICK_PERIOD_MS);
+    }
+    printf("Video file: %s, %u late frames at %u fps\n", path, n_late, fps);
+    vf_print_stats(&vf);
+    vf_close(&vf);
+}
+
+//Spectrum analyser of the microphone input, paced by the audio clock at SPEC_FPS
+void tp_spectrum(unsigned seconds)
+{
+    static spec_t spec;
+    static int16_t hop[AUDIO_RATE / SPEC_FPS];
+    int ret=spec_init(&spec, AUDIO_RATE, 32, 50, 8000);
+    assert(ret == 0 && "Can't set up the spectrum bands");
+    if (audio_in_start(AUDIO_RATE)) {
+        printf("Spectrum: no audio input\n");
+        return;
+    }
+    unsigned n=seconds * SPEC_FPS, n_an=0;
+    int64_t t_an=0, t_an_max=0;
+    for (unsigned i=0; i<n; i++) {
+        if (audio_in_read(hop, AUDIO_RATE / SPEC_FPS))
+            break;
+        n_an++;
+        int64_t t0=esp_timer_get_time();
+        spec_push(&spec, hop, AUDIO_RATE / SPEC_FPS);
+        spec_analyse(&spec);
+        spec_draw(&spec, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        int64_t t=esp_timer_get_time() - t0;
+        t_an += t;
+        if (t > t_an_max)
+            t_an_max = t;
+        update_frame();
+    }
+    audio_in_stop();
+    if (n_an == 0) {
+        printf("Spectrum: no audio read\n");
+        return;
+    }
+    printf("Spectrum: %u analyses, mean %lld us, max %lld us with drawing\n", n_an, (long long)(t_an / n_an), (long long)t_an_max);
+}
+
+#ifdef NETRX_SSID
+static netrx_t netrx;
+
+static void wifi_event(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+    if (id == WIFI_EVENT_STA_START || id == WIFI_EVENT_STA_DISCONNECTED)
+        esp_wifi_connect();
+}
 
-    //Setup I2S
-    i2s_parallel_setup(&I2S1, &cfg);
+static void wifi_connect()
+{
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        err = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(err);
+    ESP_ERROR_CHECK(esp_netif_init());
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    esp_netif_create_default_wifi_sta();
+    wifi_init_config_t init = WIFI_INIT_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_wifi_init(&init));
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_EVENT, ESP_EVENT_ANY_ID, wifi_event, NULL));
+    wifi_config_t wc = {.sta = {.ssid = NETRX_SSID, .password = NETRX_PASS}};
+    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wc));
+    ESP_ERROR_CHECK(esp_wifi_start());
+    //Power save delays incoming packets by up to a beacon interval
+    esp_wifi_set_ps(WIFI_PS_NONE);
+}
+
+static void netrx_show(void *arg)
+{
+    update_frame();
+}
 
-    printf("I2S setup done.\n");
+static int cmd_netrx(int argc, char **argv)
+{
+    netrx_print_stats(&netrx);
+    return 0;
+}
+
+//Shows whatever arrives over the network, runs as the render task
+static void netrx_task(void *arg)
+{
+    netrx_cfg_t cfg = {.proto = NETRX_PROTO, .universe = 1, .px_per_universe = 170};
+    int ret = netrx_init(&netrx, &cfg);
+    assert(ret == 0 && "Can't set up netrx");
+    wifi_connect();
+    setAll(0);
+    update_frame();
+    if (netrx_run(&netrx, netrx_show, NULL))
+        printf("netrx: can't open the socket\n");
+    vTaskDelete(NULL);
+}
+#endif
 
+//Draws the demo sequence, everything application specific runs in here
+static void render_task(void *arg)
+{
     while(1) {
         printf("All red\n");
         setAll(0xFFFF0000);
@@ -362,8 +1087,101 @@ void app_main()
         tp_stripes_sequence(false);
         tp_stripes_sequence(true);
         tp_nyan(300);
+        tp_nyan_wide(100);
+        tp_life(1000);
+        tp_rotozoom(1000);
+        tp_glow(500);
+        tp_charts(1000);
+        tp_canvas(300);
+        tp_gif(nyan_gif, nyan_gif_len, 10);
+        setAll(0);
+        tp_qoi(lenna_qoi, lenna_qoi_len, 1, 3000);
+        tp_qoi(nyan_qoi, nyan_qoi_len, 10, 100);
+        tp_blockvid(nyan_bv, nyan_bv_len, 10);
+#ifdef VIDFILE_PATH
+        tp_vidfile(VIDFILE_PATH, VIDFILE_FPS);
+#endif
+#ifdef REPLAY_PATH
+        tp_replay(REPLAY_PATH);
+#endif
+        tp_gauges(300);
+#ifdef AUDIO_IN
+        tp_spectrum(20);
+#endif
     }
 }
 
+void app_main()
+{
+
+    //The output may keep referring to the slot lists, they outlive app_main()
+    static out_slot_t bufdesc[2][1<<BITPLANE_CNT];
+
+    for (int i=0; i<BITPLANE_CNT; i++) {
+        for (int j=0; j<2; j++) {
+            bitplane[j][i]=heap_caps_malloc(BITPLANE_SZ*2, MALLOC_CAP_DMA);
+            assert(bitplane[j][i] && "Can't allocate bitplane memory");
+        }
+    }
+
+    //Binary time division: plane n is shown 2^n times, spread evenly over the frame (see enc_schedule())
+    uint8_t order[(1<<BITPLANE_CNT)-1];
+#if BITPLANE_FINE > 0
+    //Fine planes get one slot each, so there are fewer slots than with binary planes
+    enc_cfg_t wcfg={.width=DISPLAY_WIDTH, .rows=DISPLAY_HEIGHT/2, .n_planes=BITPLANE_CNT, .brightness=brightness};
+    enc_weights_init(&weights, &wcfg, BITPLANE_FINE, lumConvTab);
+    weights_br=brightness;
+    int n_slots=enc_schedule_weights(order, &weights);
+#else
+    int n_slots=enc_schedule(order, BITPLANE_CNT);
+#endif
+    printf("Bitplane order: ");
+    for (int i=0; i<n_slots; i++) {
+        printf("%d ", order[i]);
+        for (int j=0; j<2; j++) {
+            bufdesc[j][i].memory=bitplane[j][order[i]];
+            bufdesc[j][i].size=BITPLANE_SZ*2;
+        }
+    }
+    printf("\n");
+
+    //End markers
+    bufdesc[0][n_slots].memory=NULL;
+    bufdesc[1][n_slots].memory=NULL;
 
+    out_cfg_t ocfg={
+        .buf={bufdesc[0], bufdesc[1]},
+        .refresh_hz=OUTPUT_REFRESH_HZ,
+    };
+    int ret=out->setup(&ocfg);
+    assert(ret == 0 && "Can't set up the output");
+    printf("%s output setup done.\n", out->name);
+
+    if (ENC_CHECK_CASES > 0)
+        enc_check_run(ENC_CHECK_CASES, 1);
+
+    encoder = enc_find(ENCODER);
+    assert(encoder && encoder->fmt == FB_LAYOUT && "ENCODER does not match FB_LAYOUT");
+    encode_task_h = tasks_start(TASK_ENCODE, encode_task, NULL);
 
+    console_register("pipeline", "encode time statistics since the last call", cmd_pipeline);
+    console_register("encoder", "encoder [name], list or select the encoder", cmd_encoder);
+    console_register("output", "flips, refreshes and vsync waits since the last call", cmd_output);
+    console_register("flashbench", "asset read throughput from flash", cmd_flashbench);
+    console_register("brightness", "brightness <0 .. DISPLAY_WIDTH - 2>", cmd_brightness);
+    console_register("record", "record [path], record the frames to a file or stop", cmd_record);
+#ifdef NETRX_SSID
+    console_register("netrx", "packet loss and latency statistics since the last call", cmd_netrx);
+#endif
+    console_start();
+
+    esp_vfs_spiffs_conf_t spiffs={.base_path="/spiffs", .max_files=2};
+    if (esp_vfs_spiffs_register(&spiffs) != ESP_OK)
+        printf("Can't mount SPIFFS, no files to play or record to\n");
+
+#ifdef NETRX_SSID
+    tasks_start(TASK_RENDER, netrx_task, NULL);
+#else
+    tasks_start(TASK_RENDER, render_task, NULL);
+#endif
+}
@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_flash.h"
+#include "spi_flash_mmap.h"
+
+#include "tasks.h"
+#include "asset.h"
+#include "psram.h"
+
+// chunk size of the esp_flash_read() benchmark
+#define BENCH_CHUNK 4096
+// size of one random access in the benchmark
+#define BENCH_RANDOM 64
+#define BENCH_RANDOM_CNT 2048
+
+static volatile uint32_t bench_sink;
+
+static void print_rate(const char *name, size_t n_bytes, int64_t t_us)
+{
+    printf("  %-24s %8.2f MB/s\n", name, t_us ? (double)n_bytes / t_us : 0.0);
+}
+
+void asset_bench(const uint8_t *data, size_t len)
+{
+    uint32_t phys = spi_flash_cache2phys(data);
+    uint8_t *buf = heap_caps_malloc(BENCH_CHUNK, MALLOC_CAP_DMA);
+    assert(buf && "Can't allocate benchmark buffer");
+    len &= ~(BENCH_CHUNK - 1);
+    if (len == 0 || phys == SPI_FLASH_CACHE2PHYS_FAIL) {
+        printf("asset_bench: need a memory mapped asset of at least %d bytes\n", BENCH_CHUNK);
+        free(buf);
+        return;
+    }
+    printf("Asset read throughput, %u bytes at flash 0x%x\n", (unsigned)len, (unsigned)phys);
+
+    // Word reads through the flash cache, the way the decoder accesses assets today
+    int64_t t0 = esp_timer_get_time();
+    const uint32_t *p = (const uint32_t *)data;
+    uint32_t sum = 0;
+    for (size_t i = 0; i < len / 4; i++)
+        sum += p[i];
+    print_rate("mmap sequential", len, esp_timer_get_time() - t0);
+
+    t0 = esp_timer_get_time();
+    for (size_t i = 0; i < len; i += BENCH_CHUNK)
+        memcpy(buf, &data[i], BENCH_CHUNK);
+    print_rate("mmap memcpy", len, esp_timer_get_time() - t0);
+
+    uint32_t rnd = 1;
+    t0 = esp_timer_get_time();
+    for (int n = 0; n < BENCH_RANDOM_CNT; n++) {
+        rnd = rnd * 1664525 + 1013904223;
+        memcpy(buf, &data[(rnd >> 8) % (len - BENCH_RANDOM)], BENCH_RANDOM);
+        sum += buf[0];
+    }
+    print_rate("mmap random 64 B", BENCH_RANDOM_CNT * BENCH_RANDOM, esp_timer_get_time() - t0);
+
+    // esp_flash_read() bypasses the cache, the SPI host DMAs straight into RAM
+    t0 = esp_timer_get_time();
+    for (size_t i = 0; i < len; i += BENCH_CHUNK)
+        ESP_ERROR_CHECK(esp_flash_read(NULL, buf, phys + i, BENCH_CHUNK));
+    print_rate("flash_read sequential", len, esp_timer_get_time() - t0);
+
+    rnd = 1;
+    t0 = esp_timer_get_time();
+    for (int n = 0; n < BENCH_RANDOM_CNT; n++) {
+        rnd = rnd * 1664525 + 1013904223;
+        ESP_ERROR_CHECK(esp_flash_read(NULL, buf, phys + (rnd >> 8) % (len - BENCH_RANDOM), BENCH_RANDOM));
+        sum += buf[0];
+    }
+    print_rate("flash_read random 64 B", BENCH_RANDOM_CNT * BENCH_RANDOM, esp_timer_get_time() - t0);
+
+    bench_sink = sum;
+    free(buf);
+}
+
+// -----------
+//  Prefetcher
+// -----------
+static struct {
+    uint32_t phys;          // flash address of the asset
+    size_t frame_sz;
+    unsigned n_frames;
+    uint8_t *buf[2];        // staging buffers
+    int loaded[2];          // frame held by each buffer, -1 = none
+    int cur;                // buffer handed out by the last get()
+    int pending;            // buffer being loaded by the asset task, -1 = none
+    // statistics
+    unsigned n_get, n_stall;
+    size_t n_read;
+    int64_t t_stall, t_read;
+} pf;
+
+typedef struct {
+    int buf;
+    unsigned frame;
+} pf_req_t;
+
+static TaskHandle_t asset_task_h = NULL;
+static QueueHandle_t req_q;
+static SemaphoreHandle_t done_sem;
+
+static void asset_task(void *arg)
+{
+    pf_req_t req;
+    while (1) {
+        xQueueReceive(req_q, &req, portMAX_DELAY);
+        int64_t t0 = esp_timer_get_time();
+        ESP_ERROR_CHECK(esp_flash_read(
+            NULL, pf.buf[req.buf], pf.phys + req.frame * pf.frame_sz, pf.frame_sz
+        ));
+        pf.t_read += esp_timer_get_time() - t0;
+        pf.n_read += pf.frame_sz;
+        xSemaphoreGive(done_sem);
+    }
+}
+
+static void request(int buf, unsigned frame)
+{
+    pf_req_t req = {buf, frame};
+    pf.pending = buf;
+    pf.loaded[buf] = frame;
+    xQueueSend(req_q, &req, portMAX_DELAY);
+}
+
+static void wait_pending(void)
+{
+    if (pf.pending < 0)
+        return;
+    xSemaphoreTake(done_sem, portMAX_DELAY);
+    pf.pending = -1;
+}
+
+void asset_prefetch_start(const uint8_t *data, size_t frame_sz, unsigned n_frames)
+{
+    if (!asset_task_h) {
+        req_q = xQueueCreate(1, sizeof(pf_req_t));
+        done_sem = xSemaphoreCreateBinary();
+        asset_task_h = tasks_start(TASK_ASSET, asset_task, NULL);
+    }
+    memset(&pf, 0, sizeof(pf));
+    pf.phys = spi_flash_cache2phys(data);
+    assert(pf.phys != SPI_FLASH_CACHE2PHYS_FAIL && "Asset is not in memory mapped flash");
+    pf.frame_sz = frame_sz;
+    pf.n_frames = n_frames;
+    for (int i = 0; i < 2; i++) {
+        // Nothing DMAs out of these, keep internal RAM for the bitplanes. esp_flash_read()
+        // goes through a bounce buffer into PSRAM, the read rate below shows what that costs.
+        pf.buf[i] = psram_alloc(frame_sz, NULL);
+        assert(pf.buf[i] && "Can't allocate staging buffer");
+    }
+    pf.cur = 1;
+    pf.loaded[1] = -1;
+    pf.pending = -1;
+    request(0, 0);
+}
+
+const uint8_t *asset_prefetch_get(unsigned frame)
+{
+    frame %= pf.n_frames;
+    pf.n_get++;
+
+    int b = pf.loaded[0] == (int)frame ? 0 : pf.loaded[1] == (int)frame ? 1 : -1;
+    if (b < 0) {
+        // not the frame we guessed, load it into the buffer not handed out
+        wait_pending();
+        b = pf.cur ^ 1;
+        request(b, frame);
+    }
+    if (pf.pending == b) {
+        if (xSemaphoreTake(done_sem, 0) == pdTRUE) {
+            pf.pending = -1;
+        } else {
+            int64_t t0 = esp_timer_get_time();
+            wait_pending();
+            pf.n_stall++;
+            pf.t_stall += esp_timer_get_time() - t0;
+        }
+    }
+
+    // The previous frame is released now, stream the next one into its buffer
+    wait_pending();
+    pf.cur = b;
+    request(b ^ 1, (frame + 1) % pf.n_frames);
+    return pf.buf[b];
+}
+
+void asset_prefetch_stop(void)
+{
+    wait_pending();
+    printf(
+        "Prefetch: %u frames, %u stalls (%lld us), flash read %.2f MB/s\n",
+        pf.n_get, pf.n_stall, (long long)pf.t_stall,
+        pf.t_read ? (double)pf.n_read / pf.t_read : 0.0
+    );
+    for (int i = 0; i < 2; i++)
+        free(pf.buf[i]);
+    memset(&pf, 0, sizeof(pf));
+}
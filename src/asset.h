@@ -0,0 +1,28 @@
+#ifndef ASSET_H
+#define ASSET_H
+
+// Reading animation data from flash.
+//
+// Assets compiled into the firmware (like `anim`) live in memory mapped flash.
+// Reading them directly through the cache stalls the reader on every cache
+// miss. The prefetcher instead copies the next frame into a RAM staging buffer
+// with esp_flash_read(), in the asset task, while the current one is decoded.
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Measure sustained read throughput of the memory mapped asset `data`:
+// through the cache vs. esp_flash_read() into RAM, sequential vs. random
+void asset_bench(const uint8_t *data, size_t len);
+
+// Start prefetching from an asset of n_frames frames of frame_sz bytes each
+void asset_prefetch_start(const uint8_t *data, size_t frame_sz, unsigned n_frames);
+
+// RAM copy of frame `frame`, valid until the next call. Waits if the frame is
+// not loaded yet and queues the following frame for prefetching.
+const uint8_t *asset_prefetch_get(unsigned frame);
+
+// Wait for outstanding reads, free the staging buffers and print statistics
+void asset_prefetch_stop(void);
+
+#endif
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "driver/i2s.h"
+#ifdef AUDIO_ADC
+#include "driver/adc.h"
+#endif
+
+#include "audio_in.h"
+
+// I2S microphone, the L/R select pin to GND for the left channel
+#define GPIO_MIC_BCK 26
+#define GPIO_MIC_WS  25
+#define GPIO_MIC_SD  35
+
+#define AUDIO_I2S I2S_NUM_0
+// samples read from the DMA at a time
+#define CHUNK 128
+
+int audio_in_start(unsigned rate)
+{
+    i2s_config_t cfg = {
+        .sample_rate = rate,
+        .dma_buf_count = 4,
+        .dma_buf_len = 256,
+#ifdef AUDIO_ADC
+        .mode = I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
+        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
+        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
+#else
+        // 24 bit samples, left aligned in 32 bit slots
+        .mode = I2S_MODE_MASTER | I2S_MODE_RX,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
+        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
+        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
+#endif
+    };
+    if (i2s_driver_install(AUDIO_I2S, &cfg, 0, NULL) != ESP_OK)
+        return -1;
+#ifdef AUDIO_ADC
+    if (i2s_set_adc_mode(ADC_UNIT_1, ADC1_CHANNEL_6) != ESP_OK || i2s_adc_enable(AUDIO_I2S) != ESP_OK) {
+        i2s_driver_uninstall(AUDIO_I2S);
+        return -1;
+    }
+#else
+    i2s_pin_config_t pins = {
+        .bck_io_num = GPIO_MIC_BCK,
+        .ws_io_num = GPIO_MIC_WS,
+        .data_out_num = I2S_PIN_NO_CHANGE,
+        .data_in_num = GPIO_MIC_SD,
+    };
+    if (i2s_set_pin(AUDIO_I2S, &pins) != ESP_OK) {
+        i2s_driver_uninstall(AUDIO_I2S);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+int audio_in_read(int16_t *buf, unsigned n)
+{
+#ifdef AUDIO_ADC
+    // 12 bit samples with the channel number in the top 4 bits, centred on 2048
+    uint16_t raw[CHUNK];
+#else
+    int32_t raw[CHUNK];
+#endif
+    while (n) {
+        unsigned k = n < CHUNK ? n : CHUNK;
+        size_t got;
+        if (i2s_read(AUDIO_I2S, raw, k * sizeof(raw[0]), &got, portMAX_DELAY) != ESP_OK)
+            return -1;
+        got /= sizeof(raw[0]);
+        for (size_t i = 0; i < got; i++)
+#ifdef AUDIO_ADC
+            buf[i] = ((int)(raw[i] & 0xFFF) - 2048) << 4;
+#else
+            buf[i] = raw[i] >> 16;
+#endif
+        buf += got;
+        n -= got;
+    }
+    return 0;
+}
+
+void audio_in_stop(void)
+{
+#ifdef AUDIO_ADC
+    i2s_adc_disable(AUDIO_I2S);
+#endif
+    i2s_driver_uninstall(AUDIO_I2S);
+}
@@ -0,0 +1,20 @@
+#ifndef AUDIO_IN_H
+#define AUDIO_IN_H
+
+// Audio input on I2S0 (I2S1 drives the panel): an I2S MEMS microphone like the
+// INMP441, or with AUDIO_ADC the built-in ADC sampled through I2S0 (ADC1 channel
+// 6, GPIO34), e.g. a MAX4466 / MAX9814 electret module. Pins are in audio_in.c.
+// This uses the legacy I2S driver, the only one with the I2S ADC mode. Its
+// deprecation warnings are turned off in sdkconfig.defaults.
+
+#include <stdint.h>
+
+// Start sampling at rate Hz. Returns 0 or -1.
+int audio_in_start(unsigned rate);
+
+// Read n mono samples, waits until they are there. Returns 0 or -1.
+int audio_in_read(int16_t *buf, unsigned n);
+
+void audio_in_stop(void);
+
+#endif
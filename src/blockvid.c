@@ -0,0 +1,180 @@
+#include <stdint.h>
+#include <string.h>
+#include "framebuf.h"
+#include "blockvid.h"
+
+#define OP_SKIP  0x00
+#define OP_SOLID 0x40
+#define OP_COPY  0x80
+#define OP_RAW   0xC0
+#define OP_PAL2  0xC1
+#define OP_PAL4  0xC2
+#define OP_MASK  0xC0
+
+static inline unsigned u16le(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static inline uint32_t rgb(const uint8_t *p)
+{
+    return p[0] << 16 | p[1] << 8 | p[2];
+}
+
+int bv_open(bv_t *v, const uint8_t *data, size_t len)
+{
+    if (len < BV_HEADER_SZ || data[0] != 'B' || data[1] != 'V')
+        return -1;
+    v->block = data[2];
+    v->width = u16le(&data[4]);
+    v->height = u16le(&data[6]);
+    v->n_frames = u16le(&data[8]);
+    if ((v->block != 4 && v->block != 8) || v->width % v->block || v->height % v->block)
+        return -1;
+    v->data = data;
+    v->end = data + len;
+    bv_rewind(v);
+    return 0;
+}
+
+void bv_rewind(bv_t *v)
+{
+    v->p = v->data + BV_HEADER_SZ;
+    v->frame = 0;
+}
+
+static void fill(unsigned x, unsigned y, unsigned bs, uint32_t c)
+{
+    for (unsigned j = 0; j < bs; j++)
+        for (unsigned i = 0; i < bs; i++)
+            setPixel(x + i, y + j, c);
+}
+
+// Copy pixel by pixel, so overlapping sources repeat what was just written
+static void copy(unsigned x, unsigned y, unsigned bs, int dx, int dy, int rev)
+{
+    if (rev) {
+        for (unsigned j = bs; j--;)
+            for (unsigned i = bs; i--;)
+                setPixel(x + i, y + j, getPixel(x + dx + i, y + dy + j));
+    } else {
+        for (unsigned j = 0; j < bs; j++)
+            for (unsigned i = 0; i < bs; i++)
+                setPixel(x + i, y + j, getPixel(x + dx + i, y + dy + j));
+    }
+}
+
+// Palette block: bs * bs indices of `bits` each, MSB first
+static void palette(unsigned x, unsigned y, unsigned bs, const uint32_t *pal, const uint8_t *p, unsigned bits)
+{
+    unsigned acc = 0, n = 0, mask = (1 << bits) - 1;
+    for (unsigned j = 0; j < bs; j++) {
+        for (unsigned i = 0; i < bs; i++) {
+            if (n == 0) {
+                acc = *p++;
+                n = 8;
+            }
+            n -= bits;
+            setPixel(x + i, y + j, pal[(acc >> n) & mask]);
+        }
+    }
+}
+
+int bv_next_frame(bv_t *v, int x0, int y0, unsigned *delay_ms, uint32_t *dirty)
+{
+    if (v->frame >= v->n_frames)
+        return 1;
+    if (x0 < 0 || y0 < 0 || x0 + v->width > DISPLAY_WIDTH || y0 + v->height > DISPLAY_HEIGHT)
+        return -1;
+
+    const uint8_t *p = v->p, *end = v->end;
+    if (p + 2 > end)
+        return -1;
+    unsigned delay = u16le(p) & 0x7FFF;
+    int rev = p[1] >> 7;
+    p += 2;
+
+    unsigned bs = v->block, bw = v->width / bs;
+    unsigned n_blocks = bw * (v->height / bs);
+    uint32_t rows = 0;
+    for (unsigned k = 0; k < n_blocks;) {
+        if (p >= end)
+            return -1;
+        unsigned op = *p++;
+        unsigned n = op < OP_RAW ? (op & 0x3F) + 1 : 1;
+        if (k + n > n_blocks)
+            return -1;
+
+        if ((op & OP_MASK) == OP_SKIP) {
+            k += n;
+            continue;
+        }
+
+        // arguments shared by the blocks of a run
+        uint32_t c = 0;
+        int dx = 0, dy = 0;
+        unsigned n_col = 0, bits = 0;
+        uint32_t pal[4];
+        switch (op & OP_MASK) {
+        case OP_SOLID:
+            if (p + 3 > end)
+                return -1;
+            c = rgb(p);
+            p += 3;
+            break;
+        case OP_COPY:
+            if (p + 2 > end)
+                return -1;
+            dx = (int8_t)p[0];
+            dy = (int8_t)p[1];
+            p += 2;
+            break;
+        default:
+            if (op == OP_PAL2 || op == OP_PAL4) {
+                n_col = op == OP_PAL2 ? 2 : 4;
+                bits = op == OP_PAL2 ? 1 : 2;
+                if (p + 3 * n_col + bs * bs * bits / 8 > end)
+                    return -1;
+                for (unsigned i = 0; i < n_col; i++, p += 3)
+                    pal[i] = rgb(p);
+            } else if (op != OP_RAW || p + 3 * bs * bs > end) {
+                return -1;
+            }
+        }
+
+        for (; n--; k++) {
+            unsigned b = rev ? n_blocks - 1 - k : k;
+            unsigned bx = b % bw * bs, by = b / bw * bs;
+            unsigned x = x0 + bx, y = y0 + by;
+            rows |= fb_row_mask(y, y + bs);
+            switch (op & OP_MASK) {
+            case OP_SOLID:
+                fill(x, y, bs, c);
+                break;
+            case OP_COPY:
+                if ((int)bx + dx < 0 || (int)by + dy < 0 ||
+                    bx + dx + bs > v->width || by + dy + bs > v->height)
+                    return -1;
+                copy(x, y, bs, dx, dy, rev);
+                break;
+            default:
+                if (op == OP_RAW) {
+                    for (unsigned j = 0; j < bs; j++)
+                        for (unsigned i = 0; i < bs; i++, p += 3)
+                            setPixel(x + i, y + j, rgb(p));
+                } else {
+                    palette(x, y, bs, pal, p, bits);
+                    p += bs * bs * bits / 8;
+                }
+            }
+        }
+    }
+
+    v->p = p;
+    v->frame++;
+    if (delay_ms)
+        *delay_ms = delay;
+    if (dirty)
+        *dirty = rows;
+    return 0;
+}
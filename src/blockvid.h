@@ -0,0 +1,51 @@
+#ifndef BLOCKVID_H
+#define BLOCKVID_H
+
+// Block video codec for small panels. Each frame is a list of operations on
+// square blocks (4x4 or 8x8) in raster order, decoded in a single pass straight
+// into framebuf, on top of the previous frame. No allocation, no frame buffer
+// of its own.
+//
+// File layout, little endian:
+//   header   'B' 'V' block_size 0, width u16, height u16, n_frames u16
+//   frame    delay_ms u16, then operations until every block is covered. Bit 15
+//            of the delay reverses the order: blocks from the bottom right, and
+//            copies pixel by pixel from the bottom right of the block.
+//
+// Operations, n = (op & 0x3F) + 1 blocks:
+//   00nnnnnn              skip, the blocks stay as they are
+//   01nnnnnn R G B        fill with a solid colour
+//   10nnnnnn dx dy        copy from (dx, dy) pixels away (int8), read from framebuf
+//                         as it is at this point of the frame, pixel by pixel
+//   0xC0 RGB ...          raw pixels, row by row
+//   0xC1 2 x RGB, bits    2 colour palette, 1 bit index per pixel, MSB first
+//   0xC2 4 x RGB, bits    4 colour palette, 2 bit indices
+// Copy sources must be inside the video. tools/bvconv.c writes these files.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define BV_HEADER_SZ 10
+
+typedef struct {
+    const uint8_t *data, *end;
+    const uint8_t *p;           // start of the next frame
+    unsigned width, height;     // multiples of block
+    unsigned block;             // block size, 4 or 8
+    unsigned n_frames;          // frames in the file
+    unsigned frame;             // frames decoded since bv_open() / bv_rewind()
+} bv_t;
+
+// Parse the header. Returns 0 or -1 if this is not a block video.
+int bv_open(bv_t *v, const uint8_t *data, size_t len);
+
+// Decode the next frame into framebuf with the top left corner at (x0, y0), the
+// video must fit the display. Returns 0, the frame's delay and the scan rows it
+// changed (fb_row_mask()), 1 at the end of the video or -1 if the data is malformed.
+// The first frame draws every block, it can be decoded on top of anything.
+int bv_next_frame(bv_t *v, int x0, int y0, unsigned *delay_ms, uint32_t *dirty);
+
+// Start over at the first frame
+void bv_rewind(bv_t *v);
+
+#endif
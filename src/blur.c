@@ -0,0 +1,271 @@
+#include <stdint.h>
+#include "framebuf.h"
+#include "blur.h"
+
+#define MAX_LINE (DISPLAY_WIDTH > DISPLAY_HEIGHT ? DISPLAY_WIDTH : DISPLAY_HEIGHT)
+
+// A row or column being filtered and the output of a pass. Sums are kept in
+// 16 bit lanes, rb has red in the upper and blue in the lower half, g green.
+static uint32_t line_rb[2][MAX_LINE], line_g[2][MAX_LINE];
+// Original rectangle for blur_glow()
+static uint8_t arena[BLUR_ARENA];
+
+// Window of a pass to the power of passes, 0 if it's more than the lanes hold
+static unsigned scale(unsigned r, unsigned passes)
+{
+    unsigned d = 2 * r + 1, s = 1;
+    if (r > BLUR_MAX_R)
+        return 0;
+    for (unsigned p = 0; p < passes; p++)
+        if ((s *= d) > BLUR_MAX_SCALE)
+            return 0;
+    return s;
+}
+
+// Sum n pixels of src over windows of 2 r + 1 into dst. Both lanes of a word
+// are summed at once. Subtracting the pixel leaving first keeps the sums
+// below the window total, so no lane overflows into the next.
+static void box(const uint32_t *src, uint32_t *dst, unsigned n, unsigned r)
+{
+    uint32_t s = (r + 1) * src[0];
+    for (unsigned k = 1; k <= r; k++)
+        s += src[k < n ? k : n - 1];
+    // The middle stretch, where the window is inside the line, has no edge checks
+    unsigned x = 0, mid = n > r + 1 ? n - r - 1 : 0;
+    for (; x < r && x < n; x++) {
+        dst[x] = s;
+        s -= src[0];
+        s += src[x + r + 1 < n ? x + r + 1 : n - 1];
+    }
+    for (; x < mid; x++) {
+        dst[x] = s;
+        s -= src[x - r];
+        s += src[x + r + 1];
+    }
+    for (; x < n; x++) {
+        dst[x] = s;
+        s -= src[x - r];
+        s += src[n - 1];
+    }
+}
+
+// Filter n pixels in line_*[0] with passes box filters. Returns which line holds the sums.
+static unsigned filter(unsigned n, unsigned r, unsigned passes)
+{
+    unsigned cur = 0;
+    for (unsigned p = 0; p < passes; p++) {
+        box(line_rb[cur], line_rb[cur ^ 1], n, r);
+        box(line_g[cur], line_g[cur ^ 1], n, r);
+        cur ^= 1;
+    }
+    return cur;
+}
+
+static inline void load(unsigned i, uint32_t col)
+{
+    line_rb[0][i] = col & 0xFF00FF;
+    line_g[0][i] = (col >> 8) & 0xFF;
+}
+
+// Sums of line cur at i back to a colour. They are divided by the scale with a
+// 16 bit reciprocal, which can't overshoot 255 for scales below 257.
+static inline uint32_t store(unsigned cur, unsigned i, uint32_t inv)
+{
+    uint32_t rb = line_rb[cur][i], g = line_g[cur][i];
+    uint32_t r = ((rb >> 16) * inv + 32768) >> 16, b = ((rb & 0xFFFF) * inv + 32768) >> 16;
+    return r << 16 | ((g * inv + 32768) >> 16) << 8 | b;
+}
+
+// Clip the rectangle to the display. Returns 0 if nothing is left.
+static int clip(int *x0, int *y0, unsigned *w, unsigned *h)
+{
+    int x1 = *x0 + (int)*w, y1 = *y0 + (int)*h;
+    if (*x0 < 0)
+        *x0 = 0;
+    if (*y0 < 0)
+        *y0 = 0;
+    if (x1 > DISPLAY_WIDTH)
+        x1 = DISPLAY_WIDTH;
+    if (y1 > DISPLAY_HEIGHT)
+        y1 = DISPLAY_HEIGHT;
+    if (x1 <= *x0 || y1 <= *y0)
+        return 0;
+    *w = x1 - *x0;
+    *h = y1 - *y0;
+    return 1;
+}
+
+static void blur_clipped(int x0, int y0, unsigned w, unsigned h, unsigned r, unsigned passes, unsigned sc)
+{
+    uint32_t inv = (65536 + sc / 2) / sc;
+    for (unsigned y = 0; y < h; y++) {
+        for (unsigned x = 0; x < w; x++)
+            load(x, getPixel(x0 + x, y0 + y));
+        unsigned cur = filter(w, r, passes);
+        for (unsigned x = 0; x < w; x++)
+            setPixel(x0 + x, y0 + y, store(cur, x, inv));
+    }
+    for (unsigned x = 0; x < w; x++) {
+        for (unsigned y = 0; y < h; y++)
+            load(y, getPixel(x0 + x, y0 + y));
+        unsigned cur = filter(h, r, passes);
+        for (unsigned y = 0; y < h; y++)
+            setPixel(x0 + x, y0 + y, store(cur, y, inv));
+    }
+}
+
+int blur(int x0, int y0, unsigned w, unsigned h, unsigned r, unsigned passes)
+{
+    unsigned sc = scale(r, passes);
+    if (!sc)
+        return -1;
+    if (clip(&x0, &y0, &w, &h))
+        blur_clipped(x0, y0, w, h, r, passes, sc);
+    return 0;
+}
+
+int blur_glow(int x0, int y0, unsigned w, unsigned h, unsigned r, unsigned passes, unsigned gain)
+{
+    unsigned sc = scale(r, passes);
+    if (!sc)
+        return -1;
+    if (!clip(&x0, &y0, &w, &h))
+        return 0;
+    if (3 * w * h > BLUR_ARENA)
+        return -1;
+    uint8_t *o = arena;
+    for (unsigned y = 0; y < h; y++)
+        for (unsigned x = 0; x < w; x++, o += 3) {
+            uint32_t col = getPixel(x0 + x, y0 + y);
+            o[0] = col >> 16;
+            o[1] = col >> 8;
+            o[2] = col;
+        }
+    blur_clipped(x0, y0, w, h, r, passes, sc);
+    o = arena;
+    for (unsigned y = 0; y < h; y++)
+        for (unsigned x = 0; x < w; x++, o += 3) {
+            uint32_t col = getPixel(x0 + x, y0 + y), out = 0;
+            for (int c = 0; c < 3; c++) {
+                unsigned v = o[c] + ((((col >> (16 - 8 * c)) & 0xFF) * gain) >> 8);
+                out |= (v > 255 ? 255 : v) << (16 - 8 * c);
+            }
+            setPixel(x0 + x, y0 + y, out);
+        }
+    return 0;
+}
+
+#ifdef BLUR_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_util.h"
+
+// Channel c of framebuf as it was, and as it must come out
+static uint32_t orig[3][FB_PIXELS], ref[2][FB_PIXELS];
+
+// One box pass over n values at stride, summing the whole window of each, edges repeated
+static void box_ref(const uint32_t *src, uint32_t *dst, int n, int r, int stride)
+{
+    for (int i = 0; i < n; i++) {
+        uint32_t s = 0;
+        for (int k = i - r; k <= i + r; k++)
+            s += src[(k < 0 ? 0 : k >= n ? n - 1 : k) * stride];
+        dst[i * stride] = s;
+    }
+}
+
+// The passes over the rectangle in ref[0], one direction, then divided by the scale
+static void filter_ref(int n_lines, int line_stride, int n, int stride, unsigned r, unsigned passes, unsigned base)
+{
+    unsigned sc = 1, cur = 0;
+    for (unsigned p = 0; p < passes; p++) {
+        memcpy(ref[cur ^ 1], ref[cur], sizeof(ref[0]));
+        for (int l = 0; l < n_lines; l++)
+            box_ref(&ref[cur][base + l * line_stride], &ref[cur ^ 1][base + l * line_stride], n, r, stride);
+        cur ^= 1;
+        sc *= 2 * r + 1;
+    }
+    unsigned inv = (65536 + sc / 2) / sc;
+    if (cur)
+        memcpy(ref[0], ref[1], sizeof(ref[0]));
+    for (int l = 0; l < n_lines; l++)
+        for (int i = 0; i < n; i++) {
+            unsigned j = base + l * line_stride + i * stride;
+            ref[0][j] = (ref[0][j] * inv + 32768) >> 16;
+        }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned n = argc > 1 ? strtoul(argv[1], NULL, 0) : 2000, fails = 0;
+    for (unsigned k = 0; k < n; k++) {
+        for (int i = 0; i < FB_PIXELS; i++) {
+            // sparse bright pixels, like text, or noise
+            uint32_t col = k & 1 ? rnd() & 0xFFFFFF : rnd() % 8 ? 0 : 0xFFFFFF;
+            setPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH, col);
+            for (int c = 0; c < 3; c++)
+                orig[c][i] = (col >> (16 - 8 * c)) & 0xFF;
+        }
+        int x0 = rnd() % (DISPLAY_WIDTH + 20) - 10, y0 = rnd() % (DISPLAY_HEIGHT + 10) - 5;
+        unsigned w = rnd() % (DISPLAY_WIDTH + 1), h = rnd() % (DISPLAY_HEIGHT + 1);
+        unsigned r = rnd() % 5, passes = 1 + rnd() % 3, gain = rnd() % 512;
+        if (k % 7 == 0) {
+            r = rnd() % (BLUR_MAX_R + 1);
+            passes = 1;
+        }
+        int glow = k % 3 == 0;
+        if (k % 4 == 0) {
+            x0 = y0 = 0;
+            w = DISPLAY_WIDTH;
+            h = glow ? BLUR_ARENA / 3 / w : DISPLAY_HEIGHT;
+        }
+        int ret = glow ? blur_glow(x0, y0, w, h, r, passes, gain) : blur(x0, y0, w, h, r, passes);
+
+        // the same, channel by channel with the whole windows summed
+        unsigned sc = 1;
+        for (unsigned p = 0; p < passes; p++)
+            sc *= 2 * r + 1;
+        int visible = clip(&x0, &y0, &w, &h);
+        int fits = sc <= BLUR_MAX_SCALE && (!glow || !visible || 3 * w * h <= BLUR_ARENA);
+        int ok = fits && visible;
+        if ((ret == 0) != fits && fails++ < 10)
+            printf("case %u: returned %d\n", k, ret);
+        uint32_t out[FB_PIXELS] = {0};
+        for (int c = 0; c < 3; c++) {
+            memcpy(ref[0], orig[c], sizeof(ref[0]));
+            if (ok) {
+                unsigned base = x0 + y0 * DISPLAY_WIDTH;
+                filter_ref(h, DISPLAY_WIDTH, w, 1, r, passes, base);
+                filter_ref(w, 1, h, DISPLAY_WIDTH, r, passes, base);
+                if (glow)
+                    for (unsigned y = 0; y < h; y++)
+                        for (unsigned x = 0; x < w; x++) {
+                            unsigned j = base + x + y * DISPLAY_WIDTH;
+                            unsigned v = orig[c][j] + ((ref[0][j] * gain) >> 8);
+                            ref[0][j] = v > 255 ? 255 : v;
+                        }
+            }
+            for (int i = 0; i < FB_PIXELS; i++)
+                out[i] |= ref[0][i] << (16 - 8 * c);
+        }
+        for (int i = 0; i < FB_PIXELS; i++)
+            if (getPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH) != out[i] && fails++ < 10)
+                printf("case %u (%s r %u passes %u): pixel %d, %d differs\n", k, glow ? "glow" : "blur", r, passes, i % DISPLAY_WIDTH, i / DISPLAY_WIDTH);
+    }
+    printf("%u cases checked, %u failures\n", n, fails);
+
+    // radius 2, 3 passes: the whole display, and glow behind a line of text
+    unsigned n_t = 2000;
+    double t0 = cpu_us();
+    for (unsigned k = 0; k < n_t; k++)
+        blur(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, 2, 3);
+    double t_blur = (cpu_us() - t0) / n_t;
+    t0 = cpu_us();
+    for (unsigned k = 0; k < n_t; k++)
+        blur_glow(0, 0, DISPLAY_WIDTH, 12, 2, 3, 256);
+    double t_glow = (cpu_us() - t0) / n_t;
+    printf("radius 2, 3 passes: blur %.1f us per %dx%d, glow %.1f us per %dx12\n", t_blur, DISPLAY_WIDTH, DISPLAY_HEIGHT, t_glow, DISPLAY_WIDTH);
+    return fails != 0;
+}
+#endif
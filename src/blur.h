@@ -0,0 +1,39 @@
+#ifndef BLUR_H
+#define BLUR_H
+
+// Blur and glow over rectangles of framebuf. The blur is separable: every row
+// of the rectangle is box filtered, then every column. A box filter keeps a
+// running sum over its window, adding the pixel entering it and subtracting the
+// one leaving, so it costs the same for any radius. Repeating it (passes > 1)
+// approaches a Gaussian, 3 passes of radius r look like sigma ~ r.
+//
+// The rectangle is filtered in place through a line of scratch. Pixels beyond
+// its edges count as copies of the edge pixels. Glow also keeps a copy of the
+// original rectangle, which has to fit BLUR_ARENA.
+//
+// Checked against a direct implementation on the host, with timing:
+//   gcc -O2 -DBLUR_MAIN -Isrc -o blur src/blur.c src/framebuf.c src/encoder.c && ./blur
+
+#include <stdint.h>
+#include "framebuf.h"
+
+// Largest radius
+#define BLUR_MAX_R 15
+// Largest (2 r + 1) ^ passes, the sums of all passes are kept in 16 bits before
+// dividing, e.g. radius 2 with 3 passes or radius 7 with 2
+#define BLUR_MAX_SCALE 256
+// Bytes for the copy glow keeps, 3 per pixel
+#ifndef BLUR_ARENA
+#define BLUR_ARENA (DISPLAY_WIDTH * 16 * 3)
+#endif
+
+// Blur the w x h pixels at (x0, y0) with passes box filters of radius r.
+// Returns -1 if r and passes exceed BLUR_MAX_R or BLUR_MAX_SCALE. The rectangle is clipped to the display.
+int blur(int x0, int y0, unsigned w, unsigned h, unsigned r, unsigned passes);
+
+// Glow: add the blurred rectangle, scaled by gain / 256, to the original one,
+// saturating. Bright things like text get a halo which lifts them off a busy
+// background. Returns -1 if r and passes are out of range like for blur(), or the rectangle doesn't fit BLUR_ARENA.
+int blur_glow(int x0, int y0, unsigned w, unsigned h, unsigned r, unsigned passes, unsigned gain);
+
+#endif
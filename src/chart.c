@@ -0,0 +1,192 @@
+#include <stdint.h>
+#include <string.h>
+#include "framebuf.h"
+#include "chart.h"
+
+// Samples which are (partly) on the chart
+static inline unsigned visible(const chart_t *c)
+{
+    return (c->w + c->step - 1) / c->step;
+}
+
+// Samples kept: the visible ones and the one before, which the oldest line starts from
+static inline unsigned capacity(const chart_t *c)
+{
+    return visible(c) + 1;
+}
+
+int chart_init(chart_t *c, chart_type_t type, int x0, int y0, unsigned w, unsigned h,
+               unsigned step, int32_t lo, int32_t hi, uint32_t fg, uint32_t bg)
+{
+    if (x0 < 0 || y0 < 0 || x0 + w > DISPLAY_WIDTH || y0 + h > DISPLAY_HEIGHT || h == 0 || step == 0 || w < step || lo >= hi)
+        return -1;
+    memset(c, 0, sizeof(*c));
+    c->type = type;
+    c->x0 = x0;
+    c->y0 = y0;
+    c->w = w;
+    c->h = h;
+    c->step = step;
+    c->lo = lo;
+    c->hi = hi;
+    c->fg = fg;
+    c->bg = bg;
+    chart_redraw(c);
+    return 0;
+}
+
+// Sample of age a, 0 is the newest
+static inline int32_t sample(const chart_t *c, unsigned a)
+{
+    unsigned cap = capacity(c);
+    return c->ring[(c->head + cap - 1 - a) % cap];
+}
+
+// Rows from the top of the chart: for lines the row of v, for bars where the bar starts
+static int row_of(const chart_t *c, int32_t v)
+{
+    if (v <= c->lo)
+        return c->type == CHART_LINE ? c->h - 1 : c->h;
+    if (v >= c->hi)
+        return 0;
+    unsigned span = c->type == CHART_LINE ? c->h - 1 : c->h;
+    // rounded, in 64 bit as the range can be all of int32_t
+    return span - (int)(((int64_t)v - c->lo) * span * 2 / ((int64_t)c->hi - c->lo) + 1) / 2;
+}
+
+static void column(const chart_t *c, int x, int top, int bottom)
+{
+    for (int y = 0; y < (int)c->h; y++)
+        setPixel(x, c->y0 + y, y >= top && y <= bottom ? c->fg : c->bg);
+}
+
+// Draw the columns of the sample of age a, with value v, the one before it pv
+static void draw_sample(const chart_t *c, unsigned a, int32_t v, int32_t pv)
+{
+    int xs = c->x0 + (int)c->w - (int)((a + 1) * c->step);
+    int y = row_of(c, v), prev = row_of(c, pv);
+    for (unsigned k = 0; k < c->step; k++) {
+        int x = xs + k;
+        if (x < c->x0)
+            continue;
+        if (c->type == CHART_BARS) {
+            if (k == 0 && c->step > 1)
+                column(c, x, c->h, c->h);
+            else
+                column(c, x, y, c->h - 1);
+            continue;
+        }
+        // line from the row of the column before, excluding it unless it is the same
+        int yk = prev + (y - prev) * (int)(k + 1) / (int)c->step;
+        int ylast = prev + (y - prev) * (int)k / (int)c->step;
+        if (yk < ylast)
+            column(c, x, yk, ylast - 1);
+        else if (yk > ylast)
+            column(c, x, ylast + 1, yk);
+        else
+            column(c, x, yk, yk);
+    }
+}
+
+// Move the pixels of row y (display row) of the chart n columns to the left
+static void scroll_row(const chart_t *c, int y, unsigned n)
+{
+    unsigned len = c->w - n;
+#if FB_LAYOUT == ENC_FMT_PLANAR
+    unsigned i = fb_index(c->x0, y);
+    for (int ch = 0; ch < 3; ch++)
+        memmove(&framebuf[ch][i], &framebuf[ch][i + n], len);
+#elif FB_LAYOUT == ENC_FMT_ROWPAIR
+    // pixels are interleaved with the other half and pair swapped, no straight run to move
+    for (unsigned x = 0; x < len; x++)
+        setPixel(c->x0 + x, y, getPixel(c->x0 + x + n, y));
+#else
+    unsigned i = fb_index(c->x0, y);
+    memmove(&framebuf[i], &framebuf[i + n], len * sizeof(framebuf[0]));
+#endif
+}
+
+uint32_t chart_push(chart_t *c, int32_t v)
+{
+    unsigned cap = capacity(c);
+    int32_t pv = c->n ? sample(c, 0) : v;
+    c->ring[c->head] = v;
+    c->head = (c->head + 1) % cap;
+    if (c->n < cap)
+        c->n++;
+    if (c->step < c->w)
+        for (unsigned y = 0; y < c->h; y++)
+            scroll_row(c, c->y0 + y, c->step);
+    draw_sample(c, 0, v, pv);
+    return fb_row_mask(c->y0, c->y0 + c->h);
+}
+
+uint32_t chart_redraw(const chart_t *c)
+{
+    unsigned vis = visible(c);
+    for (unsigned x = 0; x < c->w; x++)
+        column(c, c->x0 + x, c->h, c->h);
+    for (unsigned a = 0; a < c->n && a < vis; a++)
+        draw_sample(c, a, sample(c, a), a + 1 < c->n ? sample(c, a + 1) : sample(c, a));
+    return fb_row_mask(c->y0, c->y0 + c->h);
+}
+
+#ifdef CHART_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_util.h"
+
+static uint32_t scrolled[FB_PIXELS];
+
+int main(int argc, char **argv)
+{
+    unsigned n = argc > 1 ? strtoul(argv[1], NULL, 0) : 300, fails = 0;
+    static chart_t c;
+    double t_push = 0;
+    unsigned n_push = 0;
+    for (unsigned k = 0; k < n; k++) {
+        for (int i = 0; i < FB_PIXELS; i++)
+            setPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH, rnd() & 0xFFFFFF);
+        unsigned w = 1 + rnd() % DISPLAY_WIDTH, h = 1 + rnd() % DISPLAY_HEIGHT;
+        int x0 = rnd() % (DISPLAY_WIDTH - w + 1), y0 = rnd() % (DISPLAY_HEIGHT - h + 1);
+        int32_t lo = (int32_t)rnd() % 1000, hi = lo + 1 + rnd() % 2000;
+        unsigned step = 1 + rnd() % 6;
+        // the first two are full width with step 1, which keeps the most samples
+        if (k < 2) {
+            w = DISPLAY_WIDTH;
+            x0 = 0;
+            step = 1;
+        }
+        if (chart_init(&c, k % 2 ? CHART_BARS : CHART_LINE, x0, y0, w, h, step, lo, hi, 0xFFFFFF, 0x102030)) {
+            if (w >= step && fails++ < 10)
+                printf("case %u: init failed\n", k);
+            continue;
+        }
+        int32_t v = lo;
+        for (unsigned s = 0; s < 3 * DISPLAY_WIDTH; s++) {
+            // a random walk, off the scale now and then
+            v += (int32_t)(rnd() % 401) - 200;
+            uint32_t outside[FB_PIXELS];
+            for (int i = 0; i < FB_PIXELS; i++)
+                outside[i] = getPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH);
+            double t0 = cpu_us();
+            uint32_t dirty = chart_push(&c, v);
+            t_push += cpu_us() - t0;
+            n_push++;
+            for (int i = 0; i < FB_PIXELS; i++)
+                scrolled[i] = getPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH);
+            chart_redraw(&c);
+            for (int i = 0; i < FB_PIXELS; i++) {
+                int x = i % DISPLAY_WIDTH, y = i / DISPLAY_WIDTH;
+                int inside = x >= x0 && x < x0 + (int)w && y >= y0 && y < y0 + (int)h;
+                if ((scrolled[i] != getPixel(x, y) || (!inside && scrolled[i] != outside[i])) && fails++ < 10)
+                    printf("case %u, sample %u: pixel %d, %d differs\n", k, s, x, y);
+            }
+            if (dirty != fb_row_mask(y0, y0 + h) && fails++ < 10)
+                printf("case %u: dirty rows %08x\n", k, dirty);
+        }
+    }
+    printf("%u charts checked, %u failures, %.2f us per push\n", n, fails, t_push / n_push);
+    return fails != 0;
+}
+#endif
@@ -0,0 +1,45 @@
+#ifndef CHART_H
+#define CHART_H
+
+// Scrolling charts of live values, as a sparkline or as bars. The last samples
+// are kept in a ring buffer. A new sample moves the chart's own pixels left by
+// step columns (a memmove per row in the linear and planar framebuf layouts)
+// and draws only the new columns. The scan rows the chart covers are returned,
+// for update_frame_partial(), so the encoder only redoes those.
+//
+// On the host it checks the scrolled charts against a full redraw and times a push:
+//   gcc -O2 -DCHART_MAIN -Isrc -o chart src/chart.c src/framebuf.c src/encoder.c && ./chart
+
+#include <stdint.h>
+#include "framebuf.h"
+
+typedef enum {
+    CHART_LINE,     // sparkline, each sample joined to the one before
+    CHART_BARS,     // a bar per sample, step - 1 wide with a column of gap (step > 1)
+} chart_type_t;
+
+typedef struct {
+    chart_type_t type;
+    int x0, y0;
+    unsigned w, h;
+    unsigned step;              // columns per sample
+    int32_t lo, hi;             // values shown at the bottom and top row
+    uint32_t fg, bg;
+    int32_t ring[DISPLAY_WIDTH + 1];    // a full width chart of step 1 and the sample before it
+    unsigned n;                 // samples in ring, at most w / step rounded up, plus one
+    unsigned head;              // where the next sample goes
+} chart_t;
+
+// Set up a chart in the w x h pixels at (x0, y0) and clear them to bg. Returns -1
+// if the area isn't on the display, is less than step wide or lo >= hi.
+int chart_init(chart_t *c, chart_type_t type, int x0, int y0, unsigned w, unsigned h,
+               unsigned step, int32_t lo, int32_t hi, uint32_t fg, uint32_t bg);
+
+// Add a sample, scroll and draw it. Returns the scan rows which changed (fb_row_mask()).
+uint32_t chart_push(chart_t *c, int32_t v);
+
+// Draw the whole chart from the ring buffer, e.g. after something drew over it.
+// Returns the scan rows it covers.
+uint32_t chart_redraw(const chart_t *c);
+
+#endif
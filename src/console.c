@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "driver/uart.h"
+#include "esp_vfs_dev.h"
+#include "esp_err.h"
+
+#include "tasks.h"
+#include "console.h"
+
+#define MAX_CMDS 24
+#define MAX_ARGS 8
+#define LINE_LEN 128
+
+typedef struct {
+    const char *name;
+    const char *help;
+    console_fn_t fn;
+} console_cmd_t;
+
+static console_cmd_t cmds[MAX_CMDS];
+static unsigned n_cmds;
+
+void console_register(const char *name, const char *help, console_fn_t fn)
+{
+    assert(n_cmds < MAX_CMDS && "Too many console commands");
+    cmds[n_cmds++] = (console_cmd_t){name, help, fn};
+}
+
+static int cmd_help(int argc, char **argv)
+{
+    for (unsigned i = 0; i < n_cmds; i++)
+        printf("  %-12s %s\n", cmds[i].name, cmds[i].help);
+    return 0;
+}
+
+static int cmd_tasks(int argc, char **argv)
+{
+    tasks_print_stats();
+    return 0;
+}
+
+static void run_line(char *line)
+{
+    char *argv[MAX_ARGS];
+    int argc = 0;
+    for (char *tok = strtok(line, " \t\r\n"); tok && argc < MAX_ARGS; tok = strtok(NULL, " \t\r\n"))
+        argv[argc++] = tok;
+    if (argc == 0)
+        return;
+
+    for (unsigned i = 0; i < n_cmds; i++) {
+        if (strcmp(argv[0], cmds[i].name) == 0) {
+            if (cmds[i].fn(argc, argv))
+                printf("usage: %s\n", cmds[i].help);
+            return;
+        }
+    }
+    printf("Unknown command, try help\n");
+}
+
+static void console_task(void *arg)
+{
+    char line[LINE_LEN];
+    while (1) {
+        if (fgets(line, sizeof(line), stdin))
+            run_line(line);
+        else
+            vTaskDelay(100 / portTICK_PERIOD_MS);
+    }
+}
+
+void console_start(void)
+{
+    console_register("help", "list commands", cmd_help);
+    console_register("tasks", "CPU utilisation and stack headroom per task", cmd_tasks);
+
+    // Blocking reads on stdin need the UART driver
+    setvbuf(stdin, NULL, _IONBF, 0);
+    esp_vfs_dev_uart_port_set_rx_line_endings(CONFIG_ESP_CONSOLE_UART_NUM, ESP_LINE_ENDINGS_CR);
+    esp_vfs_dev_uart_port_set_tx_line_endings(CONFIG_ESP_CONSOLE_UART_NUM, ESP_LINE_ENDINGS_CRLF);
+    ESP_ERROR_CHECK(uart_driver_install(CONFIG_ESP_CONSOLE_UART_NUM, 256, 0, 0, NULL, 0));
+    esp_vfs_dev_uart_use_driver(CONFIG_ESP_CONSOLE_UART_NUM);
+
+    tasks_start(TASK_CONSOLE, console_task, NULL);
+}
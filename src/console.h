@@ -0,0 +1,15 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+// Minimal serial command line, runs in its own task (see tasks.h)
+
+// argv[0] is the command name, return non-zero to print the help text
+typedef int (*console_fn_t)(int argc, char **argv);
+
+// Add a command, `name` and `help` must stay valid
+void console_register(const char *name, const char *help, console_fn_t fn);
+
+// Take over the console UART and start reading commands
+void console_start(void);
+
+#endif
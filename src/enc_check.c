@@ -0,0 +1,411 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#ifndef ENC_CHECK_MAIN
+#include "esp_heap_caps.h"
+#endif
+#include "encoder.h"
+#include "enc_check.h"
+
+// guard words behind each bitplane, catches encoders writing past the end
+#define GUARD 2
+#define PLANE_MAX (ENC_CHECK_MAX_W * ENC_MAX_ROWS + GUARD)
+// stop printing details after this many failures
+#define MAX_REPORTS 10
+
+static uint32_t rng;
+
+// xorshift32, fast and good enough to generate test cases
+static uint32_t rnd(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+// random number in [lo, hi]
+static unsigned rnd_range(unsigned lo, unsigned hi)
+{
+    return lo + rnd() % (hi - lo + 1);
+}
+
+static void random_cfg(enc_cfg_t *cfg)
+{
+    // Mostly small panels, they are cheap and hit the edge cases (odd OE
+    // boundaries, latch position) just as well. Every 8th case is wide, half
+    // of those the full ENC_CHECK_MAX_W.
+    if ((rnd() & 7) == 0)
+        cfg->width = rnd() & 1 ? ENC_CHECK_MAX_W : 2 * rnd_range(17, ENC_CHECK_MAX_W / 2);
+    else
+        cfg->width = 2 * rnd_range(1, 16);
+    cfg->rows = rnd_range(1, ENC_MAX_ROWS);
+    cfg->n_planes = rnd_range(1, ENC_MAX_PLANES);
+    // include values outside of the valid range to exercise the clamping
+    cfg->brightness = (int)rnd_range(0, cfg->width + 2) - 1;
+    // every 4th case maps the channels through a random code table
+    static uint8_t code[256];
+    static uint32_t code_spread[256];
+    cfg->code = NULL;
+    cfg->code_spread = NULL;
+    if ((rnd() & 3) == 0) {
+        for (unsigned i = 0; i < 256; i++)
+            code[i] = rnd();
+        enc_spread_code(code_spread, code);
+        cfg->code = code;
+        cfg->code_spread = code_spread;
+    }
+    cfg->skip = 0;
+}
+
+#define N_PATTERNS 10
+static const char *pattern_names[N_PATTERNS] = {
+    "random", "zero", "ones", "solid", "alternate",
+    "walking bit", "runs", "gradient", "solid rows", "sparse"
+};
+
+static void fill_fb(uint32_t *fb, unsigned pattern, const enc_cfg_t *cfg)
+{
+    unsigned w = cfg->width, h = 2 * cfg->rows, n = w * h;
+    uint32_t c0 = rnd(), c1 = rnd();
+
+    switch (pattern) {
+    case 0:
+        for (unsigned i = 0; i < n; i++)
+            fb[i] = rnd();
+        break;
+    case 1:
+        memset(fb, 0, n * sizeof(*fb));
+        break;
+    case 2:
+        memset(fb, 0xFF, n * sizeof(*fb));
+        break;
+    case 3:
+        for (unsigned i = 0; i < n; i++)
+            fb[i] = c0;
+        break;
+    case 4:
+        // two colours alternating per pixel, worst case for anything run based
+        for (unsigned i = 0; i < n; i++)
+            fb[i] = (i & 1) ? c1 : c0;
+        break;
+    case 5:
+        for (unsigned i = 0; i < n; i++)
+            fb[i] = 1U << (rnd() & 31);
+        break;
+    case 6:
+        // runs of random length, often crossing row boundaries
+        for (unsigned i = 0; i < n;) {
+            unsigned len = rnd_range(1, w + 3);
+            uint32_t c = rnd();
+            while (len-- && i < n)
+                fb[i++] = c;
+        }
+        break;
+    case 7:
+        for (unsigned y = 0; y < h; y++)
+            for (unsigned x = 0; x < w; x++)
+                fb[x + y * w] = (x * 255 / w) << 16 | (y * 255 / h) << 8 | ((x ^ y) & 0xFF);
+        break;
+    case 8:
+        for (unsigned y = 0; y < h; y++) {
+            uint32_t c = rnd();
+            for (unsigned x = 0; x < w; x++)
+                fb[x + y * w] = c;
+        }
+        break;
+    default:
+        memset(fb, 0, n * sizeof(*fb));
+        for (unsigned i = 0; i < n / 16 + 1; i++)
+            fb[rnd() % n] = rnd();
+        break;
+    }
+}
+
+static void setup_planes(uint16_t **planes, uint16_t *buf, const enc_cfg_t *cfg, uint16_t poison)
+{
+    unsigned stride = cfg->width * cfg->rows + GUARD;
+    for (unsigned i = 0; i < stride * cfg->n_planes; i++)
+        buf[i] = poison;
+    for (unsigned pl = 0; pl < cfg->n_planes; pl++)
+        planes[pl] = &buf[pl * stride];
+}
+
+// Encode a random low resolution frame with enc_lowres() and the pixel doubled
+// frame with enc_reference(). Leaves the upscaled frame in fb. Returns 0 if both match.
+static int check_lowres(
+    uint32_t *fb, uint32_t *src, uint16_t *buf_ref, uint16_t *buf_dut, const enc_cfg_t *cfg,
+    unsigned *sx, unsigned *sy
+) {
+    uint16_t *planes_ref[ENC_MAX_PLANES], *planes_dut[ENC_MAX_PLANES];
+    unsigned w = cfg->width, h = 2 * cfg->rows;
+    *sx = rnd_range(1, 2);
+    *sy = rnd_range(1, 2);
+    unsigned src_w = w / *sx, src_h = h / *sy;
+    // half the cases flat colour, so the row reuse sees repeated words too
+    uint32_t c0 = rnd();
+    bool flat = rnd() & 1;
+    for (unsigned i = 0; i < src_w * src_h; i++)
+        src[i] = flat ? c0 : rnd();
+    for (unsigned y = 0; y < h; y++)
+        for (unsigned x = 0; x < w; x++)
+            fb[x + y * w] = src[x / *sx + y / *sy * src_w];
+
+    uint16_t poison = rnd();
+    setup_planes(planes_ref, buf_ref, cfg, poison);
+    setup_planes(planes_dut, buf_dut, cfg, poison);
+    enc_reference(planes_ref, fb, cfg);
+    enc_lowres(planes_dut, src, *sx, *sy, cfg);
+    unsigned n_words = (cfg->width * cfg->rows + GUARD) * cfg->n_planes;
+    return memcmp(buf_ref, buf_dut, n_words * sizeof(uint16_t)) != 0;
+}
+
+// Encode a random bitmap with enc_mono() and its expansion into fb with
+// enc_reference(). Leaves the expanded frame in fb. Returns 0 if both match.
+static int check_mono(uint32_t *fb, uint32_t *bits, uint16_t *buf_ref, uint16_t *buf_dut, const enc_cfg_t *cfg)
+{
+    uint16_t *planes_ref[ENC_MAX_PLANES], *planes_dut[ENC_MAX_PLANES];
+    unsigned w = cfg->width, h = 2 * cfg->rows, stride = (w + 31) / 32;
+    uint32_t on = rnd(), off = rnd() & 3 ? 0 : rnd();
+    // bits past the width are set too, they must be ignored
+    for (unsigned i = 0; i < stride * h; i++)
+        bits[i] = rnd();
+    for (unsigned y = 0; y < h; y++)
+        for (unsigned x = 0; x < w; x++)
+            fb[x + y * w] = bits[x / 32 + y * stride] >> (x % 32) & 1 ? on : off;
+
+    uint16_t poison = rnd();
+    setup_planes(planes_ref, buf_ref, cfg, poison);
+    setup_planes(planes_dut, buf_dut, cfg, poison);
+    enc_reference(planes_ref, fb, cfg);
+    enc_mono(planes_dut, bits, on, off, cfg);
+    unsigned n_words = (cfg->width * cfg->rows + GUARD) * cfg->n_planes;
+    return memcmp(buf_ref, buf_dut, n_words * sizeof(uint16_t)) != 0;
+}
+
+// Encode a window of a random canvas with enc_canvas(), staged or not, and the
+// window copied into fb with enc_reference(). Returns 0 if both match.
+static int check_canvas(uint32_t *fb, uint32_t *canvas, uint16_t *buf_ref, uint16_t *buf_dut, const enc_cfg_t *cfg)
+{
+    static uint32_t stage[2 * ENC_MAX_WIDTH];
+    uint16_t *planes_ref[ENC_MAX_PLANES], *planes_dut[ENC_MAX_PLANES];
+    unsigned w = cfg->width, h = 2 * cfg->rows;
+    unsigned stride = rnd_range(w, ENC_CHECK_MAX_W);
+    unsigned x0 = rnd_range(0, stride - w), y0 = rnd_range(0, 2 * ENC_MAX_ROWS - h);
+    for (unsigned i = 0; i < stride * 2 * ENC_MAX_ROWS; i++)
+        canvas[i] = rnd();
+    const uint32_t *src = &canvas[x0 + y0 * stride];
+    for (unsigned y = 0; y < h; y++)
+        memcpy(&fb[y * w], &src[y * stride], w * sizeof(uint32_t));
+
+    uint16_t poison = rnd();
+    setup_planes(planes_ref, buf_ref, cfg, poison);
+    setup_planes(planes_dut, buf_dut, cfg, poison);
+    enc_reference(planes_ref, fb, cfg);
+    enc_canvas(planes_dut, src, stride, rnd() & 1 ? stage : NULL, cfg);
+    unsigned n_words = (cfg->width * cfg->rows + GUARD) * cfg->n_planes;
+    return memcmp(buf_ref, buf_dut, n_words * sizeof(uint16_t)) != 0;
+}
+
+// Fine planes: encoding with the common OE window and then narrowing it with
+// enc_weights_oe() must match the reference run with each plane's own window.
+// The schedule must show every plane as often as its weight says. Returns 0 if ok.
+static int check_weights(uint32_t *fb, uint16_t *buf_ref, uint16_t *buf_dut, const enc_cfg_t *cfg)
+{
+    static enc_weights_t w;
+    uint16_t lum_inv[256];
+    uint16_t *planes_ref[ENC_MAX_PLANES], *planes_dut[ENC_MAX_PLANES];
+    enc_cfg_t c = *cfg;
+
+    for (unsigned v = 0; v < 256; v++)
+        lum_inv[v] = 65535 - v * v;
+    enc_weights_init(&w, cfg, rnd_range(0, cfg->n_planes), lum_inv);
+    c.code = w.code;
+    c.code_spread = w.spread;
+
+    uint8_t order[ENC_MAX_SLOTS];
+    unsigned cnt[ENC_MAX_PLANES] = {0};
+    unsigned n_slots = enc_schedule_weights(order, &w);
+    for (unsigned i = 0; i < n_slots; i++)
+        cnt[order[i]]++;
+    for (unsigned pl = 0; pl < c.n_planes; pl++)
+        if (cnt[pl] != w.slots[pl])
+            return 1;
+
+    uint16_t poison = rnd();
+    setup_planes(planes_dut, buf_dut, &c, poison);
+    enc_paired(planes_dut, fb, &c);
+    enc_weights_oe(planes_dut, &c, &w);
+    for (unsigned pl = 0; pl < c.n_planes; pl++) {
+        enc_cfg_t c_pl = c;
+        c_pl.brightness = w.oe[pl];
+        setup_planes(planes_ref, buf_ref, &c_pl, poison);
+        enc_reference(planes_ref, fb, &c_pl);
+        if (memcmp(planes_ref[pl], planes_dut[pl], (c.width * c.rows + GUARD) * sizeof(uint16_t)))
+            return 1;
+    }
+    return 0;
+}
+
+// Row skipping: encode fb, replace the whole frame and encode it again into the
+// same bitplanes with cfg->skip set. The skipped rows must still hold the first
+// frame, the others the second one. Changes fb, returns the failed variant or NULL.
+static const char *check_skip(
+    uint32_t *fb, uint32_t *fb_dut, uint16_t *buf_ref, uint16_t *buf_dut, const enc_cfg_t *cfg
+) {
+    uint16_t *planes_ref[ENC_MAX_PLANES], *planes_dut[ENC_MAX_PLANES];
+    unsigned n_words = (cfg->width * cfg->rows + GUARD) * cfg->n_planes;
+    enc_cfg_t c = *cfg;
+    c.skip = rnd() & ((1U << c.rows) - 1);
+
+    for (unsigned v = 0; v < enc_variant_cnt; v++) {
+        uint16_t poison = rnd();
+        setup_planes(planes_ref, buf_ref, cfg, poison);
+        setup_planes(planes_dut, buf_dut, cfg, poison);
+        enc_reference(planes_ref, fb, cfg);
+        enc_from_linear(fb_dut, fb, cfg, enc_variants[v].fmt);
+        enc_variants[v].fn(planes_dut, fb_dut, cfg);
+
+        for (unsigned i = 0; i < 2 * c.rows * c.width; i++)
+            fb[i] = rnd();
+        enc_from_linear(fb_dut, fb, cfg, enc_variants[v].fmt);
+        enc_variants[v].fn(planes_dut, fb_dut, &c);
+        // first frame in the skipped rows
+        for (unsigned pl = 0; pl < c.n_planes; pl++)
+            for (unsigned y = 0; y < c.rows; y++)
+                if (c.skip & 1U << y && memcmp(
+                    &planes_ref[pl][y * c.width], &planes_dut[pl][y * c.width], c.width * sizeof(uint16_t)
+                ))
+                    return enc_variants[v].name;
+
+        // second frame everywhere else
+        enc_reference(planes_ref, fb, cfg);
+        for (unsigned pl = 0; pl < c.n_planes; pl++)
+            for (unsigned y = 0; y < c.rows; y++)
+                if (c.skip & 1U << y)
+                    memcpy(&planes_ref[pl][y * c.width], &planes_dut[pl][y * c.width], c.width * sizeof(uint16_t));
+        if (memcmp(buf_ref, buf_dut, n_words * sizeof(uint16_t)))
+            return enc_variants[v].name;
+    }
+    return NULL;
+}
+
+// The target aborts when an allocation fails (CONFIG_HEAP_ABORT_WHEN_ALLOCATION_FAILS),
+// so only ask for what the heap has there
+static void *scratch_alloc(size_t sz)
+{
+#ifndef ENC_CHECK_MAIN
+    if (heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) < sz)
+        return NULL;
+#endif
+    return malloc(sz);
+}
+
+unsigned enc_check_run(unsigned n_cases, uint32_t seed)
+{
+    uint32_t *fb = scratch_alloc(ENC_CHECK_MAX_W * 2 * ENC_MAX_ROWS * sizeof(*fb));
+    // the framebuffer converted to the layout of the variant under test
+    uint32_t *fb_dut = scratch_alloc(ENC_CHECK_MAX_W * 2 * ENC_MAX_ROWS * sizeof(*fb));
+    uint16_t *buf_ref = scratch_alloc(ENC_MAX_PLANES * PLANE_MAX * sizeof(uint16_t));
+    uint16_t *buf_dut = scratch_alloc(ENC_MAX_PLANES * PLANE_MAX * sizeof(uint16_t));
+    if (!fb || !fb_dut || !buf_ref || !buf_dut) {
+        printf("enc_check: not enough memory, skipped\n");
+        free(fb);
+        free(fb_dut);
+        free(buf_ref);
+        free(buf_dut);
+        return 1;
+    }
+    uint16_t *planes_ref[ENC_MAX_PLANES], *planes_dut[ENC_MAX_PLANES];
+    unsigned fails = 0;
+
+    rng = seed ? seed : 1;
+    for (unsigned n = 0; n < n_cases; n++) {
+        enc_cfg_t cfg;
+        random_cfg(&cfg);
+        unsigned pattern = n % N_PATTERNS;
+        fill_fb(fb, pattern, &cfg);
+
+        uint16_t poison = rnd();
+        unsigned n_words = (cfg.width * cfg.rows + GUARD) * cfg.n_planes;
+        setup_planes(planes_ref, buf_ref, &cfg, poison);
+        enc_reference(planes_ref, fb, &cfg);
+
+        for (unsigned v = 1; v < enc_variant_cnt; v++) {
+            setup_planes(planes_dut, buf_dut, &cfg, poison);
+            enc_from_linear(fb_dut, fb, &cfg, enc_variants[v].fmt);
+            enc_variants[v].fn(planes_dut, fb_dut, &cfg);
+            if (memcmp(buf_ref, buf_dut, n_words * sizeof(uint16_t)) == 0)
+                continue;
+
+            if (fails++ < MAX_REPORTS) {
+                unsigned i = 0;
+                while (buf_ref[i] == buf_dut[i])
+                    i++;
+                unsigned stride = cfg.width * cfg.rows + GUARD;
+                printf(
+                    "enc_check: case %u, %s failed: %ux%u, %u planes, brightness %d, %s pattern\n",
+                    n, enc_variants[v].name, cfg.width, 2 * cfg.rows,
+                    cfg.n_planes, cfg.brightness, pattern_names[pattern]
+                );
+                printf(
+                    "  plane %u word %u: expected %04x, got %04x\n",
+                    i / stride, i % stride, buf_ref[i], buf_dut[i]
+                );
+            }
+        }
+
+        if (check_weights(fb, buf_ref, buf_dut, &cfg) && fails++ < MAX_REPORTS)
+            printf(
+                "enc_check: case %u, weights failed: %ux%u, %u planes, brightness %d\n",
+                n, cfg.width, 2 * cfg.rows, cfg.n_planes, cfg.brightness
+            );
+
+        unsigned sx, sy;
+        if (check_lowres(fb, fb_dut, buf_ref, buf_dut, &cfg, &sx, &sy) && fails++ < MAX_REPORTS)
+            printf(
+                "enc_check: case %u, lowres failed: %ux%u, %u planes, brightness %d, scale %ux%u\n",
+                n, cfg.width, 2 * cfg.rows, cfg.n_planes, cfg.brightness, sx, sy
+            );
+
+        if (check_mono(fb, fb_dut, buf_ref, buf_dut, &cfg) && fails++ < MAX_REPORTS)
+            printf(
+                "enc_check: case %u, mono failed: %ux%u, %u planes, brightness %d\n",
+                n, cfg.width, 2 * cfg.rows, cfg.n_planes, cfg.brightness
+            );
+
+        if (check_canvas(fb, fb_dut, buf_ref, buf_dut, &cfg) && fails++ < MAX_REPORTS)
+            printf(
+                "enc_check: case %u, canvas failed: %ux%u, %u planes, brightness %d\n",
+                n, cfg.width, 2 * cfg.rows, cfg.n_planes, cfg.brightness
+            );
+
+        const char *name = check_skip(fb, fb_dut, buf_ref, buf_dut, &cfg);
+        if (name && fails++ < MAX_REPORTS)
+            printf(
+                "enc_check: case %u, %s with skipped rows failed: %ux%u, %u planes, brightness %d\n",
+                n, name, cfg.width, 2 * cfg.rows, cfg.n_planes, cfg.brightness
+            );
+    }
+    printf(
+        "enc_check: %u cases, %u variants + lowres + mono + canvas + weights + skip, %u failures (seed %u)\n",
+        n_cases, enc_variant_cnt - 1, fails, (unsigned)seed
+    );
+
+    free(fb);
+    free(fb_dut);
+    free(buf_ref);
+    free(buf_dut);
+    return fails;
+}
+
+#ifdef ENC_CHECK_MAIN
+int main(int argc, char **argv)
+{
+    unsigned n_cases = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+    uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : 1;
+    return enc_check_run(n_cases, seed) ? 1 : 0;
+}
+#endif
@@ -0,0 +1,28 @@
+#ifndef ENC_CHECK_H
+#define ENC_CHECK_H
+
+#include <stdint.h>
+
+// Differential test of all enc_variants[] against enc_reference().
+// Each case picks a random geometry, plane count, brightness and framebuffer
+// (random or one of several adversarial patterns), runs every encoder on it
+// and compares the resulting DMA buffers word for word.
+//
+// Plain C, so besides running on the target it builds as a host program:
+//   gcc -O2 -DENC_CHECK_MAIN -o enc_check src/enc_check.c src/encoder.c
+//   ./enc_check [n_cases] [seed]
+
+// Widest panel exercised. On the target this keeps the scratch buffers (about
+// 100 kB) small enough for the ESP32 heap, the host build covers ENC_MAX_WIDTH.
+#ifndef ENC_CHECK_MAX_W
+#ifdef ENC_CHECK_MAIN
+#define ENC_CHECK_MAX_W ENC_MAX_WIDTH
+#else
+#define ENC_CHECK_MAX_W 128
+#endif
+#endif
+
+// returns the number of failed cases, 1 if there isn't enough memory
+unsigned enc_check_run(unsigned n_cases, uint32_t seed);
+
+#endif
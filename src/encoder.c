@@ -0,0 +1,741 @@
+#include <stdint.h>
+#include <string.h>
+#include "encoder.h"
+
+// Map each channel of a pixel through a code table
+static inline uint32_t apply_code(uint32_t c, const uint8_t *code)
+{
+    return code[(c >> 16) & 0xFF] << 16 | code[(c >> 8) & 0xFF] << 8 | code[c & 0xFF];
+}
+
+void enc_reference(uint16_t **planes, const void *fb_, const enc_cfg_t *cfg)
+{
+    const uint32_t *fb = fb_;
+    int width = cfg->width;
+    int n_planes = cfg->n_planes;
+
+    // center the output enable between 2 strobes
+    int br = cfg->brightness;
+    if (br > (width - 2))
+        br = (width - 2);
+
+    int oe_start = (width - br) / 2;
+    int oe_stop = (width + br) / 2;
+
+    for (int pl=0; pl<n_planes; pl++) {
+        int mask=(1<<(8-n_planes+pl)); //bitmask for pixel data in input for this bitplane
+        uint16_t *p=planes[pl]; //bitplane location to write to
+        for (unsigned int y=0; y<cfg->rows; y++) {
+            if (cfg->skip & (1<<y)) {
+                p+=width;
+                continue;
+            }
+            int lbits=0;                //Precalculate line bits of the *previous* line, which is the one we're displaying now
+            if ((y-1)&1) lbits|=BIT_A;
+            if ((y-1)&2) lbits|=BIT_B;
+            if ((y-1)&4) lbits|=BIT_C;
+            if ((y-1)&8) lbits|=BIT_D;
+            for (int x=0; x<width; x++) {
+                int x_ = ESP32_TX_FIFO_POSITION_ADJUST(x);
+                int v = lbits;
+
+                // Do not show image while the line bits are changing
+                if (!(x_ >= oe_start && x_ < oe_stop))
+                    v |= BIT_OE_N;
+
+                // latch pulse at the end of shifting in row - data
+                if (x_ == (width - 1))
+                    v |= BIT_LAT;
+
+                int c1, c2;
+                c1 = fb[x_ + y * width];
+                c2 = fb[x_ + (y + cfg->rows) * width];
+                if (cfg->code) {
+                    c1 = apply_code(c1, cfg->code);
+                    c2 = apply_code(c2, cfg->code);
+                }
+                if (c1 & (mask<<16)) v|=BIT_R1;
+                if (c1 & (mask<<8)) v|=BIT_G1;
+                if (c1 & (mask<<0)) v|=BIT_B1;
+                if (c2 & (mask<<16)) v|=BIT_R2;
+                if (c2 & (mask<<8)) v|=BIT_G2;
+                if (c2 & (mask<<0)) v|=BIT_B2;
+
+                //Save the calculated value to the bitplane memory
+                *p++=v;
+            }
+        }
+    }
+}
+
+// Control bits (OE, latch) of both halves of each DMA word pair with an OE
+// window of `br` pixel clocks, the same for every row
+static void ctrl_pairs_br(uint32_t *ctrl, int width, int br)
+{
+    if (br > (width - 2))
+        br = (width - 2);
+    int oe_start = (width - br) / 2;
+    int oe_stop = (width + br) / 2;
+
+    for (int x = 0; x < width; x++) {
+        uint32_t v = 0;
+        if (!(x >= oe_start && x < oe_stop))
+            v |= BIT_OE_N;
+        if (x == (width - 1))
+            v |= BIT_LAT;
+        // even pixels go to the high half of the word
+        if (x & 1)
+            ctrl[x / 2] |= v;
+        else
+            ctrl[x / 2] = v << 16;
+    }
+}
+
+static void ctrl_pairs(uint32_t *ctrl, const enc_cfg_t *cfg)
+{
+    ctrl_pairs_br(ctrl, cfg->width, cfg->brightness);
+}
+
+// Line select bits of the *previous* line, which is the one displayed while row y is shifted in
+static uint32_t line_bits(unsigned y)
+{
+    uint32_t lbits = 0;
+    if ((y-1)&1) lbits|=BIT_A;
+    if ((y-1)&2) lbits|=BIT_B;
+    if ((y-1)&4) lbits|=BIT_C;
+    if ((y-1)&8) lbits|=BIT_D;
+    return lbits;
+}
+
+// Spreads the bits of a byte 3 apart: bit b goes to 3 * b. Applied to R, G and B
+// (shifted by 0, 1, 2) this puts the RGB bits of bitplane b next to each other.
+// Built by the compiler, so encoders running in several threads can share it.
+#define SPREAD(i) (((i) & 1) | ((i) & 2) << 2 | ((i) & 4) << 4 | ((i) & 8) << 6 | \
+                   ((i) & 16) << 8 | ((i) & 32) << 10 | ((i) & 64) << 12 | ((i) & 128) << 14)
+#define SPREAD4(i) SPREAD(i), SPREAD(i + 1), SPREAD(i + 2), SPREAD(i + 3)
+#define SPREAD16(i) SPREAD4(i), SPREAD4(i + 4), SPREAD4(i + 8), SPREAD4(i + 12)
+#define SPREAD64(i) SPREAD16(i), SPREAD16(i + 16), SPREAD16(i + 32), SPREAD16(i + 48)
+static const uint32_t spread_tab[256] = {SPREAD64(0U), SPREAD64(64U), SPREAD64(128U), SPREAD64(192U)};
+
+// The spread table for cfg, with the code table applied if there is one
+static const uint32_t *spread_table(const enc_cfg_t *cfg)
+{
+    return cfg->code ? cfg->code_spread : spread_tab;
+}
+
+void enc_spread_code(uint32_t *spread, const uint8_t *code)
+{
+    for (unsigned i = 0; i < 256; i++)
+        spread[i] = spread_tab[code[i]];
+}
+
+static inline uint32_t spread(const uint32_t *tab, uint32_t c)
+{
+    return tab[(c >> 16) & 0xFF] | tab[(c >> 8) & 0xFF] << 1 | tab[c & 0xFF] << 2;
+}
+
+// Emit one 32 bit word into each plane. u0 / l0 are the spread upper / lower
+// half pixels of the even (high half), u1 / l1 of the odd (low half) position.
+static inline void emit_pair(
+    enc_pair_t **p, unsigned n_planes, unsigned shift0, uint32_t c,
+    uint32_t u0, uint32_t l0, uint32_t u1, uint32_t l1
+) {
+    for (unsigned pl = 0, s = shift0; pl < n_planes; pl++, s += 3) {
+        uint32_t hi = ((u0 >> s) & 7) | ((l0 >> s) & 7) << 3;
+        uint32_t lw = ((u1 >> s) & 7) | ((l1 >> s) & 7) << 3;
+        *p[pl]++ = c | hi << 16 | lw;
+    }
+}
+
+// Step the plane pointers over scan row y if cfg->skip says so, returns 1 if it was skipped
+static inline int skip_row(enc_pair_t **p, unsigned n_planes, unsigned n_pairs, const enc_cfg_t *cfg, unsigned y)
+{
+    if (!(cfg->skip & 1U << y))
+        return 0;
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] += n_pairs;
+    return 1;
+}
+
+// Encode scan row y of enc_paired(), up and lo are the upper and lower half pixel rows
+static inline void paired_row(
+    enc_pair_t **p, unsigned n_planes, unsigned n_pairs, const uint32_t *ctrl, const uint32_t *tab,
+    uint32_t lbits, const uint32_t *up, const uint32_t *lo
+) {
+    unsigned shift0 = 3 * (8 - n_planes);
+    lbits |= lbits << 16;
+    for (unsigned k = 0; k < n_pairs; k++) {
+        emit_pair(
+            p, n_planes, shift0, ctrl[k] | lbits,
+            spread(tab, up[2 * k]), spread(tab, lo[2 * k]),
+            spread(tab, up[2 * k + 1]), spread(tab, lo[2 * k + 1])
+        );
+    }
+}
+
+void enc_paired(uint16_t **planes, const void *fb_, const enc_cfg_t *cfg)
+{
+    const uint32_t *fb = fb_;
+    unsigned n_pairs = cfg->width / 2;
+    unsigned n_planes = cfg->n_planes;
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    enc_pair_t *p[ENC_MAX_PLANES];
+
+    const uint32_t *tab = spread_table(cfg);
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] = (enc_pair_t *)planes[pl];
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (skip_row(p, n_planes, n_pairs, cfg, y))
+            continue;
+        paired_row(
+            p, n_planes, n_pairs, ctrl, tab, line_bits(y),
+            &fb[y * cfg->width], &fb[(y + cfg->rows) * cfg->width]
+        );
+    }
+}
+
+void enc_canvas(
+    uint16_t **planes, const uint32_t *src, unsigned stride, uint32_t *stage, const enc_cfg_t *cfg
+) {
+    unsigned n_pairs = cfg->width / 2;
+    unsigned n_planes = cfg->n_planes;
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    enc_pair_t *p[ENC_MAX_PLANES];
+
+    const uint32_t *tab = spread_table(cfg);
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] = (enc_pair_t *)planes[pl];
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (skip_row(p, n_planes, n_pairs, cfg, y))
+            continue;
+        const uint32_t *up = &src[y * stride];
+        const uint32_t *lo = &src[(y + cfg->rows) * stride];
+        if (stage) {
+            // One sequential burst per row instead of the two rows interleaved word by word
+            memcpy(stage, up, cfg->width * sizeof(uint32_t));
+            memcpy(&stage[cfg->width], lo, cfg->width * sizeof(uint32_t));
+            up = stage;
+            lo = &stage[cfg->width];
+        }
+        paired_row(p, n_planes, n_pairs, ctrl, tab, line_bits(y), up, lo);
+    }
+}
+
+void enc_lowres(
+    uint16_t **planes, const uint32_t *src, unsigned sx, unsigned sy, const enc_cfg_t *cfg
+) {
+    unsigned n_pairs = cfg->width / 2;
+    unsigned src_w = cfg->width / sx;
+    unsigned n_planes = cfg->n_planes;
+    unsigned shift0 = 3 * (8 - n_planes);
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    enc_pair_t *p[ENC_MAX_PLANES];
+
+    const uint32_t *tab = spread_table(cfg);
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] = (enc_pair_t *)planes[pl];
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (skip_row(p, n_planes, n_pairs, cfg, y))
+            continue;
+        unsigned su = y / sy, sl = (y + cfg->rows) / sy;
+        if (y > 0 && su == (y - 1) / sy && sl == (y - 1 + cfg->rows) / sy) {
+            // same source rows as the previous line, only the line bits change
+            uint32_t d = line_bits(y) ^ line_bits(y - 1);
+            d |= d << 16;
+            for (unsigned pl = 0; pl < n_planes; pl++) {
+                const enc_pair_t *prev = p[pl] - n_pairs;
+                for (unsigned k = 0; k < n_pairs; k++)
+                    *p[pl]++ = prev[k] ^ d;
+            }
+            continue;
+        }
+
+        uint32_t lbits = line_bits(y);
+        lbits |= lbits << 16;
+        const uint32_t *up = &src[su * src_w];
+        const uint32_t *lo = &src[sl * src_w];
+        if (sx == 2) {
+            for (unsigned k = 0; k < n_pairs; k++) {
+                uint32_t u = spread(tab, up[k]), l = spread(tab, lo[k]);
+                emit_pair(p, n_planes, shift0, ctrl[k] | lbits, u, l, u, l);
+            }
+        } else {
+            for (unsigned k = 0; k < n_pairs; k++) {
+                emit_pair(
+                    p, n_planes, shift0, ctrl[k] | lbits,
+                    spread(tab, up[2 * k]), spread(tab, lo[2 * k]),
+                    spread(tab, up[2 * k + 1]), spread(tab, lo[2 * k + 1])
+                );
+            }
+        }
+    }
+}
+
+void enc_mono(
+    uint16_t **planes, const uint32_t *bits, uint32_t on, uint32_t off, const enc_cfg_t *cfg
+) {
+    unsigned n_pairs = cfg->width / 2, stride = (cfg->width + 31) / 32;
+    unsigned n_planes = cfg->n_planes;
+    unsigned shift0 = 3 * (8 - n_planes);
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    enc_pair_t *p[ENC_MAX_PLANES];
+
+    // Colour bits of a word pair for all 16 combinations of the 4 pixels in it.
+    // Index bits 0, 1: upper, lower pixel of the even position, 2, 3: of the odd one.
+    uint32_t pair[ENC_MAX_PLANES][16];
+    const uint32_t *tab = spread_table(cfg);
+    uint32_t s_on = spread(tab, on), s_off = spread(tab, off);
+    for (unsigned pl = 0, s = shift0; pl < n_planes; pl++, s += 3) {
+        uint32_t c1 = (s_on >> s) & 7, c0 = (s_off >> s) & 7;
+        for (unsigned i = 0; i < 16; i++) {
+            uint32_t hi = (i & 1 ? c1 : c0) | (i & 2 ? c1 : c0) << 3;
+            uint32_t lw = (i & 4 ? c1 : c0) | (i & 8 ? c1 : c0) << 3;
+            pair[pl][i] = hi << 16 | lw;
+        }
+    }
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] = (enc_pair_t *)planes[pl];
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (skip_row(p, n_planes, n_pairs, cfg, y))
+            continue;
+        uint32_t lbits = line_bits(y);
+        lbits |= lbits << 16;
+        const uint32_t *up = &bits[y * stride];
+        const uint32_t *lo = &bits[(y + cfg->rows) * stride];
+        // 16 pairs per bitmap word
+        uint32_t u = 0, l = 0;
+        for (unsigned k = 0; k < n_pairs; k++) {
+            if (k % 16 == 0) {
+                u = up[k / 16];
+                l = lo[k / 16];
+            }
+            unsigned i = (u & 1) | (l & 1) << 1 | (u & 2) << 1 | (l & 2) << 2;
+            u >>= 2;
+            l >>= 2;
+            uint32_t c = ctrl[k] | lbits;
+            for (unsigned pl = 0; pl < n_planes; pl++)
+                *p[pl]++ = c | pair[pl][i];
+        }
+    }
+}
+
+// Stretch of DMA word pairs with the same control bits, ends before pair `end`
+typedef struct {
+    unsigned end;
+    uint32_t ctrl;
+} ctrl_seg_t;
+
+// Split the control bits of a row into segments, returns their number
+static unsigned ctrl_segments(ctrl_seg_t *seg, const uint32_t *ctrl, unsigned n_pairs)
+{
+    unsigned n = 0;
+    for (unsigned k = 0; k < n_pairs; k++) {
+        if (n == 0 || ctrl[k] != seg[n - 1].ctrl)
+            seg[n++].ctrl = ctrl[k];
+        seg[n - 1].end = k + 1;
+    }
+    return n;
+}
+
+// Fill pairs [k, e) of a bitplane row with the constant colour bits `v`
+static inline void fill_pairs(
+    enc_pair_t *row, const ctrl_seg_t *seg, unsigned k, unsigned e, uint32_t v
+) {
+    while (seg->end <= k)
+        seg++;
+    for (; k < e; seg++) {
+        unsigned stop = seg->end < e ? seg->end : e;
+        uint32_t w = seg->ctrl | v;
+        for (; k < stop; k++)
+            row[k] = w;
+    }
+}
+
+// shortest run [pairs] worth a fill, shorter ones go through the per pixel path
+#define RUN_MIN 2
+// only the RGB bits take part in encoding
+#define RGB_MASK 0x00FFFFFF
+
+void enc_runs(uint16_t **planes, const void *fb_, const enc_cfg_t *cfg)
+{
+    const uint32_t *fb = fb_;
+    unsigned n_pairs = cfg->width / 2;
+    unsigned n_planes = cfg->n_planes;
+    unsigned shift0 = 3 * (8 - n_planes);
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    ctrl_seg_t seg[ENC_MAX_WIDTH / 2];
+    enc_pair_t *row[ENC_MAX_PLANES];
+
+    const uint32_t *tab = spread_table(cfg);
+    ctrl_pairs(ctrl, cfg);
+    ctrl_segments(seg, ctrl, n_pairs);
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (cfg->skip & 1U << y)
+            continue;
+        uint32_t lbits = line_bits(y);
+        lbits |= lbits << 16;
+        const uint32_t *up = &fb[y * cfg->width];
+        const uint32_t *lo = &fb[(y + cfg->rows) * cfg->width];
+        for (unsigned pl = 0; pl < n_planes; pl++)
+            row[pl] = (enc_pair_t *)planes[pl] + y * n_pairs;
+
+        for (unsigned k = 0; k < n_pairs;) {
+            // find the end of the run of identical upper / lower colour starting at k
+            uint32_t u = up[2 * k] & RGB_MASK, l = lo[2 * k] & RGB_MASK;
+            unsigned e = k;
+            while (e < n_pairs && (
+                ((up[2 * e] ^ u) | (up[2 * e + 1] ^ u) | (lo[2 * e] ^ l) | (lo[2 * e + 1] ^ l)) & RGB_MASK
+            ) == 0)
+                e++;
+
+            if (e - k >= RUN_MIN) {
+                uint32_t su = spread(tab, u), sl = spread(tab, l);
+                for (unsigned pl = 0, s = shift0; pl < n_planes; pl++, s += 3) {
+                    uint32_t code = ((su >> s) & 7) | ((sl >> s) & 7) << 3;
+                    fill_pairs(row[pl], seg, k, e, lbits | code << 16 | code);
+                }
+                k = e;
+                continue;
+            }
+
+            // no run, encode pair by pair up to where the scan stopped
+            if (e == k)
+                e = k + 1;
+            for (; k < e; k++) {
+                uint32_t u0 = spread(tab, up[2 * k]), u1 = spread(tab, up[2 * k + 1]);
+                uint32_t l0 = spread(tab, lo[2 * k]), l1 = spread(tab, lo[2 * k + 1]);
+                uint32_t c = ctrl[k] | lbits;
+                for (unsigned pl = 0, s = shift0; pl < n_planes; pl++, s += 3) {
+                    uint32_t hi = ((u0 >> s) & 7) | ((l0 >> s) & 7) << 3;
+                    uint32_t lw = ((u1 >> s) & 7) | ((l1 >> s) & 7) << 3;
+                    row[pl][k] = c | hi << 16 | lw;
+                }
+            }
+        }
+    }
+}
+
+void enc_rowpair(uint16_t **planes, const void *fb_, const enc_cfg_t *cfg)
+{
+    const uint32_t *src = fb_;
+    unsigned n_pairs = cfg->width / 2;
+    unsigned n_planes = cfg->n_planes;
+    unsigned shift0 = 3 * (8 - n_planes);
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    enc_pair_t *p[ENC_MAX_PLANES];
+
+    const uint32_t *tab = spread_table(cfg);
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] = (enc_pair_t *)planes[pl];
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (skip_row(p, n_planes, n_pairs, cfg, y)) {
+            src += 4 * n_pairs;
+            continue;
+        }
+        uint32_t lbits = line_bits(y);
+        lbits |= lbits << 16;
+        // {upper, lower} of the odd pixel (low half) come first, then the even one
+        for (unsigned k = 0; k < n_pairs; k++, src += 4) {
+            emit_pair(
+                p, n_planes, shift0, ctrl[k] | lbits,
+                spread(tab, src[2]), spread(tab, src[3]), spread(tab, src[0]), spread(tab, src[1])
+            );
+        }
+    }
+}
+
+// 6 bit colour codes (R1 G1 B1 R2 G2 B2) of bitplane bit `b` for 4 pixels, one per byte.
+// The arguments hold the channel bytes of 4 consecutive pixels of the upper / lower half.
+static inline uint32_t planar_codes(
+    uint32_t ru, uint32_t gu, uint32_t bu, uint32_t rl, uint32_t gl, uint32_t bl, unsigned b
+) {
+    const uint32_t k = 0x01010101;
+    return ((ru >> b) & k) | ((gu >> b) & k) << 1 | ((bu >> b) & k) << 2 |
+           ((rl >> b) & k) << 3 | ((gl >> b) & k) << 4 | ((bl >> b) & k) << 5;
+}
+
+typedef uint32_t __attribute__((may_alias)) u32_alias_t;
+
+static inline uint32_t load4(const uint8_t *p, int aligned)
+{
+    if (aligned)
+        return *(const u32_alias_t *)p;
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Map the 4 bytes of v through a code table
+static inline uint32_t code4(uint32_t v, const uint8_t *code)
+{
+    return code[v & 0xFF] | code[(v >> 8) & 0xFF] << 8 | code[(v >> 16) & 0xFF] << 16 | code[v >> 24] << 24;
+}
+
+void enc_planar(uint16_t **planes, const void *fb, const enc_cfg_t *cfg)
+{
+    unsigned width = cfg->width;
+    unsigned n_pix = width * 2 * cfg->rows;
+    unsigned n_planes = cfg->n_planes;
+    const uint8_t *r = fb, *g = r + n_pix, *b = g + n_pix;
+    // rows start 32 bit aligned if the width is a multiple of 4
+    int aligned = (width & 3) == 0;
+    const uint8_t *code = cfg->code;
+    unsigned n_pairs = width / 2;
+    uint32_t ctrl[ENC_MAX_WIDTH / 2];
+    enc_pair_t *p[ENC_MAX_PLANES];
+
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < n_planes; pl++)
+        p[pl] = (enc_pair_t *)planes[pl];
+
+    for (unsigned y = 0; y < cfg->rows; y++) {
+        if (skip_row(p, n_planes, n_pairs, cfg, y))
+            continue;
+        uint32_t lbits = line_bits(y);
+        lbits |= lbits << 16;
+        unsigned iu = y * width, il = (y + cfg->rows) * width;
+        unsigned x = 0;
+
+        for (; x + 4 <= width; x += 4) {
+            uint32_t ru = load4(&r[iu + x], aligned), rl = load4(&r[il + x], aligned);
+            uint32_t gu = load4(&g[iu + x], aligned), gl = load4(&g[il + x], aligned);
+            uint32_t bu = load4(&b[iu + x], aligned), bl = load4(&b[il + x], aligned);
+            uint32_t c0 = ctrl[x / 2] | lbits, c1 = ctrl[x / 2 + 1] | lbits;
+            if (code) {
+                ru = code4(ru, code); rl = code4(rl, code);
+                gu = code4(gu, code); gl = code4(gl, code);
+                bu = code4(bu, code); bl = code4(bl, code);
+            }
+
+            for (unsigned pl = 0; pl < n_planes; pl++) {
+                // byte n of m is the colour code of pixel x + n
+                uint32_t m = planar_codes(ru, gu, bu, rl, gl, bl, 8 - n_planes + pl);
+                *p[pl]++ = c0 | (m & 0xFF) << 16 | ((m >> 8) & 0xFF);
+                *p[pl]++ = c1 | (m & 0x00FF0000) | m >> 24;
+            }
+        }
+        // odd number of pairs, one left
+        if (x < width) {
+            uint32_t ru = r[iu + x] | r[iu + x + 1] << 8, rl = r[il + x] | r[il + x + 1] << 8;
+            uint32_t gu = g[iu + x] | g[iu + x + 1] << 8, gl = g[il + x] | g[il + x + 1] << 8;
+            uint32_t bu = b[iu + x] | b[iu + x + 1] << 8, bl = b[il + x] | b[il + x + 1] << 8;
+            uint32_t c0 = ctrl[x / 2] | lbits;
+            if (code) {
+                ru = code4(ru, code); rl = code4(rl, code);
+                gu = code4(gu, code); gl = code4(gl, code);
+                bu = code4(bu, code); bl = code4(bl, code);
+            }
+
+            for (unsigned pl = 0; pl < n_planes; pl++) {
+                uint32_t m = planar_codes(ru, gu, bu, rl, gl, bl, 8 - n_planes + pl);
+                *p[pl]++ = c0 | (m & 0xFF) << 16 | ((m >> 8) & 0xFF);
+            }
+        }
+    }
+}
+
+unsigned enc_fb_size(const enc_cfg_t *cfg, int fmt)
+{
+    if (fmt == ENC_FMT_PLANAR)
+        return cfg->width * 2 * cfg->rows * 3;
+    return cfg->width * 2 * cfg->rows * sizeof(uint32_t);
+}
+
+// Index of pixel (x, y) in a row pair framebuffer
+static inline unsigned rowpair_index(unsigned x, unsigned y, const enc_cfg_t *cfg)
+{
+    unsigned half = y >= cfg->rows;
+    return 2 * ((x ^ 1) + (y - half * cfg->rows) * cfg->width) + half;
+}
+
+void enc_from_linear(void *dst_, const uint32_t *src, const enc_cfg_t *cfg, int fmt)
+{
+    uint32_t *dst = dst_;
+    unsigned w = cfg->width, h = 2 * cfg->rows;
+
+    if (fmt == ENC_FMT_PLANAR) {
+        uint8_t *r = dst_, *g = r + w * h, *b = g + w * h;
+        for (unsigned i = 0; i < w * h; i++) {
+            r[i] = src[i] >> 16;
+            g[i] = src[i] >> 8;
+            b[i] = src[i];
+        }
+    } else if (fmt == ENC_FMT_ROWPAIR) {
+        for (unsigned y = 0; y < h; y++)
+            for (unsigned x = 0; x < w; x++)
+                dst[rowpair_index(x, y, cfg)] = src[x + y * w];
+    } else {
+        memcpy(dst, src, w * h * sizeof(uint32_t));
+    }
+}
+
+void enc_to_linear(uint32_t *dst, const void *src_, const enc_cfg_t *cfg, int fmt)
+{
+    const uint32_t *src = src_;
+    unsigned w = cfg->width, h = 2 * cfg->rows;
+
+    if (fmt == ENC_FMT_PLANAR) {
+        const uint8_t *r = src_, *g = r + w * h, *b = g + w * h;
+        for (unsigned i = 0; i < w * h; i++)
+            dst[i] = r[i] << 16 | g[i] << 8 | b[i];
+    } else if (fmt == ENC_FMT_ROWPAIR) {
+        for (unsigned y = 0; y < h; y++)
+            for (unsigned x = 0; x < w; x++)
+                dst[x + y * w] = src[rowpair_index(x, y, cfg)];
+    } else {
+        memcpy(dst, src, w * h * sizeof(uint32_t));
+    }
+}
+
+unsigned enc_schedule(uint8_t *order, unsigned n_planes)
+{
+    unsigned n_slots = (1 << n_planes) - 1;
+    int times[ENC_MAX_PLANES] = {0};
+
+    for (unsigned i=0; i<n_slots; i++) {
+        int ch=0;
+        //Find plane that needs insertion the most
+        for (unsigned j=0; j<n_planes; j++) {
+            if (times[j]<=times[ch]) ch=j;
+        }
+        order[i] = ch;
+        //Magic to make sure we choose this bitplane an appropriate time later next time
+        times[ch]+=(1<<(n_planes-ch));
+    }
+    return n_slots;
+}
+
+// Pixel clocks the OE window of brightness `br` is open
+static unsigned oe_clocks(int width, int br)
+{
+    if (br > (width - 2))
+        br = (width - 2);
+    int n = (width + br) / 2 - (width - br) / 2;
+    return n > 0 ? n : 0;
+}
+
+void enc_weights_init(enc_weights_t *w, const enc_cfg_t *cfg, unsigned n_fine, const uint16_t *lum_inv)
+{
+    unsigned n_planes = cfg->n_planes;
+    if (n_fine > n_planes - 1)
+        n_fine = n_planes - 1;
+
+    w->n_planes = n_planes;
+    w->n_slots = 0;
+    for (unsigned pl = 0; pl < n_planes; pl++) {
+        if (pl < n_fine) {
+            w->slots[pl] = 1;
+            w->oe[pl] = cfg->brightness >> (n_fine - pl);
+            if (w->oe[pl] < 1)
+                w->oe[pl] = 1;
+        } else {
+            w->slots[pl] = 1 << (pl - n_fine);
+            w->oe[pl] = cfg->brightness;
+        }
+        w->weight[pl] = w->slots[pl] * oe_clocks(cfg->width, w->oe[pl]);
+        w->n_slots += w->slots[pl];
+    }
+
+    // light output of every plane combination
+    uint32_t sums[1 << ENC_MAX_PLANES];
+    for (unsigned m = 0; m < (1U << n_planes); m++) {
+        sums[m] = 0;
+        for (unsigned pl = 0; pl < n_planes; pl++)
+            if (m & (1 << pl))
+                sums[m] += w->weight[pl];
+    }
+
+    // closest combination to the target, the weights may not be binary after rounding
+    uint32_t full = sums[(1 << n_planes) - 1];
+    uint32_t lum_full = 65535 - lum_inv[255];
+    for (unsigned v = 0; v < 256; v++) {
+        uint64_t target = (uint64_t)(65535 - lum_inv[v]) * full;
+        unsigned best = 0;
+        uint64_t best_err = UINT64_MAX;
+        for (unsigned m = 0; m < (1U << n_planes); m++) {
+            uint64_t s = (uint64_t)sums[m] * lum_full;
+            uint64_t err = s > target ? s - target : target - s;
+            if (err < best_err) {
+                best_err = err;
+                best = m;
+            }
+        }
+        w->code[v] = best << (8 - n_planes);
+    }
+    enc_spread_code(w->spread, w->code);
+}
+
+unsigned enc_schedule_weights(uint8_t *order, const enc_weights_t *w)
+{
+    uint32_t times[ENC_MAX_PLANES] = {0};
+    unsigned cnt[ENC_MAX_PLANES] = {0};
+
+    for (unsigned i = 0; i < w->n_slots; i++) {
+        int ch = -1;
+        //Plane which needs insertion the most and still has slots left
+        for (unsigned j = 0; j < w->n_planes; j++) {
+            if (cnt[j] < w->slots[j] && (ch < 0 || times[j] <= times[ch]))
+                ch = j;
+        }
+        order[i] = ch;
+        cnt[ch]++;
+        //Show it again after 1 / slots of the frame, in 1 / 256 slot units
+        times[ch] += (w->n_slots << 8) / w->slots[ch];
+    }
+    return w->n_slots;
+}
+
+void enc_weights_oe(uint16_t **planes, const enc_cfg_t *cfg, const enc_weights_t *w)
+{
+    unsigned n_pairs = cfg->width / 2;
+    uint32_t ctrl[ENC_MAX_WIDTH / 2], ctrl_pl[ENC_MAX_WIDTH / 2];
+
+    ctrl_pairs(ctrl, cfg);
+    for (unsigned pl = 0; pl < w->n_planes; pl++) {
+        if (w->oe[pl] == cfg->brightness)
+            continue;
+        ctrl_pairs_br(ctrl_pl, cfg->width, w->oe[pl]);
+        // only the pairs around the OE window differ
+        unsigned k0 = 0, k1 = n_pairs;
+        while (k0 < k1 && ctrl[k0] == ctrl_pl[k0])
+            k0++;
+        while (k1 > k0 && ctrl[k1 - 1] == ctrl_pl[k1 - 1])
+            k1--;
+        for (unsigned k = k0; k < k1; k++)
+            ctrl_pl[k] ^= ctrl[k];
+
+        enc_pair_t *p = (enc_pair_t *)planes[pl];
+        for (unsigned y = 0; y < cfg->rows; y++, p += n_pairs) {
+            if (cfg->skip & 1U << y)
+                continue;
+            for (unsigned k = k0; k < k1; k++)
+                p[k] ^= ctrl_pl[k];
+        }
+    }
+}
+
+const enc_variant_t enc_variants[] = {
+    {"reference", enc_reference, ENC_FMT_LINEAR},
+    {"paired", enc_paired, ENC_FMT_LINEAR},
+    {"runs", enc_runs, ENC_FMT_LINEAR},
+    {"rowpair", enc_rowpair, ENC_FMT_ROWPAIR},
+    {"planar", enc_planar, ENC_FMT_PLANAR},
+};
+const unsigned enc_variant_cnt = sizeof(enc_variants) / sizeof(enc_variants[0]);
+
+const enc_variant_t *enc_find(const char *name)
+{
+    for (unsigned i = 0; i < enc_variant_cnt; i++)
+        if (strcmp(enc_variants[i].name, name) == 0)
+            return &enc_variants[i];
+    return NULL;
+}
@@ -0,0 +1,173 @@
+#ifndef ENCODER_H
+#define ENCODER_H
+
+// Converts a framebuffer into the bitplanes which are streamed to the panel by DMA.
+// This file is plain C without any ESP-IDF dependencies, so it builds on the host too.
+
+#include <stdint.h>
+
+// -------------------------------------------
+//  Meaning of the bits in a 16 bit DMA word
+// -------------------------------------------
+//Upper half RGB
+#define BIT_R1 (1<<0)
+#define BIT_G1 (1<<1)
+#define BIT_B1 (1<<2)
+//Lower half RGB
+#define BIT_R2 (1<<3)
+#define BIT_G2 (1<<4)
+#define BIT_B2 (1<<5)
+// -1 = don't care
+// -1
+#define BIT_A (1<<8)
+#define BIT_B (1<<9)
+#define BIT_C (1<<10)
+#define BIT_D (1<<11)
+#define BIT_LAT (1<<12)
+#define BIT_OE_N (1<<13)
+// -1
+// -1
+
+// 16 bit parallel mode - Save the calculated value to the bitplane memory
+// in reverse order to account for I2S Tx FIFO mode1 ordering
+#define ESP32_TX_FIFO_POSITION_ADJUST(x_coord) (((x_coord)&1U) ? (x_coord - 1) : (x_coord + 1))
+
+// Limits of what the encoders support
+#define ENC_MAX_PLANES 8
+#define ENC_MAX_ROWS 16
+#define ENC_MAX_WIDTH 256
+
+// Two DMA words as the I2S FIFO reads them: pixel x + 1 in the low, pixel x in the high half.
+// The bitplanes must be 32 bit aligned for encoders which write these.
+typedef uint32_t __attribute__((may_alias)) enc_pair_t;
+
+// Everything an encoder needs to know to render one frame
+typedef struct {
+    unsigned width;     // pixels per row, must be even, at most ENC_MAX_WIDTH
+    unsigned rows;      // scan rows, the panel is 2 * rows pixels high
+    unsigned n_planes;  // number of bitplanes, 1 .. ENC_MAX_PLANES
+    int brightness;     // width of the OE window in pixel clocks, 0 .. width - 2
+    // Optional table mapping each channel value to the bits the encoder
+    // takes the bitplanes from (enc_weights_t.code), NULL = the value itself
+    const uint8_t *code;
+    // code spread out for the paired encoders (enc_weights_t.spread or
+    // enc_spread_code()), must be set with code
+    const uint32_t *code_spread;
+    // Scan rows (bit y) the bitplanes already hold the encoding of, e.g. rows
+    // which have not changed since the frame last encoded into these buffers.
+    // Encoders and enc_weights_oe() leave them untouched. 0 = encode everything.
+    uint32_t skip;
+} enc_cfg_t;
+
+// Framebuffer memory layouts. Pixels are uint32_t, MSB {x, R, G, B} LSB.
+// Plain defines, so they can be used to select the layout at compile time.
+//   linear:   fb[x + y * width]
+//   row pair: the upper and lower half interleaved in DMA order, pixel (x, y) and
+//             (x, y + rows) are next to each other at fb[2 * ((x ^ 1) + y * width)].
+//             The encoder reads this as a single linear stream.
+//   planar:   structure of arrays, three uint8_t planes R, G and B of width * 2 * rows
+//             bytes each, one after the other. Must be 32 bit aligned.
+#define ENC_FMT_LINEAR 0
+#define ENC_FMT_ROWPAIR 1
+#define ENC_FMT_PLANAR 2
+
+// Renders the framebuffer `fb` (width * 2 * rows pixels) into cfg->n_planes
+// bitplanes of width * rows DMA words each
+typedef void (*enc_fn_t)(uint16_t **planes, const void *fb, const enc_cfg_t *cfg);
+
+typedef struct {
+    const char *name;
+    enc_fn_t fn;
+    int fmt;        // framebuffer layout the encoder reads, ENC_FMT_*
+} enc_variant_t;
+
+// All encoders. Entry 0 is the reference, the others must produce bit-identical output.
+extern const enc_variant_t enc_variants[];
+extern const unsigned enc_variant_cnt;
+
+// Look up a variant by name, NULL if there is none
+const enc_variant_t *enc_find(const char *name);
+
+// Size of a framebuffer in layout `fmt` [bytes]
+unsigned enc_fb_size(const enc_cfg_t *cfg, int fmt);
+
+// Convert a linear framebuffer into layout `fmt` and back
+void enc_from_linear(void *dst, const uint32_t *src, const enc_cfg_t *cfg, int fmt);
+void enc_to_linear(uint32_t *dst, const void *src, const enc_cfg_t *cfg, int fmt);
+
+// Straight forward implementation, the others are checked against this one. Linear layout.
+void enc_reference(uint16_t **planes, const void *fb, const enc_cfg_t *cfg);
+
+// Works on pixel pairs and writes whole 32 bit words in FIFO order, without the per pixel swap.
+// Linear layout.
+void enc_paired(uint16_t **planes, const void *fb, const enc_cfg_t *cfg);
+
+// enc_paired() with a fast path for runs of identical colour: a run is emitted
+// as a constant fill per plane instead of testing bits per pixel. Linear layout.
+void enc_runs(uint16_t **planes, const void *fb, const enc_cfg_t *cfg);
+
+// Encode a low resolution linear frame of (width / sx) x (2 * rows / sy) pixels,
+// scaled up by pixel doubling: sx = 2 writes each pixel into both halves of a
+// DMA word pair, sy = 2 copies a panel row from the previous one. sx, sy are 1 or 2.
+void enc_lowres(
+    uint16_t **planes, const uint32_t *src, unsigned sx, unsigned sy, const enc_cfg_t *cfg
+);
+
+// Encode a 1 bit per pixel bitmap, rows of (width + 31) / 32 words, pixel x in
+// bit x % 32 of word x / 32. Set pixels show colour `on`, clear ones `off`.
+void enc_mono(
+    uint16_t **planes, const uint32_t *bits, uint32_t on, uint32_t off, const enc_cfg_t *cfg
+);
+
+// enc_paired() on a window of a larger linear image (a canvas), src points at its top
+// left pixel and rows are stride pixels apart. With a stage buffer of 2 * width pixels
+// the upper and lower row of each scan row are copied there first, so a source in
+// external RAM is read in sequential bursts. NULL reads the source directly.
+void enc_canvas(
+    uint16_t **planes, const uint32_t *src, unsigned stride, uint32_t *stage, const enc_cfg_t *cfg
+);
+
+// Same as enc_paired(), but reads a row pair framebuffer front to back
+void enc_rowpair(uint16_t **planes, const void *fb, const enc_cfg_t *cfg);
+
+// Reads a planar framebuffer and extracts the bits of 4 pixels at once (SWAR)
+void enc_planar(uint16_t **planes, const void *fb, const enc_cfg_t *cfg);
+
+// Longest bitplane schedule enc_schedule() can produce
+#define ENC_MAX_SLOTS ((1 << ENC_MAX_PLANES) - 1)
+
+// Order in which the bitplanes are sent out. Plane n needs to be shown 2^n times,
+// evenly spread over the frame to stop flicker from happening. Writes the plane
+// index of each DMA slot to `order` and returns the number of slots, 2^n_planes - 1.
+unsigned enc_schedule(uint8_t *order, unsigned n_planes);
+
+// Non-binary bitplane weights, which bake the brightness curve into the timing
+// instead of spending bit depth on a gamma table. The lowest n_fine planes are
+// shown for one slot each with an OE window of brightness / 2, / 4, ...,
+// the others for 1, 2, 4, ... slots with the full window. This adds shadow
+// levels for a few slots of refresh time.
+typedef struct {
+    unsigned n_planes;
+    unsigned n_slots;                   // sum of slots[]
+    uint8_t slots[ENC_MAX_PLANES];      // slots per frame of each plane
+    int oe[ENC_MAX_PLANES];             // OE window of each plane, like enc_cfg_t.brightness
+    uint32_t weight[ENC_MAX_PLANES];    // light output of each plane [OE pixel clocks per frame]
+    uint8_t code[256];                  // channel value -> plane bits, for enc_cfg_t.code
+    uint32_t spread[256];               // code[] for enc_cfg_t.code_spread
+} enc_weights_t;
+
+// Set up the weights for cfg->n_planes planes and cfg->brightness. `lum_inv` is
+// the target brightness curve in the format of lumConvTab (65535 = off), each
+// code[] entry is the plane combination which comes closest to it.
+void enc_weights_init(enc_weights_t *w, const enc_cfg_t *cfg, unsigned n_fine, const uint16_t *lum_inv);
+
+// Fill the enc_cfg_t.code_spread table of code. Once per code table, not per frame.
+void enc_spread_code(uint32_t *spread, const uint8_t *code);
+
+// Like enc_schedule(), but plane n is shown w->slots[n] times. Returns w->n_slots.
+unsigned enc_schedule_weights(uint8_t *order, const enc_weights_t *w);
+
+// Narrow the OE window of the fine planes, run after the encoder
+void enc_weights_oe(uint16_t **planes, const enc_cfg_t *cfg, const enc_weights_t *w);
+
+#endif
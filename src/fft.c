@@ -0,0 +1,124 @@
+#include <stdint.h>
+#include "fft.h"
+
+// (re + j im) * w, w in Q15
+static inline void cmul(int32_t *re, int32_t *im, const int16_t *w)
+{
+    int32_t r = (*re * w[0] - *im * w[1]) >> 15;
+    int32_t i = (*re * w[1] + *im * w[0]) >> 15;
+    *re = r;
+    *im = i;
+}
+
+// Decimation in frequency radix-4 stages on n complex samples, sub-transforms of
+// length L = n, n / 4, .. 4. Quarter q of each sub-transform gets the bins 4 k + q.
+static void radix4(int16_t *x, unsigned n)
+{
+    for (unsigned len = n; len >= 4; len /= 4) {
+        unsigned q = len / 4, s = FFT_N / len;
+        for (unsigned g = 0; g < n; g += len) {
+            for (unsigned j = 0; j < q; j++) {
+                int16_t *p0 = &x[2 * (g + j)], *p1 = p0 + 2 * q, *p2 = p1 + 2 * q, *p3 = p2 + 2 * q;
+                int32_t t0r = p0[0] + p2[0], t0i = p0[1] + p2[1];
+                int32_t t1r = p0[0] - p2[0], t1i = p0[1] - p2[1];
+                int32_t t2r = p1[0] + p3[0], t2i = p1[1] + p3[1];
+                int32_t t3r = p1[0] - p3[0], t3i = p1[1] - p3[1];
+
+                int32_t y0r = (t0r + t2r) >> 2, y0i = (t0i + t2i) >> 2;
+                int32_t y1r = (t1r + t3i) >> 2, y1i = (t1i - t3r) >> 2;    // t1 - j t3
+                int32_t y2r = (t0r - t2r) >> 2, y2i = (t0i - t2i) >> 2;
+                int32_t y3r = (t1r - t3i) >> 2, y3i = (t1i + t3r) >> 2;    // t1 + j t3
+                if (j) {
+                    cmul(&y1r, &y1i, fft_twiddle[j * s]);
+                    cmul(&y2r, &y2i, fft_twiddle[2 * j * s]);
+                    cmul(&y3r, &y3i, fft_twiddle[3 * j * s]);
+                }
+                p0[0] = y0r; p0[1] = y0i;
+                p1[0] = y1r; p1[1] = y1i;
+                p2[0] = y2r; p2[1] = y2i;
+                p3[0] = y3r; p3[1] = y3i;
+            }
+        }
+    }
+}
+
+void fft_q15(int16_t *x)
+{
+    // Radix-2 split: sums give the even bins, twiddled differences the odd ones
+    const unsigned h = FFT_N / 2;
+    for (unsigned j = 0; j < h; j++) {
+        int16_t *a = &x[2 * j], *b = &x[2 * (j + h)];
+        int32_t dr = (a[0] - b[0]) >> 1, di = (a[1] - b[1]) >> 1;
+        a[0] = (a[0] + b[0]) >> 1;
+        a[1] = (a[1] + b[1]) >> 1;
+        cmul(&dr, &di, fft_twiddle[j]);
+        b[0] = dr;
+        b[1] = di;
+    }
+    radix4(x, h);
+    radix4(x + 2 * h, h);
+}
+
+#ifdef FFT_MAIN
+// Random inputs and pure tones against a double precision DFT
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "host_util.h"
+
+static double check(const int16_t *in)
+{
+    int16_t x[2 * FFT_N];
+    for (unsigned i = 0; i < 2 * FFT_N; i++)
+        x[i] = in[i];
+    fft_q15(x);
+
+    double err = 0;
+    for (unsigned k = 0; k < FFT_N / 2; k++) {
+        double re = 0, im = 0;
+        for (unsigned i = 0; i < FFT_N; i++) {
+            double a = -2 * M_PI * (double)k * i / FFT_N;
+            re += in[2 * i] * cos(a) - in[2 * i + 1] * sin(a);
+            im += in[2 * i] * sin(a) + in[2 * i + 1] * cos(a);
+        }
+        const int16_t *y = &x[2 * fft_pos[k]];
+        double e = hypot(y[0] - re / FFT_N, y[1] - im / FFT_N);
+        if (e > err)
+            err = e;
+    }
+    return err;
+}
+
+int main(void)
+{
+    int16_t in[2 * FFT_N];
+    double err_max = 0;
+    for (int n = 0; n < 20; n++) {
+        for (unsigned i = 0; i < FFT_N; i++) {
+            // complex samples of length <= 32767
+            double a = 2 * M_PI * rnd() / UINT32_MAX, r = 23170.0 * rnd() / UINT32_MAX;
+            if (n >= 10) {
+                // tone of a random frequency, imaginary part 0
+                a = 0;
+                r = 32000 * cos(2 * M_PI * (n * 7.3) * i / FFT_N);
+            }
+            in[2 * i] = r * cos(a);
+            in[2 * i + 1] = r * sin(a);
+        }
+        double e = check(in);
+        if (e > err_max)
+            err_max = e;
+    }
+    printf("FFT %d: max error %.2f LSB of the scaled output\n", FFT_N, err_max);
+
+    int16_t x[2 * FFT_N];
+    double t0 = cpu_us();
+    for (int n = 0; n < 10000; n++) {
+        for (unsigned i = 0; i < 2 * FFT_N; i++)
+            x[i] = in[i];
+        fft_q15(x);
+    }
+    printf("%.2f us per FFT (incl. copy)\n", (cpu_us() - t0) / 10000);
+    return err_max > 8;
+}
+#endif
@@ -0,0 +1,33 @@
+#ifndef FFT_H
+#define FFT_H
+
+// Fixed point FFT of FFT_N complex Q15 samples: one radix-2 stage splitting
+// the input into even and odd bins, then radix-4 stages on both halves. Each
+// stage scales by 1 / radix, so the output is the DFT / FFT_N and can't
+// overflow as long as no input sample is longer than 32767.
+//
+// The twiddle factors, the analysis window and the output order come from
+// tables in src/fft_tab.c, generated by tools/fftgen.c:
+//   gcc -O2 -Isrc -o fftgen tools/fftgen.c -lm && ./fftgen > src/fft_tab.c
+// Checking against a double precision DFT on the host:
+//   gcc -O2 -DFFT_MAIN -Isrc -o fft src/fft.c src/fft_tab.c -lm && ./fft
+
+#include <stdint.h>
+
+// FFT size, 2 * 4^n. Changing it needs the tables generated again.
+#define FFT_N 512
+
+// e^(-2 pi i m / FFT_N) for m < 3 FFT_N / 4, {re, im} in Q15
+extern const int16_t fft_twiddle[3 * FFT_N / 4][2];
+
+// First half of a Hann window, Q15, the second half mirrors it
+extern const int16_t fft_window[FFT_N / 2];
+
+// Where bin k ends up in the output of fft_q15(), for k < FFT_N / 2
+extern const uint16_t fft_pos[FFT_N / 2];
+
+// In place FFT of x[2 * i] + j x[2 * i + 1]. The bins come out in mixed digit
+// reversed order, bin k is at x[2 * fft_pos[k]].
+void fft_q15(int16_t *x);
+
+#endif
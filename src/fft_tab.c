@@ -0,0 +1,92 @@
+//Auto-generated by tools/fftgen.c
+#include <stdint.h>
+#include "fft.h"
+
+const int16_t fft_twiddle[3 * FFT_N / 4][2]={
+    {32767,0},{32766,-402},{32758,-804},{32746,-1206},{32729,-1608},{32706,-2009},{32679,-2411},{32647,-2811},
+    {32610,-3212},{32568,-3612},{32522,-4011},{32470,-4410},{32413,-4808},{32352,-5205},{32286,-5602},{32214,-5998},
+    {32138,-6393},{32058,-6787},{31972,-7180},{31881,-7571},{31786,-7962},{31686,-8351},{31581,-8740},{31471,-9127},
+    {31357,-9512},{31238,-9896},{31114,-10279},{30986,-10660},{30853,-11039},{30715,-11417},{30572,-11793},{30425,-12167},
+    {30274,-12540},{30118,-12910},{29957,-13279},{29792,-13646},{29622,-14010},{29448,-14373},{29269,-14733},{29086,-15091},
+    {28899,-15447},{28707,-15800},{28511,-16151},{28311,-16500},{28106,-16846},{27897,-17190},{27684,-17531},{27467,-17869},
+    {27246,-18205},{27020,-18538},{26791,-18868},{26557,-19195},{26320,-19520},{26078,-19841},{25833,-20160},{25583,-20475},
+    {25330,-20788},{25073,-21097},{24812,-21403},{24548,-21706},{24279,-22006},{24008,-22302},{23732,-22595},{23453,-22884},
+    {23170,-23170},{22884,-23453},{22595,-23732},{22302,-24008},{22006,-24279},{21706,-24548},{21403,-24812},{21097,-25073},
+    {20788,-25330},{20475,-25583},{20160,-25833},{19841,-26078},{19520,-26320},{19195,-26557},{18868,-26791},{18538,-27020},
+    {18205,-27246},{17869,-27467},{17531,-27684},{17190,-27897},{16846,-28106},{16500,-28311},{16151,-28511},{15800,-28707},
+    {15447,-28899},{15091,-29086},{14733,-29269},{14373,-29448},{14010,-29622},{13646,-29792},{13279,-29957},{12910,-30118},
+    {12540,-30274},{12167,-30425},{11793,-30572},{11417,-30715},{11039,-30853},{10660,-30986},{10279,-31114},{9896,-31238},
+    {9512,-31357},{9127,-31471},{8740,-31581},{8351,-31686},{7962,-31786},{7571,-31881},{7180,-31972},{6787,-32058},
+    {6393,-32138},{5998,-32214},{5602,-32286},{5205,-32352},{4808,-32413},{4410,-32470},{4011,-32522},{3612,-32568},
+    {3212,-32610},{2811,-32647},{2411,-32679},{2009,-32706},{1608,-32729},{1206,-32746},{804,-32758},{402,-32766},
+    {0,-32768},{-402,-32766},{-804,-32758},{-1206,-32746},{-1608,-32729},{-2009,-32706},{-2411,-32679},{-2811,-32647},
+    {-3212,-32610},{-3612,-32568},{-4011,-32522},{-4410,-32470},{-4808,-32413},{-5205,-32352},{-5602,-32286},{-5998,-32214},
+    {-6393,-32138},{-6787,-32058},{-7180,-31972},{-7571,-31881},{-7962,-31786},{-8351,-31686},{-8740,-31581},{-9127,-31471},
+    {-9512,-31357},{-9896,-31238},{-10279,-31114},{-10660,-30986},{-11039,-30853},{-11417,-30715},{-11793,-30572},{-12167,-30425},
+    {-12540,-30274},{-12910,-30118},{-13279,-29957},{-13646,-29792},{-14010,-29622},{-14373,-29448},{-14733,-29269},{-15091,-29086},
+    {-15447,-28899},{-15800,-28707},{-16151,-28511},{-16500,-28311},{-16846,-28106},{-17190,-27897},{-17531,-27684},{-17869,-27467},
+    {-18205,-27246},{-18538,-27020},{-18868,-26791},{-19195,-26557},{-19520,-26320},{-19841,-26078},{-20160,-25833},{-20475,-25583},
+    {-20788,-25330},{-21097,-25073},{-21403,-24812},{-21706,-24548},{-22006,-24279},{-22302,-24008},{-22595,-23732},{-22884,-23453},
+    {-23170,-23170},{-23453,-22884},{-23732,-22595},{-24008,-22302},{-24279,-22006},{-24548,-21706},{-24812,-21403},{-25073,-21097},
+    {-25330,-20788},{-25583,-20475},{-25833,-20160},{-26078,-19841},{-26320,-19520},{-26557,-19195},{-26791,-18868},{-27020,-18538},
+    {-27246,-18205},{-27467,-17869},{-27684,-17531},{-27897,-17190},{-28106,-16846},{-28311,-16500},{-28511,-16151},{-28707,-15800},
+    {-28899,-15447},{-29086,-15091},{-29269,-14733},{-29448,-14373},{-29622,-14010},{-29792,-13646},{-29957,-13279},{-30118,-12910},
+    {-30274,-12540},{-30425,-12167},{-30572,-11793},{-30715,-11417},{-30853,-11039},{-30986,-10660},{-31114,-10279},{-31238,-9896},
+    {-31357,-9512},{-31471,-9127},{-31581,-8740},{-31686,-8351},{-31786,-7962},{-31881,-7571},{-31972,-7180},{-32058,-6787},
+    {-32138,-6393},{-32214,-5998},{-32286,-5602},{-32352,-5205},{-32413,-4808},{-32470,-4410},{-32522,-4011},{-32568,-3612},
+    {-32610,-3212},{-32647,-2811},{-32679,-2411},{-32706,-2009},{-32729,-1608},{-32746,-1206},{-32758,-804},{-32766,-402},
+    {-32768,0},{-32766,402},{-32758,804},{-32746,1206},{-32729,1608},{-32706,2009},{-32679,2411},{-32647,2811},
+    {-32610,3212},{-32568,3612},{-32522,4011},{-32470,4410},{-32413,4808},{-32352,5205},{-32286,5602},{-32214,5998},
+    {-32138,6393},{-32058,6787},{-31972,7180},{-31881,7571},{-31786,7962},{-31686,8351},{-31581,8740},{-31471,9127},
+    {-31357,9512},{-31238,9896},{-31114,10279},{-30986,10660},{-30853,11039},{-30715,11417},{-30572,11793},{-30425,12167},
+    {-30274,12540},{-30118,12910},{-29957,13279},{-29792,13646},{-29622,14010},{-29448,14373},{-29269,14733},{-29086,15091},
+    {-28899,15447},{-28707,15800},{-28511,16151},{-28311,16500},{-28106,16846},{-27897,17190},{-27684,17531},{-27467,17869},
+    {-27246,18205},{-27020,18538},{-26791,18868},{-26557,19195},{-26320,19520},{-26078,19841},{-25833,20160},{-25583,20475},
+    {-25330,20788},{-25073,21097},{-24812,21403},{-24548,21706},{-24279,22006},{-24008,22302},{-23732,22595},{-23453,22884},
+    {-23170,23170},{-22884,23453},{-22595,23732},{-22302,24008},{-22006,24279},{-21706,24548},{-21403,24812},{-21097,25073},
+    {-20788,25330},{-20475,25583},{-20160,25833},{-19841,26078},{-19520,26320},{-19195,26557},{-18868,26791},{-18538,27020},
+    {-18205,27246},{-17869,27467},{-17531,27684},{-17190,27897},{-16846,28106},{-16500,28311},{-16151,28511},{-15800,28707},
+    {-15447,28899},{-15091,29086},{-14733,29269},{-14373,29448},{-14010,29622},{-13646,29792},{-13279,29957},{-12910,30118},
+    {-12540,30274},{-12167,30425},{-11793,30572},{-11417,30715},{-11039,30853},{-10660,30986},{-10279,31114},{-9896,31238},
+    {-9512,31357},{-9127,31471},{-8740,31581},{-8351,31686},{-7962,31786},{-7571,31881},{-7180,31972},{-6787,32058},
+    {-6393,32138},{-5998,32214},{-5602,32286},{-5205,32352},{-4808,32413},{-4410,32470},{-4011,32522},{-3612,32568},
+    {-3212,32610},{-2811,32647},{-2411,32679},{-2009,32706},{-1608,32729},{-1206,32746},{-804,32758},{-402,32766},
+};
+
+const int16_t fft_window[FFT_N / 2]={
+    0,1,5,11,20,31,45,61,79,100,124,150,178,209,242,278,
+    316,357,400,445,493,543,596,651,708,768,830,895,961,1031,1102,1176,
+    1252,1330,1411,1494,1579,1667,1756,1848,1942,2038,2137,2237,2340,2445,2552,2661,
+    2772,2885,3000,3117,3236,3358,3481,3606,3733,3862,3993,4126,4260,4397,4535,4675,
+    4817,4960,5105,5252,5401,5551,5703,5857,6012,6169,6327,6487,6648,6811,6975,7141,
+    7308,7476,7646,7817,7989,8163,8338,8514,8691,8870,9049,9230,9412,9595,9778,9963,
+    10149,10336,10523,10712,10901,11092,11283,11475,11667,11860,12054,12249,12444,12640,12836,13033,
+    13231,13429,13627,13826,14025,14225,14425,14625,14825,15026,15227,15428,15629,15830,16031,16233,
+    16434,16636,16837,17039,17240,17441,17642,17843,18043,18243,18443,18643,18843,19041,19240,19438,
+    19636,19833,20030,20226,20421,20616,20811,21004,21197,21389,21581,21772,21961,22150,22338,22526,
+    22712,22897,23082,23265,23447,23629,23809,23988,24166,24342,24518,24692,24865,25037,25207,25376,
+    25544,25710,25875,26039,26201,26361,26520,26678,26834,26988,27141,27292,27442,27589,27735,27880,
+    28023,28163,28303,28440,28575,28709,28841,28971,29099,29225,29349,29471,29591,29710,29826,29940,
+    30052,30162,30270,30376,30480,30581,30681,30778,30873,30966,31057,31145,31232,31316,31398,31477,
+    31554,31629,31702,31772,31840,31906,31969,32030,32089,32145,32199,32250,32299,32346,32390,32432,
+    32471,32508,32543,32575,32604,32632,32656,32679,32698,32716,32731,32743,32753,32760,32765,32767,
+};
+
+const uint16_t fft_pos[FFT_N / 2]={
+    0,256,64,320,128,384,192,448,16,272,80,336,144,400,208,464,
+    32,288,96,352,160,416,224,480,48,304,112,368,176,432,240,496,
+    4,260,68,324,132,388,196,452,20,276,84,340,148,404,212,468,
+    36,292,100,356,164,420,228,484,52,308,116,372,180,436,244,500,
+    8,264,72,328,136,392,200,456,24,280,88,344,152,408,216,472,
+    40,296,104,360,168,424,232,488,56,312,120,376,184,440,248,504,
+    12,268,76,332,140,396,204,460,28,284,92,348,156,412,220,476,
+    44,300,108,364,172,428,236,492,60,316,124,380,188,444,252,508,
+    1,257,65,321,129,385,193,449,17,273,81,337,145,401,209,465,
+    33,289,97,353,161,417,225,481,49,305,113,369,177,433,241,497,
+    5,261,69,325,133,389,197,453,21,277,85,341,149,405,213,469,
+    37,293,101,357,165,421,229,485,53,309,117,373,181,437,245,501,
+    9,265,73,329,137,393,201,457,25,281,89,345,153,409,217,473,
+    41,297,105,361,169,425,233,489,57,313,121,377,185,441,249,505,
+    13,269,77,333,141,397,205,461,29,285,93,349,157,413,221,477,
+    45,301,109,365,173,429,237,493,61,317,125,381,189,445,253,509,
+};
@@ -0,0 +1,35 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "framebuf.h"
+
+#if FB_LAYOUT == ENC_FMT_PLANAR
+uint8_t framebuf[3][FB_PIXELS] __attribute__((aligned(4)));
+#else
+uint32_t framebuf[FB_PIXELS];
+#endif
+
+static const enc_cfg_t fb_geometry = {
+    .width = DISPLAY_WIDTH,
+    .rows = DISPLAY_HEIGHT / 2,
+};
+
+void fb_load(const uint32_t *src)
+{
+    enc_from_linear(framebuf, src, &fb_geometry, FB_LAYOUT);
+}
+
+const uint32_t *fb_linear(void)
+{
+#if FB_LAYOUT == ENC_FMT_LINEAR
+    return framebuf;
+#else
+    static uint32_t *scratch = NULL;
+    if (!scratch) {
+        scratch = malloc(FB_PIXELS * sizeof(uint32_t));
+        assert(scratch && "Can't allocate scratch frame");
+    }
+    enc_to_linear(scratch, framebuf, &fb_geometry, FB_LAYOUT);
+    return scratch;
+#endif
+}
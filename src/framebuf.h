@@ -0,0 +1,104 @@
+#ifndef FRAMEBUF_H
+#define FRAMEBUF_H
+
+// The framebuffer everything draws into and the primitives to access it.
+// Pixels are in the format MSB {x, R, G, B} LSB.
+
+#include <stdint.h>
+#include <string.h>
+#include "encoder.h"
+
+#define DISPLAY_WIDTH  128
+#define DISPLAY_HEIGHT  32
+
+// Memory layout of framebuf, one of the ENC_FMT_* in encoder.h. Can be overridden with a build flag.
+//   ENC_FMT_ROWPAIR stores the upper and lower half interleaved in DMA order,
+//                   so the encoder reads it front to back.
+//   ENC_FMT_PLANAR  stores R, G and B as separate byte planes, framebuf[channel][x + y * DISPLAY_WIDTH]
+#ifndef FB_LAYOUT
+#define FB_LAYOUT ENC_FMT_LINEAR
+#endif
+
+#define FB_PIXELS (DISPLAY_WIDTH * DISPLAY_HEIGHT)
+
+#if FB_LAYOUT == ENC_FMT_PLANAR
+extern uint8_t framebuf[3][FB_PIXELS];
+#else
+extern uint32_t framebuf[FB_PIXELS];
+#endif
+
+static inline unsigned fb_index(unsigned x, unsigned y)
+{
+#if FB_LAYOUT == ENC_FMT_ROWPAIR
+    unsigned half = y >= DISPLAY_HEIGHT / 2;
+    return 2 * ((x ^ 1) + (y - half * DISPLAY_HEIGHT / 2) * DISPLAY_WIDTH) + half;
+#else
+    return x + y * DISPLAY_WIDTH;
+#endif
+}
+
+// Pixel at framebuf index i, see fb_index()
+static inline uint32_t fb_get(unsigned i)
+{
+#if FB_LAYOUT == ENC_FMT_PLANAR
+    return framebuf[0][i] << 16 | framebuf[1][i] << 8 | framebuf[2][i];
+#else
+    return framebuf[i];
+#endif
+}
+
+static inline void fb_set(unsigned i, uint32_t col)
+{
+#if FB_LAYOUT == ENC_FMT_PLANAR
+    framebuf[0][i] = col >> 16;
+    framebuf[1][i] = col >> 8;
+    framebuf[2][i] = col;
+#else
+    framebuf[i] = col;
+#endif
+}
+
+static inline uint32_t getPixel(unsigned x, unsigned y)
+{
+    return fb_get(fb_index(x, y));
+}
+
+// col is in format: MSB {x, R, G, B} LSB
+static inline void setPixel(unsigned x, unsigned y, unsigned col)
+{
+    fb_set(fb_index(x, y), col);
+}
+
+// set all pixels of a layer to a color
+static inline void setAll(unsigned col)
+{
+#if FB_LAYOUT == ENC_FMT_PLANAR
+    memset(framebuf[0], (col >> 16) & 0xFF, FB_PIXELS);
+    memset(framebuf[1], (col >> 8) & 0xFF, FB_PIXELS);
+    memset(framebuf[2], col & 0xFF, FB_PIXELS);
+#else
+    for (int i = 0; i < FB_PIXELS; i++)
+        framebuf[i] = col;
+#endif
+}
+
+// Scan rows of the panel, bit y stands for display rows y and y + DISPLAY_HEIGHT / 2.
+// Used to tell the encoder which rows changed (enc_cfg_t.skip).
+#define FB_ROWS_ALL ((1U << (DISPLAY_HEIGHT / 2)) - 1)
+
+// Scan rows covering display rows [y0, y1)
+static inline uint32_t fb_row_mask(unsigned y0, unsigned y1)
+{
+    uint32_t m = 0;
+    for (unsigned y = y0; y < y1 && m != FB_ROWS_ALL; y++)
+        m |= 1U << (y % (DISPLAY_HEIGHT / 2));
+    return m;
+}
+
+// Copy a linear DISPLAY_WIDTH x DISPLAY_HEIGHT frame into framebuf
+void fb_load(const uint32_t *src);
+
+// framebuf as a linear frame, converted into a scratch buffer if needed
+const uint32_t *fb_linear(void);
+
+#endif
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "framerec.h"
+
+#define RGB_MASK 0x00FFFFFF
+// unchanged gaps up to this length are sent as pixels, cheaper than starting a new run
+#define MAX_GAP 1
+
+static int put_varint(framerec_t *r, uint32_t v)
+{
+    do {
+        uint8_t b = v & 0x7F;
+        v >>= 7;
+        if (v)
+            b |= 0x80;
+        if (fputc(b, r->f) == EOF)
+            return -1;
+        r->n_bytes++;
+    } while (v);
+    return 0;
+}
+
+// returns -1 on error, 1 on a clean end of file before the first byte
+static int get_varint(framerec_t *r, uint32_t *v)
+{
+    *v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        int b = fgetc(r->f);
+        if (b == EOF)
+            return (shift == 0 && feof(r->f)) ? 1 : -1;
+        r->n_bytes++;
+        *v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            return 0;
+    }
+    return -1;
+}
+
+static int init(framerec_t *r, FILE *f, unsigned width, unsigned height)
+{
+    r->f = f;
+    r->width = width;
+    r->height = height;
+    r->t_last = 0;
+    r->n_frames = 0;
+    r->n_bytes = 0;
+    r->prev = calloc(width * height, sizeof(uint32_t));
+    return r->prev ? 0 : -1;
+}
+
+int framerec_open_write(framerec_t *r, FILE *f, unsigned width, unsigned height)
+{
+    uint8_t hdr[9] = {
+        'F', 'R', 'E', 'C', FRAMEREC_VERSION,
+        width & 0xFF, width >> 8, height & 0xFF, height >> 8
+    };
+    if (init(r, f, width, height))
+        return -1;
+    if (fwrite(hdr, sizeof(hdr), 1, f) != 1)
+        return -1;
+    return 0;
+}
+
+int framerec_write(framerec_t *r, const uint32_t *fb, int64_t t_us)
+{
+    unsigned n = r->width * r->height;
+    uint32_t dt = (r->n_frames == 0 || t_us < r->t_last) ? 0 : t_us - r->t_last;
+    r->t_last = t_us;
+
+    // First pass counts the runs, second pass writes them
+    for (int pass = 0; pass < 2; pass++) {
+        unsigned n_runs = 0, last = 0;
+        for (unsigned i = 0; i < n;) {
+            if (((fb[i] ^ r->prev[i]) & RGB_MASK) == 0) {
+                i++;
+                continue;
+            }
+            // extend the run over changed pixels and short unchanged gaps
+            unsigned start = i, end = i + 1, gap = 0;
+            for (i++; i < n && gap <= MAX_GAP; i++) {
+                if ((fb[i] ^ r->prev[i]) & RGB_MASK) {
+                    end = i + 1;
+                    gap = 0;
+                } else {
+                    gap++;
+                }
+            }
+            i = end;
+            n_runs++;
+            if (pass == 0)
+                continue;
+
+            if (put_varint(r, start - last) || put_varint(r, end - start))
+                return -1;
+            for (unsigned j = start; j < end; j++) {
+                uint8_t rgb[3] = {fb[j] >> 16, fb[j] >> 8, fb[j]};
+                if (fwrite(rgb, 3, 1, r->f) != 1)
+                    return -1;
+                r->prev[j] = fb[j] & RGB_MASK;
+            }
+            r->n_bytes += 3 * (end - start);
+            last = end;
+        }
+        if (pass == 0 && (put_varint(r, dt) || put_varint(r, n_runs)))
+            return -1;
+    }
+    r->n_frames++;
+    return 0;
+}
+
+int framerec_open_read(framerec_t *r, FILE *f)
+{
+    uint8_t hdr[9];
+    r->prev = NULL;
+    if (fread(hdr, sizeof(hdr), 1, f) != 1)
+        return -1;
+    if (memcmp(hdr, "FREC", 4) || hdr[4] != FRAMEREC_VERSION)
+        return -1;
+    return init(r, f, hdr[5] | hdr[6] << 8, hdr[7] | hdr[8] << 8);
+}
+
+int framerec_read(framerec_t *r, uint32_t *fb, uint32_t *dt_us)
+{
+    unsigned n = r->width * r->height;
+    uint32_t n_runs, pos = 0;
+
+    int ret = get_varint(r, dt_us);
+    if (ret)
+        return ret;
+    if (get_varint(r, &n_runs))
+        return -1;
+
+    while (n_runs--) {
+        uint32_t skip, len;
+        if (get_varint(r, &skip) || get_varint(r, &len))
+            return -1;
+        if (skip > n || len > n || pos + skip + len > n)
+            return -1;
+        pos += skip;
+        for (uint32_t j = pos; j < pos + len; j++) {
+            uint8_t rgb[3];
+            if (fread(rgb, 3, 1, r->f) != 1)
+                return -1;
+            r->prev[j] = rgb[0] << 16 | rgb[1] << 8 | rgb[2];
+        }
+        r->n_bytes += 3 * len;
+        pos += len;
+    }
+    memcpy(fb, r->prev, n * sizeof(uint32_t));
+    r->n_frames++;
+    return 0;
+}
+
+void framerec_close(framerec_t *r)
+{
+    free(r->prev);
+    r->prev = NULL;
+}
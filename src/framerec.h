@@ -0,0 +1,47 @@
+#ifndef FRAMEREC_H
+#define FRAMEREC_H
+
+// Records a stream of framebuffers with timestamps into a compact file and
+// reads it back for replay. Only stdio is used, so it works on the host as well
+// as on any ESP-IDF VFS path.
+//
+// File format, all integers little endian:
+//   header: "FREC", u8 version, u16 width, u16 height
+//   frame:  varint dt_us (time since the previous frame), varint n_runs,
+//           n_runs * {varint skip, varint len, len * {R, G, B}}
+// Each frame only stores the pixel runs which changed since the previous one.
+// The x byte of the framebuffer words is not recorded.
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define FRAMEREC_VERSION 1
+
+typedef struct {
+    FILE *f;
+    unsigned width, height;
+    uint32_t *prev;     // previous frame, the delta is relative to it
+    int64_t t_last;     // timestamp of the previous frame [us], writer only
+    unsigned n_frames;
+    size_t n_bytes;     // payload bytes written / read so far
+} framerec_t;
+
+// All functions return 0 on success and -1 on error (I/O or a malformed file)
+
+// Start a recording of width x height frames into `f`
+int framerec_open_write(framerec_t *r, FILE *f, unsigned width, unsigned height);
+
+// Append the frame `fb`, submitted at time `t_us`
+int framerec_write(framerec_t *r, const uint32_t *fb, int64_t t_us);
+
+// Read the header of a recording, sets r->width and r->height
+int framerec_open_read(framerec_t *r, FILE *f);
+
+// Read the next frame into `fb` (width * height words, x byte cleared) and the
+// time since the previous one into `dt_us`. Returns 1 at the end of the recording.
+int framerec_read(framerec_t *r, uint32_t *fb, uint32_t *dt_us);
+
+// Release the state, does not close the file
+void framerec_close(framerec_t *r);
+
+#endif
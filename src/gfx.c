@@ -0,0 +1,294 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include "framebuf.h"
+#include "gfx.h"
+
+#define FRAC_MASK (GFX_ONE - 1)
+#define MAX_X (DISPLAY_WIDTH << GFX_FRAC)
+
+void gfx_blend(int x, int y, uint32_t col, unsigned a)
+{
+    if (x < 0 || x >= DISPLAY_WIDTH || y < 0 || y >= DISPLAY_HEIGHT || a == 0)
+        return;
+    if (a >= 256) {
+        setPixel(x, y, col);
+        return;
+    }
+    uint32_t old = getPixel(x, y), out = 0;
+    for (int s = 0; s < 24; s += 8) {
+        int c0 = (old >> s) & 0xFF, c1 = (col >> s) & 0xFF;
+        out |= (uint32_t)(c0 + (((c1 - c0) * (int)a) >> 8)) << s;
+    }
+    setPixel(x, y, out);
+}
+
+// ------
+//  Lines
+// ------
+static inline void plot(int x, int y, int steep, uint32_t col, unsigned a)
+{
+    if (steep)
+        gfx_blend(y, x, col, a);
+    else
+        gfx_blend(x, y, col, a);
+}
+
+void gfx_line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t col)
+{
+    int32_t t;
+    // Wu's algorithm has the pixel centres on integer coordinates
+    x0 -= GFX_ONE / 2; y0 -= GFX_ONE / 2;
+    x1 -= GFX_ONE / 2; y1 -= GFX_ONE / 2;
+
+    int steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
+    if (x0 > x1) {
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+    int32_t dx = x1 - x0, dy = y1 - y0;
+    // slope with 16 fractional bits
+    int32_t grad = dx ? (int32_t)(((int64_t)dy << 16) / dx) : 1 << 16;
+
+    // first end point, y has 16 fractional bits from here on
+    int32_t xe = (x0 + GFX_ONE / 2) & ~FRAC_MASK;
+    int32_t ye = (y0 << (16 - GFX_FRAC)) + (int32_t)(((int64_t)grad * (xe - x0)) >> GFX_FRAC);
+    unsigned gap = GFX_ONE - ((x0 + GFX_ONE / 2) & FRAC_MASK);
+    int xp0 = xe >> GFX_FRAC;
+    unsigned f = (ye >> 8) & 0xFF;
+    plot(xp0, ye >> 16, steep, col, ((256 - f) * gap) >> GFX_FRAC);
+    plot(xp0, (ye >> 16) + 1, steep, col, (f * gap) >> GFX_FRAC);
+    int32_t yi = ye + grad;
+
+    // second end point
+    xe = (x1 + GFX_ONE / 2) & ~FRAC_MASK;
+    ye = (y1 << (16 - GFX_FRAC)) + (int32_t)(((int64_t)grad * (xe - x1)) >> GFX_FRAC);
+    gap = (x1 + GFX_ONE / 2) & FRAC_MASK;
+    int xp1 = xe >> GFX_FRAC;
+    if (xp1 != xp0) {
+        f = (ye >> 8) & 0xFF;
+        plot(xp1, ye >> 16, steep, col, ((256 - f) * gap) >> GFX_FRAC);
+        plot(xp1, (ye >> 16) + 1, steep, col, (f * gap) >> GFX_FRAC);
+    }
+
+    // the pixel pairs in between
+    for (int x = xp0 + 1; x < xp1; x++, yi += grad) {
+        f = (yi >> 8) & 0xFF;
+        plot(x, yi >> 16, steep, col, 256 - f);
+        plot(x, (yi >> 16) + 1, steep, col, f);
+    }
+}
+
+// -------------------------
+//  Span coverage rasteriser
+// -------------------------
+// Coverage of the current pixel row. Each sub-scanline adds up to GFX_ONE per
+// pixel: span ends go into cov[], fully covered runs into run[] as +/- at
+// their start / end, summed up when the row is written out.
+static int32_t cov[DISPLAY_WIDTH + 1];
+static int32_t run[DISPLAY_WIDTH + 1];
+static int row_x0, row_x1;
+
+#define SUB_SHIFT (__builtin_ctz(GFX_SUB))
+
+// Add the span [xa, xb) of one sub-scanline
+static void span(int32_t xa, int32_t xb)
+{
+    if (xa < 0)
+        xa = 0;
+    if (xb > MAX_X)
+        xb = MAX_X;
+    if (xa >= xb)
+        return;
+    int ia = xa >> GFX_FRAC, ib = xb >> GFX_FRAC;
+    if (ia == ib) {
+        cov[ia] += xb - xa;
+    } else {
+        cov[ia] += GFX_ONE - (xa & FRAC_MASK);
+        run[ia + 1] += GFX_ONE;
+        run[ib] -= GFX_ONE;
+        cov[ib] += xb & FRAC_MASK;
+    }
+    if (ia < row_x0)
+        row_x0 = ia;
+    if (ib > row_x1)
+        row_x1 = ib;
+}
+
+// Write the coverage of row y into framebuf and clear it for the next row
+static void flush_row(int y, uint32_t col)
+{
+    int32_t acc = 0;
+    int x1 = row_x1 < DISPLAY_WIDTH ? row_x1 : DISPLAY_WIDTH - 1;
+    for (int x = row_x0; x <= x1; x++) {
+        acc += run[x];
+        // full coverage is GFX_SUB * GFX_ONE, scale to 0 .. 256
+        unsigned a = (cov[x] + acc) >> (SUB_SHIFT + GFX_FRAC - 8);
+        if (a >= 256)
+            setPixel(x, y, col);
+        else if (a)
+            gfx_blend(x, y, col, a);
+    }
+    for (int x = row_x0; x <= row_x1; x++)
+        cov[x] = run[x] = 0;
+    row_x0 = DISPLAY_WIDTH;
+    row_x1 = -1;
+}
+
+// Calls spans(shape, sy) for every sub-scanline sy of the rows y0 .. y1 - 1
+static void raster(int32_t y0, int32_t y1, void (*spans)(const void *, int32_t), const void *shape, uint32_t col)
+{
+    int r0 = y0 >> GFX_FRAC, r1 = (y1 + FRAC_MASK) >> GFX_FRAC;
+    if (r0 < 0)
+        r0 = 0;
+    if (r1 > DISPLAY_HEIGHT)
+        r1 = DISPLAY_HEIGHT;
+    row_x0 = DISPLAY_WIDTH;
+    row_x1 = -1;
+    for (int y = r0; y < r1; y++) {
+        for (int s = 0; s < GFX_SUB; s++)
+            spans(shape, (y << GFX_FRAC) + ((2 * s + 1) << GFX_FRAC) / (2 * GFX_SUB));
+        if (row_x1 >= 0)
+            flush_row(y, col);
+    }
+}
+
+// ---------
+//  Polygons
+// ---------
+// Non-horizontal polygon edge, covers the sub-scanlines y0 <= sy < y1
+typedef struct {
+    int32_t y0, y1;
+    int32_t x0;     // x at y0
+    int32_t dxdy;   // slope, 16 fractional bits
+    int dir;        // +1 downwards, -1 upwards
+} edge_t;
+
+typedef struct {
+    edge_t e[GFX_MAX_VERTS];
+    unsigned n;
+} poly_t;
+
+static void poly_spans(const void *shape, int32_t sy)
+{
+    const poly_t *p = shape;
+    int32_t xs[GFX_MAX_VERTS];
+    int dirs[GFX_MAX_VERTS];
+    unsigned n = 0;
+
+    // crossings of the sub-scanline with all edges, sorted by x
+    for (const edge_t *e = p->e; e < &p->e[p->n]; e++) {
+        if (sy < e->y0 || sy >= e->y1)
+            continue;
+        int32_t x = e->x0 + (int32_t)(((int64_t)(sy - e->y0) * e->dxdy) >> 16);
+        int dir = e->dir;
+        unsigned j = n++;
+        for (; j > 0 && xs[j - 1] > x; j--) {
+            xs[j] = xs[j - 1];
+            dirs[j] = dirs[j - 1];
+        }
+        xs[j] = x;
+        dirs[j] = dir;
+    }
+
+    int wind = 0;
+    int32_t start = 0;
+    for (unsigned i = 0; i < n; i++) {
+        if (wind == 0)
+            start = xs[i];
+        wind += dirs[i];
+        if (wind == 0)
+            span(start, xs[i]);
+    }
+}
+
+int gfx_polygon(const gfx_pt_t *pts, unsigned n, uint32_t col)
+{
+    if (n < 3 || n > GFX_MAX_VERTS)
+        return -1;
+    static poly_t p;
+    int32_t y0 = pts[0].y, y1 = pts[0].y;
+    p.n = 0;
+    for (unsigned i = 0; i < n; i++) {
+        const gfx_pt_t *a = &pts[i], *b = &pts[(i + 1) % n];
+        if (a->y < y0)
+            y0 = a->y;
+        if (a->y > y1)
+            y1 = a->y;
+        if (a->y == b->y)
+            continue;
+        edge_t *e = &p.e[p.n++];
+        e->dir = b->y > a->y ? 1 : -1;
+        if (e->dir < 0) {
+            const gfx_pt_t *t = a;
+            a = b;
+            b = t;
+        }
+        e->y0 = a->y;
+        e->y1 = b->y;
+        e->x0 = a->x;
+        e->dxdy = (int32_t)(((int64_t)(b->x - a->x) << 16) / (b->y - a->y));
+    }
+    raster(y0, y1, poly_spans, &p, col);
+    return 0;
+}
+
+// --------
+//  Circles
+// --------
+typedef struct {
+    int32_t cx, cy;
+    uint32_t ro2, ri2;  // outer and inner radius squared, ri2 = 0 for a filled circle
+} circle_t;
+
+static uint32_t isqrt(uint32_t v)
+{
+    if (v == 0)
+        return 0;
+    uint32_t r = 0, b = 1U << ((31 - __builtin_clz(v)) & ~1);
+    while (b) {
+        if (v >= r + b) {
+            v -= r + b;
+            r = (r >> 1) + b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    return r;
+}
+
+static void circle_spans(const void *shape, int32_t sy)
+{
+    const circle_t *c = shape;
+    int32_t dy = sy - c->cy;
+    uint32_t dy2 = (uint32_t)dy * (uint32_t)dy;
+    if (dy2 >= c->ro2)
+        return;
+    int32_t ho = isqrt(c->ro2 - dy2);
+    if (dy2 >= c->ri2) {
+        span(c->cx - ho, c->cx + ho);
+    } else {
+        int32_t hi = isqrt(c->ri2 - dy2);
+        span(c->cx - ho, c->cx - hi);
+        span(c->cx + hi, c->cx + ho);
+    }
+}
+
+void gfx_circle(int32_t cx, int32_t cy, int32_t r, int32_t w, uint32_t col)
+{
+    int32_t ro = w ? r + w / 2 : r;
+    int32_t ri = r - w / 2;
+    if (ro >= GFX_MAX_R)
+        ro = GFX_MAX_R - 1;
+    circle_t c = {
+        .cx = cx,
+        .cy = cy,
+        .ro2 = (uint32_t)ro * ro,
+        .ri2 = w && ri > 0 ? (uint32_t)ri * ri : 0,
+    };
+    raster(cy - ro, cy + ro, circle_spans, &c, col);
+}
@@ -0,0 +1,43 @@
+#ifndef GFX_H
+#define GFX_H
+
+// Anti-aliased vector graphics, drawn into framebuf with blending.
+//
+// Coordinates are fixed point with GFX_FRAC fractional bits. Pixel (x, y)
+// covers the area [x, x + 1) x [y, y + 1), so its centre is at x + 0.5.
+// Filled shapes are rasterised row by row into a coverage buffer (exact
+// horizontally, GFX_SUB sub-scanlines vertically) and written out as spans:
+// fully covered pixels are set, edge pixels are blended with their coverage.
+// Everything is clipped to the display.
+
+#include <stdint.h>
+
+#define GFX_FRAC 8
+#define GFX_ONE (1 << GFX_FRAC)
+// integer or constant expression to fixed point
+#define GFX_FX(v) ((int32_t)((v) * GFX_ONE))
+
+// vertical sub-scanlines per pixel row, must be a power of 2
+#define GFX_SUB 16
+// most vertices a polygon can have
+#define GFX_MAX_VERTS 64
+// circles are limited to radius + width / 2 < GFX_MAX_R, the squares fit 32 bit
+#define GFX_MAX_R GFX_FX(256)
+
+typedef struct {
+    int32_t x, y;
+} gfx_pt_t;
+
+// Blend col into pixel (x, y) with coverage a, 0 .. 256 (= opaque)
+void gfx_blend(int x, int y, uint32_t col, unsigned a);
+
+// 1 pixel wide line, Xiaolin Wu's algorithm
+void gfx_line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t col);
+
+// Filled polygon of n vertices, non-zero winding rule. Returns -1 if n is out of range.
+int gfx_polygon(const gfx_pt_t *pts, unsigned n, uint32_t col);
+
+// Circle around (cx, cy) with radius r. Filled if w is 0, otherwise a ring of width w.
+void gfx_circle(int32_t cx, int32_t cy, int32_t r, int32_t w, uint32_t col);
+
+#endif
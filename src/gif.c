@@ -0,0 +1,352 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "framebuf.h"
+#include "gif.h"
+
+static inline unsigned u16le(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static int read_palette(uint32_t *pal, const uint8_t **p, const uint8_t *end, unsigned n)
+{
+    if (*p + 3 * n > end)
+        return -1;
+    for (unsigned i = 0; i < n; i++, *p += 3)
+        pal[i] = (*p)[0] << 16 | (*p)[1] << 8 | (*p)[2];
+    return 0;
+}
+
+// Skip a chain of data sub-blocks up to and including the terminator
+static const uint8_t *skip_blocks(const uint8_t *p, const uint8_t *end)
+{
+    while (p < end && *p)
+        p += *p + 1;
+    return p < end ? p + 1 : NULL;
+}
+
+int gif_open(gif_t *g, const uint8_t *data, size_t len)
+{
+    if (len < 13 || (memcmp(data, "GIF87a", 6) && memcmp(data, "GIF89a", 6)))
+        return -1;
+    g->data = data;
+    g->end = data + len;
+    g->width = u16le(&data[6]);
+    g->height = u16le(&data[8]);
+    g->p = &data[13];
+    if (data[10] & 0x80 && read_palette(g->gpal, &g->p, g->end, 2 << (data[10] & 7)))
+        return -1;
+    g->first = g->p;
+    gif_rewind(g);
+    return 0;
+}
+
+void gif_rewind(gif_t *g)
+{
+    g->p = g->first;
+    g->n_frames = 0;
+    g->delay_ms = 0;
+    g->transparent = -1;
+    g->disposal = 0;
+    g->prev_disposal = 0;
+}
+
+void gif_close(gif_t *g)
+{
+    // nothing allocated, gif_t holds all the state
+}
+
+// Undo the previous frame according to its disposal method
+static void dispose(gif_t *g)
+{
+    if (g->prev_disposal != 2 && g->prev_disposal != 3)
+        return;
+    const uint32_t *s = g->save;
+    for (unsigned y = 0; y < g->prev_h; y++)
+        for (unsigned x = 0; x < g->prev_w; x++)
+            setPixel(g->prev_x + x, g->prev_y + y, g->prev_disposal == 3 ? *s++ : 0);
+}
+
+// Remember what is under the frame about to be drawn, for disposal method 3
+static void save_area(gif_t *g)
+{
+    uint32_t *s = g->save;
+    for (unsigned y = 0; y < g->prev_h; y++)
+        for (unsigned x = 0; x < g->prev_w; x++)
+            *s++ = getPixel(g->prev_x + x, g->prev_y + y);
+}
+
+// Clip the span [*a, *a + *n) to [0, lim)
+static void clip(int *a, unsigned *n, int lim)
+{
+    int lo = *a < 0 ? 0 : *a, hi = *a + (int)*n > lim ? lim : *a + (int)*n;
+    *a = lo;
+    *n = hi > lo ? hi - lo : 0;
+}
+
+// Where decoded pixels go: frame area on the display, row order and palette
+typedef struct {
+    int x0, y0;
+    unsigned w, h;
+    unsigned x, y, pass;
+    int interlaced;
+    int transparent;
+    const uint32_t *pal;
+} out_t;
+
+// Interlaced rows come in 4 passes: every 8th row from 0, every 8th from 4, every 4th from 2, every 2nd from 1
+static const uint8_t il_start[4] = {0, 4, 2, 1};
+static const uint8_t il_step[4] = {8, 8, 4, 2};
+
+static inline void put(out_t *o, unsigned idx)
+{
+    if (o->y >= o->h)
+        return;
+    int px = o->x0 + o->x, py = o->y0 + o->y;
+    if ((int)idx != o->transparent && px >= 0 && px < DISPLAY_WIDTH && py >= 0 && py < DISPLAY_HEIGHT)
+        setPixel(px, py, o->pal[idx]);
+    if (++o->x < o->w)
+        return;
+    o->x = 0;
+    if (!o->interlaced) {
+        o->y++;
+        return;
+    }
+    o->y += il_step[o->pass];
+    while (o->y >= o->h && o->pass < 3) {
+        o->pass++;
+        o->y = il_start[o->pass];
+    }
+}
+
+// LZW decode the image data sub-blocks at *pp into o
+static int lzw_decode(gif_t *g, const uint8_t **pp, out_t *o)
+{
+    const uint8_t *p = *pp, *end = g->end;
+    if (p >= end)
+        return -1;
+    unsigned min_size = *p++;
+    if (min_size < 2 || min_size > 8)
+        return -1;
+
+    unsigned clear = 1 << min_size, eoi = clear + 1;
+    unsigned size = min_size + 1, next = clear + 2;
+    int prev = -1;
+    unsigned first = 0;
+    uint32_t acc = 0;
+    unsigned n_bits = 0, block_left = 0;
+
+    while (1) {
+        // next code from the bit stream, which is split into sub-blocks
+        while (n_bits < size) {
+            if (block_left == 0) {
+                if (p >= end || *p == 0)
+                    goto done;  // data ended without EOI, accepted by most decoders
+                block_left = *p++;
+            }
+            if (p >= end)
+                return -1;
+            acc |= (uint32_t)*p++ << n_bits;
+            n_bits += 8;
+            block_left--;
+        }
+        unsigned code = acc & ((1 << size) - 1);
+        acc >>= size;
+        n_bits -= size;
+
+        if (code == clear) {
+            size = min_size + 1;
+            next = clear + 2;
+            prev = -1;
+            continue;
+        }
+        if (code == eoi)
+            break;
+        if (prev < 0) {
+            if (code >= clear)
+                return -1;
+            put(o, code);
+            first = code;
+            prev = code;
+            continue;
+        }
+
+        // unwind the string of code onto the stack, last pixel first
+        uint8_t *sp = g->stack;
+        unsigned c = code;
+        if (code == next) {
+            // not in the dictionary yet: previous string + its first pixel
+            *sp++ = first;
+            c = prev;
+        } else if (code > next) {
+            return -1;
+        }
+        while (c >= clear) {
+            *sp++ = g->suffix[c];
+            c = g->prefix[c];
+        }
+        *sp++ = c;
+        first = c;
+        while (sp > g->stack)
+            put(o, *--sp);
+
+        if (next < GIF_MAX_CODES) {
+            g->prefix[next] = prev;
+            g->suffix[next] = first;
+            next++;
+            if (next == (1U << size) && size < 12)
+                size++;
+        }
+        prev = code;
+    }
+done:
+    // skip whatever is left of the image data
+    if (block_left)
+        p += block_left;
+    p = skip_blocks(p, end);
+    if (!p)
+        return -1;
+    *pp = p;
+    return 0;
+}
+
+int gif_next_frame(gif_t *g, int x0, int y0, unsigned *delay_ms)
+{
+    const uint8_t *p = g->p, *end = g->end;
+
+    while (p < end) {
+        uint8_t b = *p++;
+        if (b == 0x3B) {
+            // trailer
+            g->p = p - 1;
+            return 1;
+        }
+        if (b == 0x21) {
+            if (p + 1 >= end)
+                return -1;
+            if (p[0] == 0xF9 && p[1] == 4 && p + 6 < end) {
+                // graphic control extension
+                g->disposal = (p[2] >> 2) & 7;
+                g->delay_ms = u16le(&p[3]) * 10;
+                g->transparent = p[2] & 1 ? p[5] : -1;
+            }
+            p = skip_blocks(p + 1, end);
+            if (!p)
+                return -1;
+            continue;
+        }
+        if (b != 0x2C || p + 9 > end)
+            return -1;
+
+        // image descriptor, the frame has to be on the logical screen
+        if (u16le(&p[0]) + u16le(&p[4]) > g->width || u16le(&p[2]) + u16le(&p[6]) > g->height)
+            return -1;
+        out_t o = {
+            .x0 = x0 + u16le(&p[0]),
+            .y0 = y0 + u16le(&p[2]),
+            .w = u16le(&p[4]),
+            .h = u16le(&p[6]),
+            .interlaced = p[8] & 0x40,
+            .transparent = g->transparent,
+            .pal = g->gpal,
+        };
+        unsigned flags = p[8];
+        p += 9;
+        if (flags & 0x80) {
+            if (read_palette(g->lpal, &p, end, 2 << (flags & 7)))
+                return -1;
+            o.pal = g->lpal;
+        }
+
+        dispose(g);
+        g->prev_x = o.x0;
+        g->prev_y = o.y0;
+        g->prev_w = o.w;
+        g->prev_h = o.h;
+        clip(&g->prev_x, &g->prev_w, DISPLAY_WIDTH);
+        clip(&g->prev_y, &g->prev_h, DISPLAY_HEIGHT);
+        g->prev_disposal = g->disposal;
+        if (g->disposal == 3)
+            save_area(g);
+
+        if (lzw_decode(g, &p, &o))
+            return -1;
+
+        g->p = p;
+        g->n_frames++;
+        if (delay_ms)
+            *delay_ms = g->delay_ms;
+        // the control extension only applies to one frame
+        g->delay_ms = 0;
+        g->transparent = -1;
+        g->disposal = 0;
+        return 0;
+    }
+    return -1;
+}
+
+#ifdef GIF_MAIN
+// Host benchmark: decode every frame of a GIF n times, optionally compare the
+// frames against raw RGB24 files of the same size (e.g. from ImageMagick convert).
+#include "host_util.h"
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: gif file.gif [n_loops] [frame0.rgb ...]\n");
+        return 1;
+    }
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    static uint8_t buf[1 << 20];
+    size_t len = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+    unsigned n_loops = argc > 2 ? atoi(argv[2]) : 100;
+
+    static gif_t g;
+    if (gif_open(&g, buf, len)) {
+        fprintf(stderr, "%s: not a GIF\n", argv[1]);
+        return 1;
+    }
+
+    // check against reference frames
+    unsigned n_bad = 0, delay, n = 0;
+    setAll(0);
+    while (gif_next_frame(&g, 0, 0, &delay) == 0) {
+        if (3 + n < (unsigned)argc) {
+            FILE *r = fopen(argv[3 + n], "rb");
+            uint8_t px[3];
+            for (unsigned y = 0; r && y < g.height; y++) {
+                for (unsigned x = 0; x < g.width && fread(px, 3, 1, r) == 1; x++) {
+                    uint32_t c = px[0] << 16 | px[1] << 8 | px[2];
+                    if (x < DISPLAY_WIDTH && y < DISPLAY_HEIGHT && getPixel(x, y) != c)
+                        n_bad++;
+                }
+            }
+            if (r)
+                fclose(r);
+        }
+        n++;
+    }
+
+    int64_t t0 = now_us();
+    unsigned n_frames = 0;
+    for (unsigned i = 0; i < n_loops; i++) {
+        gif_rewind(&g);
+        while (gif_next_frame(&g, 0, 0, &delay) == 0)
+            n_frames++;
+    }
+    double t = now_us() - t0;
+    printf(
+        "%ux%u, %u frames, %u pixel mismatches, %.1f us per frame\n",
+        g.width, g.height, n, n_bad, t / n_frames
+    );
+    gif_close(&g);
+    return n_bad != 0;
+}
+#endif
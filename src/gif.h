@@ -0,0 +1,58 @@
+#ifndef GIF_H
+#define GIF_H
+
+// Streaming GIF decoder. Decodes one frame at a time from a GIF in memory
+// (e.g. memory mapped flash) straight into framebuf, no intermediate frame
+// buffer. The LZW dictionary lives in a fixed arena inside gif_t.
+//
+// Handles local / global palettes, transparency, interlacing and the disposal
+// methods of GIF89a. Disposal to background clears to black. Restore to
+// previous keeps a copy of the frame area in gif_t, only the part on the display.
+// Frames which don't fit the logical screen are rejected as malformed.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "framebuf.h"
+
+#define GIF_MAX_CODES 4096
+
+typedef struct {
+    const uint8_t *data, *end;
+    const uint8_t *p;           // read position, start of the next block
+    const uint8_t *first;       // first block after the header, for gif_rewind()
+    unsigned width, height;     // logical screen
+    uint32_t gpal[256];         // global palette, MSB {x, R, G, B} LSB
+    uint32_t lpal[256];         // local palette of the current frame
+    unsigned n_frames;          // frames decoded since gif_open() / gif_rewind()
+
+    // graphic control extension of the next frame
+    unsigned delay_ms;
+    int transparent;            // palette index, -1 = none
+    unsigned disposal;
+
+    // area of the previous frame on the display and its disposal, undone before
+    // the next one is drawn
+    int prev_x, prev_y;
+    unsigned prev_w, prev_h, prev_disposal;
+    uint32_t save[FB_PIXELS];   // framebuf contents under the previous frame (disposal 3)
+
+    // LZW arena
+    uint16_t prefix[GIF_MAX_CODES];
+    uint8_t suffix[GIF_MAX_CODES];
+    uint8_t stack[GIF_MAX_CODES];
+} gif_t;
+
+// Parse the header and global palette. Returns 0 or -1 if this is not a GIF.
+int gif_open(gif_t *g, const uint8_t *data, size_t len);
+
+// Decode the next frame into framebuf with the logical screen's origin at (x0, y0).
+// Returns 0 and the frame's delay, 1 at the end of the animation (see gif_rewind())
+// or -1 if the data is malformed.
+int gif_next_frame(gif_t *g, int x0, int y0, unsigned *delay_ms);
+
+// Start over at the first frame
+void gif_rewind(gif_t *g);
+
+void gif_close(gif_t *g);
+
+#endif
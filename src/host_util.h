@@ -0,0 +1,41 @@
+#ifndef HOST_UTIL_H
+#define HOST_UTIL_H
+
+// Random numbers and clocks for code built on the host: the -DXXX_MAIN
+// self-tests, tools/ and the host backends. Not part of the firmware, which
+// has esp_timer_get_time().
+
+#include <stdint.h>
+#include <time.h>
+
+// xorshift32, the same sequence on every run so failures can be repeated
+static inline uint32_t rnd(void)
+{
+    static uint32_t r = 1;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    return r;
+}
+
+// Monotonic wall clock [ns]
+static inline int64_t now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+// Monotonic wall clock [us], like esp_timer_get_time()
+static inline int64_t now_us(void)
+{
+    return now_ns() / 1000;
+}
+
+// CPU time [us], the difference of two calls times the code between them
+static inline double cpu_us(void)
+{
+    return (double)clock() / CLOCKS_PER_SEC * 1e6;
+}
+
+#endif
@@ -31,6 +31,8 @@
 #include "esp_private/periph_ctrl.h"
 
 #include "esp_heap_caps.h"
+#include "esp_intr_alloc.h"
+#include "esp_err.h"
 #include "esp_log.h"
 #include "rom/gpio.h"
 #include "rom/lldesc.h"
@@ -42,6 +44,10 @@ static const char *T = "I2S_P";
 typedef struct {
     volatile lldesc_t *dmadesc_a, *dmadesc_b;
     int desccount_a, desccount_b;
+    volatile int pending;           // buffer of the last flip until the DMA runs on it, -1 = none
+    volatile unsigned n_refresh;    // passes through a buffer, counted by the EOF interrupt
+    SemaphoreHandle_t flip_sem;     // given when the pending flip took effect
+    intr_handle_t intr;
 } i2s_parallel_state_t;
 
 static i2s_parallel_state_t *i2s_state[2] = {NULL, NULL};
@@ -80,8 +86,9 @@ fill_dma_desc(volatile lldesc_t *dmadesc, i2s_parallel_buffer_desc_t *bufdesc) {
             n++;
         }
     }
-    // Loop last back to first
+    // Loop last back to first, the end of each pass raises the EOF interrupt
     dmadesc[n - 1].qe.stqe_next = (lldesc_t *)&dmadesc[0];
+    dmadesc[n - 1].eof = 1;
 }
 
 static void gpio_setup_out(gpio_num_t gpio, int sig, bool isInverted) {
@@ -116,6 +123,35 @@ static void fifo_reset(i2s_dev_t *dev) {
 
 static int i2snum(i2s_dev_t *dev) { return (dev == &I2S0) ? 0 : 1; }
 
+static bool in_chain(volatile lldesc_t *desc, int count, uint32_t addr) {
+    return addr >= (uint32_t)&desc[0] && addr < (uint32_t)&desc[count];
+}
+
+// End of a pass through the active buffer. A flip takes effect here, once the
+// DMA is on a descriptor of the new buffer it is safe to write the old one.
+static void eof_isr(void *arg) {
+    i2s_dev_t *dev = (i2s_dev_t *)arg;
+    i2s_parallel_state_t *st = i2s_state[i2snum(dev)];
+    uint32_t status = dev->int_st.val;
+    dev->int_clr.val = status;
+    if (!(status & I2S_OUT_EOF_INT_ST))
+        return;
+    st->n_refresh++;
+
+    int b = st->pending;
+    if (b < 0)
+        return;
+    // Still on the old buffer if the relink came too late for this pass, try again on the next EOF
+    uint32_t cur = dev->out_link_dscr;
+    if (b == 0 ? in_chain(st->dmadesc_a, st->desccount_a, cur) : in_chain(st->dmadesc_b, st->desccount_b, cur)) {
+        BaseType_t wake = pdFALSE;
+        st->pending = -1;
+        xSemaphoreGiveFromISR(st->flip_sem, &wake);
+        if (wake)
+            portYIELD_FROM_ISR();
+    }
+}
+
 void i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg) {
     // Figure out which signal numbers to use for routing
     int sig_data_base, sig_clk;
@@ -243,6 +279,16 @@ void i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg) {
         st->desccount_b = 0;
     }
 
+    st->pending = -1;
+    st->n_refresh = 0;
+    st->flip_sem = xSemaphoreCreateBinary();
+    dev->int_ena.val = 0;
+    dev->int_clr.val = ~0;
+    ESP_ERROR_CHECK(esp_intr_alloc(
+        dev == &I2S0 ? ETS_I2S0_INTR_SOURCE : ETS_I2S1_INTR_SOURCE, 0, eof_isr, dev, &st->intr
+    ));
+    dev->int_ena.out_eof = 1;
+
     // Reset FIFO/DMA -> needed? Doesn't dma_reset/fifo_reset do this?
     dev->lc_conf.in_rst = 1;
     dev->lc_conf.out_rst = 1;
@@ -286,4 +332,20 @@ void i2s_parallel_flip_to_buffer(i2s_dev_t *dev, int bufid) {
 
     i2s_state[no]->dmadesc_a[i2s_state[no]->desccount_a-1].qe.stqe_next=active_dma_chain;
     i2s_state[no]->dmadesc_b[i2s_state[no]->desccount_b-1].qe.stqe_next=active_dma_chain;
+
+    // Only after the relink, an EOF before it must not count as the flip
+    xSemaphoreTake(i2s_state[no]->flip_sem, 0);
+    i2s_state[no]->pending=bufid;
+}
+
+int i2s_parallel_wait_flip(i2s_dev_t *dev, TickType_t timeout) {
+    i2s_parallel_state_t *st = i2s_state[i2snum(dev)];
+    if (st == NULL || st->pending < 0)
+        return 0;
+    return xSemaphoreTake(st->flip_sem, timeout) == pdTRUE ? 1 : -1;
+}
+
+unsigned i2s_parallel_refresh_count(i2s_dev_t *dev) {
+    i2s_parallel_state_t *st = i2s_state[i2snum(dev)];
+    return st ? st->n_refresh : 0;
 }
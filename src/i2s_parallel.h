@@ -2,6 +2,7 @@
 #define I2S_PARALLEL_H
 
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
 #include "soc/i2s_struct.h"
 
 typedef enum {
@@ -27,5 +28,10 @@ typedef struct {
 
 void i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg);
 void i2s_parallel_flip_to_buffer(i2s_dev_t *dev, int bufid);
+// Wait until the DMA sends out the buffer of the last flip. Returns 0 if it already
+// does, 1 after waiting for it, -1 after timeout.
+int i2s_parallel_wait_flip(i2s_dev_t *dev, TickType_t timeout);
+// Number of passes through the active buffer since setup
+unsigned i2s_parallel_refresh_count(i2s_dev_t *dev);
 
 #endif
@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include <string.h>
+#include "life.h"
+
+void life_init(life_t *l, uint16_t birth, uint16_t survive)
+{
+    memset(l, 0, sizeof(*l));
+    l->birth = birth;
+    l->survive = survive;
+}
+
+void life_seed(life_t *l, uint32_t seed, unsigned density)
+{
+    uint32_t *c = l->cells[l->cur];
+    uint32_t r = seed ? seed : 1;
+    memset(c, 0, sizeof(l->cells[0]));
+    for (unsigned i = 0; i < DISPLAY_HEIGHT * DISPLAY_WIDTH; i++) {
+        // xorshift32
+        r ^= r << 13;
+        r ^= r >> 17;
+        r ^= r << 5;
+        if ((r & 0xFF) < density)
+            c[i / 32] |= 1U << (i % 32);
+    }
+    l->generation = 0;
+}
+
+// Full adder of three bit vectors
+#define FA(s, c, a, b, d) do { uint32_t t_ = (a) ^ (b); s = t_ ^ (d); c = ((a) & (b)) | (t_ & (d)); } while (0)
+
+// Neighbours to the west and east of each cell of word i in row r, the bits
+// shifted in come from the adjacent words, wrapping around the row
+static inline uint32_t west(const uint32_t *r, unsigned i)
+{
+    return r[i] << 1 | r[(i + LIFE_WORDS - 1) % LIFE_WORDS] >> 31;
+}
+
+static inline uint32_t east(const uint32_t *r, unsigned i)
+{
+    return r[i] >> 1 | r[(i + 1) % LIFE_WORDS] << 31;
+}
+
+unsigned life_step(life_t *l)
+{
+    const uint32_t *src = l->cells[l->cur];
+    uint32_t *dst = l->cells[l->cur ^ 1];
+    unsigned changed = 0;
+
+    for (unsigned y = 0; y < DISPLAY_HEIGHT; y++) {
+        const uint32_t *up = &src[(y + DISPLAY_HEIGHT - 1) % DISPLAY_HEIGHT * LIFE_WORDS];
+        const uint32_t *mid = &src[y * LIFE_WORDS];
+        const uint32_t *dn = &src[(y + 1) % DISPLAY_HEIGHT * LIFE_WORDS];
+        for (unsigned i = 0; i < LIFE_WORDS; i++) {
+            // Rows above and below: 3 bits each -> 2 bit sums. Same row: 2 bits.
+            uint32_t sa, ca, sb, cb;
+            FA(sa, ca, west(up, i), up[i], east(up, i));
+            FA(sb, cb, west(dn, i), dn[i], east(dn, i));
+            uint32_t w = west(mid, i), e = east(mid, i);
+            uint32_t sm = w ^ e, cm = w & e;
+
+            // Add the partial sums up into the count bits s0 .. s3
+            uint32_t s0, k1, t, u;
+            FA(s0, k1, sa, sb, sm);
+            FA(t, u, ca, cb, cm);
+            uint32_t s1 = t ^ k1, v = t & k1;
+            uint32_t s2 = u ^ v, s3 = u & v;
+
+            // Cells whose count is in the rule
+            uint32_t born = 0, stay = 0;
+            for (unsigned n = 0; n <= 8; n++) {
+                if (!((l->birth | l->survive) >> n & 1))
+                    continue;
+                uint32_t eq = (n & 1 ? s0 : ~s0) & (n & 2 ? s1 : ~s1) & (n & 4 ? s2 : ~s2) & (n & 8 ? s3 : ~s3);
+                if (l->birth >> n & 1)
+                    born |= eq;
+                if (l->survive >> n & 1)
+                    stay |= eq;
+            }
+            uint32_t c = mid[i];
+            uint32_t next = (~c & born) | (c & stay);
+            dst[y * LIFE_WORDS + i] = next;
+            changed += __builtin_popcount(next ^ c);
+        }
+    }
+    l->cur ^= 1;
+    l->generation++;
+    return changed;
+}
+
+#ifdef LIFE_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_util.h"
+
+static int cell(const uint32_t *c, int x, int y)
+{
+    x = (x + DISPLAY_WIDTH) % DISPLAY_WIDTH;
+    y = (y + DISPLAY_HEIGHT) % DISPLAY_HEIGHT;
+    return c[y * LIFE_WORDS + x / 32] >> (x % 32) & 1;
+}
+
+// One cell at a time, what life_step() must match
+static void step_ref(const life_t *l, uint32_t *dst)
+{
+    const uint32_t *src = life_cells(l);
+    memset(dst, 0, sizeof(l->cells[0]));
+    for (int y = 0; y < DISPLAY_HEIGHT; y++)
+        for (int x = 0; x < DISPLAY_WIDTH; x++) {
+            int n = 0;
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dx = -1; dx <= 1; dx++)
+                    if (dx || dy)
+                        n += cell(src, x + dx, y + dy);
+            int alive = cell(src, x, y) ? l->survive >> n & 1 : l->birth >> n & 1;
+            if (alive)
+                dst[y * LIFE_WORDS + x / 32] |= 1U << (x % 32);
+        }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned n_gen = argc > 1 ? strtoul(argv[1], NULL, 0) : 10000;
+    static life_t l;
+    static uint32_t ref[DISPLAY_HEIGHT * LIFE_WORDS];
+    unsigned fails = 0;
+    double t_step = 0;
+    for (int rule = 0; rule < 2; rule++) {
+        if (rule)
+            life_init(&l, LIFE_B36_S23);
+        else
+            life_init(&l, LIFE_B3_S23);
+        for (unsigned g = 0; g < n_gen; g++) {
+            // reseed now and then with varying density, the grid dies down otherwise
+            if (g % 500 == 0)
+                life_seed(&l, g + 1, 40 + g / 500 * 37 % 180);
+            step_ref(&l, ref);
+            double t0 = cpu_us();
+            life_step(&l);
+            t_step += cpu_us() - t0;
+            if (memcmp(ref, life_cells(&l), sizeof(ref)) && fails++ < 10)
+                printf("rule %d, generation %u differs\n", rule, g);
+        }
+    }
+    printf(
+        "%u generations checked, %u failures, %.2f us per generation\n",
+        2 * n_gen, fails, t_step / (2 * n_gen)
+    );
+    return fails != 0;
+}
+#endif
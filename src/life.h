@@ -0,0 +1,47 @@
+#ifndef LIFE_H
+#define LIFE_H
+
+// Life-like cellular automata on the whole display, one bit per cell, wrapping
+// around at the edges. A generation is computed 32 cells at a time (SWAR): the
+// 8 neighbours of every cell in a word are added up by a tree of bitwise full
+// adders into a 4 bit count per cell, held as 4 words of count bits.
+//
+// The grid is a bitmap as enc_mono() reads it, so generations go straight into
+// the bitplanes with update_frame_mono(), without touching framebuf. Two
+// generations take 1 kB, framebuf 16 kB.
+//
+// Checked against a cell by cell implementation on the host:
+//   gcc -O2 -DLIFE_MAIN -Isrc -o life src/life.c && ./life [generations]
+
+#include <stdint.h>
+#include "framebuf.h"
+
+#define LIFE_WORDS (DISPLAY_WIDTH / 32)
+
+// Rules, bit n set = born / survives with n neighbours
+#define LIFE_B3_S23   (1 << 3), (1 << 2 | 1 << 3)              // Conway's Game of Life
+#define LIFE_B36_S23  (1 << 3 | 1 << 6), (1 << 2 | 1 << 3)     // HighLife
+
+typedef struct {
+    uint32_t cells[2][DISPLAY_HEIGHT * LIFE_WORDS];
+    unsigned cur;               // generation in cells[cur]
+    uint16_t birth, survive;
+    unsigned generation;
+} life_t;
+
+// Empty grid with the rule, e.g. life_init(&l, LIFE_B3_S23)
+void life_init(life_t *l, uint16_t birth, uint16_t survive);
+
+// Fill the grid at random, about density / 256 of the cells alive
+void life_seed(life_t *l, uint32_t seed, unsigned density);
+
+// Compute the next generation. Returns the number of cells which changed.
+unsigned life_step(life_t *l);
+
+// Bitmap of the current generation, for enc_mono()
+static inline const uint32_t *life_cells(const life_t *l)
+{
+    return l->cells[l->cur];
+}
+
+#endif
@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#else
+#include "host_util.h"
+#endif
+#include "framebuf.h"
+#include "netrx.h"
+
+// E1.31 root layer vectors
+#define E131_ROOT_DATA  0x00000004
+#define E131_ROOT_EXT   0x00000008
+// framing layer vectors
+#define E131_DATA       0x00000002
+#define E131_EXT_SYNC   0x00000001
+// options
+#define E131_PREVIEW    0x80
+#define E131_TERMINATED 0x40
+
+#define E131_DATA_HDR   126     // up to and including the DMX start code
+#define E131_SYNC_SZ    49
+
+// DDP header flags
+#define DDP_VER_MASK    0xC0
+#define DDP_VER1        0x40
+#define DDP_TIMECODE    0x10
+#define DDP_REPLY       0x04
+#define DDP_QUERY       0x02
+#define DDP_PUSH        0x01
+
+static const uint8_t acn_id[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+
+#ifdef ESP_PLATFORM
+static int64_t now_us(void)
+{
+    return esp_timer_get_time();
+}
+#endif
+
+static inline unsigned u16be(const uint8_t *p)
+{
+    return p[0] << 8 | p[1];
+}
+
+static inline uint32_t u32be(const uint8_t *p)
+{
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+// Count a dropped packet
+static inline int drop(unsigned *cnt)
+{
+    (*cnt)++;
+    return -1;
+}
+
+int netrx_init(netrx_t *rx, const netrx_cfg_t *cfg)
+{
+    memset(rx, 0, sizeof(*rx));
+    rx->cfg = *cfg;
+    rx->ddp_seq = -1;
+    rx->t_first = -1;
+    if (cfg->proto == NETRX_E131) {
+        unsigned ppu = cfg->px_per_universe;
+        if (ppu == 0 || ppu > 170 || cfg->universe == 0)
+            return -1;
+        rx->n_universes = (FB_PIXELS + ppu - 1) / ppu;
+        if (rx->n_universes > NETRX_MAX_UNIVERSES || cfg->universe + rx->n_universes > 64000)
+            return -1;
+    }
+    for (unsigned i = 0; i < FB_PIXELS; i++) {
+        unsigned x = i % DISPLAY_WIDTH, y = i / DISPLAY_WIDTH;
+        if (cfg->serpentine && (y & 1))
+            x = DISPLAY_WIDTH - 1 - x;
+        rx->map[i] = fb_index(x, y);
+    }
+    return 0;
+}
+
+// One channel of a pixel which is split over two packets
+static void put_channel(const netrx_t *rx, unsigned off, uint8_t v)
+{
+    unsigned i = rx->map[off / 3], sh = 8 * (2 - off % 3);
+    fb_set(i, (fb_get(i) & ~(0xFFU << sh)) | v << sh);
+}
+
+// Write n channels starting at channel `off` of the stream into framebuf
+static void put_channels(const netrx_t *rx, unsigned off, const uint8_t *d, unsigned n)
+{
+    if (off >= 3 * FB_PIXELS)
+        return;
+    if (n > 3 * FB_PIXELS - off)
+        n = 3 * FB_PIXELS - off;
+    for (; n && off % 3; n--)
+        put_channel(rx, off++, *d++);
+    const uint16_t *map = &rx->map[off / 3];
+    for (; n >= 3; n -= 3, d += 3, off += 3)
+        fb_set(*map++, d[0] << 16 | d[1] << 8 | d[2]);
+    for (; n; n--)
+        put_channel(rx, off++, *d++);
+}
+
+static inline uint32_t all_universes(const netrx_t *rx)
+{
+    return rx->n_universes == 32 ? 0xFFFFFFFF : (1U << rx->n_universes) - 1;
+}
+
+static void frame_start(netrx_t *rx, int64_t t)
+{
+    if (rx->t_first < 0) {
+        rx->t_first = t;
+        rx->lost_mark = rx->st.lost;
+    }
+}
+
+static int frame_done(netrx_t *rx, int64_t t)
+{
+    if (rx->cfg.proto == NETRX_E131 ? rx->seen != all_universes(rx) : rx->st.lost != rx->lost_mark)
+        rx->st.partial++;
+    int64_t dt = t - rx->t_first;
+    rx->st.t_asm += dt;
+    if (dt > rx->st.t_asm_max)
+        rx->st.t_asm_max = dt;
+    rx->st.frames++;
+    rx->seen = 0;
+    rx->sync = 0;
+    rx->t_first = -1;
+    return 1;
+}
+
+static int e131_packet(netrx_t *rx, const uint8_t *b, size_t len, int64_t t)
+{
+    if (len < E131_SYNC_SZ || u16be(b) != 0x0010 || memcmp(&b[4], acn_id, sizeof(acn_id)))
+        return drop(&rx->st.bad);
+
+    uint32_t root = u32be(&b[18]);
+    if (root == E131_ROOT_EXT) {
+        if (u32be(&b[40]) != E131_EXT_SYNC)
+            return drop(&rx->st.bad);
+        // shows the pending frame if it is waiting for this address
+        if (rx->seen == 0 || !rx->sync || u16be(&b[45]) != rx->sync)
+            return 0;
+        return frame_done(rx, t);
+    }
+    if (root != E131_ROOT_DATA || len < E131_DATA_HDR || u32be(&b[40]) != E131_DATA ||
+        b[117] != 0x02 || b[118] != 0xA1 || b[125] != 0)
+        return drop(&rx->st.bad);
+    if (b[112] & (E131_PREVIEW | E131_TERMINATED))
+        return drop(&rx->st.bad);
+    unsigned u = u16be(&b[113]) - rx->cfg.universe;
+    unsigned n = u16be(&b[123]);
+    if (u >= rx->n_universes || n < 1 || E131_DATA_HDR - 1 + n > len)
+        return drop(&rx->st.bad);
+
+    // sequence numbers count per universe, anything up to 20 behind is out of order
+    int8_t d = b[111] - rx->seq[u];
+    if (rx->seq_valid & 1U << u) {
+        if (d <= 0 && d > -20)
+            return drop(&rx->st.late);
+        rx->st.lost += (uint8_t)(d - 1);
+    }
+    rx->seq[u] = b[111];
+    rx->seq_valid |= 1U << u;
+
+    if (rx->seen & 1U << u) {
+        // a new frame started before the last one was complete
+        rx->st.dropped++;
+        rx->seen = 0;
+        rx->t_first = -1;
+    }
+    frame_start(rx, t);
+    unsigned ppu = rx->cfg.px_per_universe;
+    n--;    // start code
+    if (n > 3 * ppu)
+        n = 3 * ppu;
+    put_channels(rx, 3 * u * ppu, &b[E131_DATA_HDR], n);
+    rx->seen |= 1U << u;
+    rx->sync = u16be(&b[109]);
+
+    if (!rx->sync && rx->seen == all_universes(rx))
+        return frame_done(rx, t);
+    return 0;
+}
+
+static int ddp_packet(netrx_t *rx, const uint8_t *b, size_t len, int64_t t)
+{
+    if (len < 10 || (b[0] & DDP_VER_MASK) != DDP_VER1 || b[0] & (DDP_REPLY | DDP_QUERY))
+        return drop(&rx->st.bad);
+    // data type: undefined, legacy RGB or 8 bit RGB. Destination: default output.
+    if ((b[2] != 0x00 && b[2] != 0x01 && b[2] != 0x0B) || b[3] > 1)
+        return drop(&rx->st.bad);
+    unsigned hdr = b[0] & DDP_TIMECODE ? 14 : 10;
+    uint32_t off = u32be(&b[4]);
+    unsigned n = u16be(&b[8]);
+    if (hdr + n > len)
+        return drop(&rx->st.bad);
+
+    // sequence numbers run 1 .. 15, 0 = not used. Losses count against the
+    // pending frame, so the frame is started first.
+    frame_start(rx, t);
+    unsigned seq = b[1] & 0x0F;
+    if (seq) {
+        if (rx->ddp_seq > 0) {
+            unsigned d = (seq + 15 - rx->ddp_seq) % 15;
+            if (d == 0)
+                return drop(&rx->st.late);
+            rx->st.lost += d - 1;
+        }
+        rx->ddp_seq = seq;
+    }
+
+    if (off < 3 * FB_PIXELS)
+        put_channels(rx, off, &b[hdr], n);
+    if (b[0] & DDP_PUSH)
+        return frame_done(rx, t);
+    return 0;
+}
+
+int netrx_packet(netrx_t *rx, const uint8_t *buf, size_t len, int64_t t_us)
+{
+    rx->st.packets++;
+    rx->st.bytes += len;
+    if (rx->cfg.proto == NETRX_E131)
+        return e131_packet(rx, buf, len, t_us);
+    return ddp_packet(rx, buf, len, t_us);
+}
+
+int netrx_run(netrx_t *rx, void (*show)(void *arg), void *arg)
+{
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s < 0)
+        return -1;
+    struct sockaddr_in a = {
+        .sin_family = AF_INET,
+        .sin_port = htons(rx->cfg.proto == NETRX_E131 ? NETRX_E131_PORT : NETRX_DDP_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    int one = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(s, (struct sockaddr *)&a, sizeof(a))) {
+        close(s);
+        return -1;
+    }
+    // wake up now and then to look at rx->stop
+    struct timeval tv = {.tv_sec = 0, .tv_usec = 100000};
+    setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    // E1.31 is usually multicast to 239.255.<universe>, failing to join is fine for unicast
+    for (unsigned u = 0; rx->cfg.proto == NETRX_E131 && u < rx->n_universes; u++) {
+        struct ip_mreq mr = {
+            .imr_multiaddr.s_addr = htonl(0xEFFF0000 | (rx->cfg.universe + u)),
+            .imr_interface.s_addr = htonl(INADDR_ANY),
+        };
+        setsockopt(s, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mr, sizeof(mr));
+    }
+
+    while (!rx->stop) {
+        int n = recv(s, rx->buf, sizeof(rx->buf), 0);
+        if (n <= 0)
+            continue;
+        if (netrx_packet(rx, rx->buf, n, now_us()) != 1)
+            continue;
+        int64_t t0 = now_us();
+        show(arg);
+        int64_t t = now_us() - t0;
+        rx->st.t_show += t;
+        if (t > rx->st.t_show_max)
+            rx->st.t_show_max = t;
+    }
+    close(s);
+    return 0;
+}
+
+void netrx_print_stats(netrx_t *rx)
+{
+    netrx_stats_t *st = &rx->st;
+    unsigned n = st->frames ? st->frames : 1;
+    printf(
+        "netrx: %u packets, %u bytes, %u frames (%u partial, %u dropped), %u lost, %u late, %u bad\n",
+        st->packets, st->bytes, st->frames, st->partial, st->dropped, st->lost, st->late, st->bad
+    );
+    printf(
+        "netrx: assembly mean %lld us, max %lld us, show mean %lld us, max %lld us\n",
+        (long long)(st->t_asm / n), (long long)st->t_asm_max,
+        (long long)(st->t_show / n), (long long)st->t_show_max
+    );
+    memset(st, 0, sizeof(*st));
+}
+
+#ifdef NETRX_MAIN
+// Host test: send frames to ourselves over loopback UDP, dropping packets at random.
+// Every frame which completes without missing data must show exactly what was sent.
+#include <stdlib.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+
+#define N_MAX_FRAMES 100000
+
+static netrx_t rx;
+static int64_t t_sent[N_MAX_FRAMES];
+static unsigned n_checked, n_bad, last_partial;
+static int64_t t_lat, t_lat_max;
+
+// Test pattern: pixel 0 holds the frame number
+static uint32_t pattern(unsigned f, unsigned i)
+{
+    return i == 0 ? f : ((f * 2654435761U) ^ (i * 40503U)) & 0xFFFFFF;
+}
+
+static void show(void *arg)
+{
+    int64_t t = now_us();
+    unsigned f = fb_get(rx.map[0]) & 0xFFFFFF;
+    if (rx.st.partial != last_partial || f >= N_MAX_FRAMES) {
+        last_partial = rx.st.partial;
+        return;
+    }
+    n_checked++;
+    for (unsigned i = 0; i < FB_PIXELS; i++) {
+        if ((fb_get(rx.map[i]) & 0xFFFFFF) != pattern(f, i)) {
+            n_bad++;
+            break;
+        }
+    }
+    t -= t_sent[f];
+    t_lat += t;
+    if (t > t_lat_max)
+        t_lat_max = t;
+}
+
+static void *receiver(void *arg)
+{
+    if (netrx_run(&rx, show, NULL))
+        perror("netrx_run");
+    return NULL;
+}
+
+static unsigned n_sent, n_skipped;
+static unsigned loss;   // in 1 / 1000
+
+static void send_packet(int s, const struct sockaddr_in *a, const uint8_t *b, size_t len)
+{
+    if (rnd() % 1000 < loss) {
+        n_skipped++;
+        return;
+    }
+    sendto(s, b, len, 0, (const struct sockaddr *)a, sizeof(*a));
+    n_sent++;
+}
+
+static size_t put_rgb(uint8_t *p, unsigned f, unsigned px, unsigned n)
+{
+    for (unsigned i = 0; i < n; i++, p += 3) {
+        uint32_t c = pattern(f, px + i);
+        p[0] = c >> 16;
+        p[1] = c >> 8;
+        p[2] = c;
+    }
+    return 3 * n;
+}
+
+static void send_e131(int s, const struct sockaddr_in *a, unsigned f)
+{
+    static uint8_t seq;
+    uint8_t b[E131_DATA_HDR + 512];
+    unsigned ppu = rx.cfg.px_per_universe, sync = rx.cfg.universe + rx.n_universes;
+    for (unsigned u = 0; u < rx.n_universes; u++) {
+        unsigned px = u * ppu, n = px + ppu > FB_PIXELS ? FB_PIXELS - px : ppu;
+        memset(b, 0, E131_DATA_HDR);
+        b[1] = 0x10;
+        memcpy(&b[4], acn_id, sizeof(acn_id));
+        b[21] = E131_ROOT_DATA;
+        b[43] = E131_DATA;
+        memcpy(&b[44], "netrx test", 10);
+        b[108] = 100;
+        b[109] = sync >> 8;
+        b[110] = sync;
+        b[111] = seq + u;
+        b[113] = (rx.cfg.universe + u) >> 8;
+        b[114] = rx.cfg.universe + u;
+        b[117] = 0x02;
+        b[118] = 0xA1;
+        b[122] = 1;
+        b[123] = (3 * n + 1) >> 8;
+        b[124] = 3 * n + 1;
+        size_t len = E131_DATA_HDR + put_rgb(&b[E131_DATA_HDR], f, px, n);
+        send_packet(s, a, b, len);
+    }
+    seq++;
+
+    memset(b, 0, E131_SYNC_SZ);
+    b[1] = 0x10;
+    memcpy(&b[4], acn_id, sizeof(acn_id));
+    b[21] = E131_ROOT_EXT;
+    b[43] = E131_EXT_SYNC;
+    b[44] = seq;
+    b[45] = sync >> 8;
+    b[46] = sync;
+    send_packet(s, a, b, E131_SYNC_SZ);
+}
+
+static void send_ddp(int s, const struct sockaddr_in *a, unsigned f)
+{
+    static unsigned seq = 1;
+    uint8_t b[10 + 1440];
+    for (unsigned px = 0; px < FB_PIXELS; px += 480) {
+        unsigned n = px + 480 > FB_PIXELS ? FB_PIXELS - px : 480;
+        b[0] = DDP_VER1 | (px + n == FB_PIXELS ? DDP_PUSH : 0);
+        b[1] = seq;
+        b[2] = 0x0B;
+        b[3] = 1;
+        b[4] = 0;
+        b[5] = (3 * px) >> 16;
+        b[6] = (3 * px) >> 8;
+        b[7] = 3 * px;
+        b[8] = (3 * n) >> 8;
+        b[9] = 3 * n;
+        send_packet(s, a, b, 10 + put_rgb(&b[10], f, px, n));
+        seq = seq % 15 + 1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    netrx_cfg_t cfg = {
+        .proto = argc > 1 && strcmp(argv[1], "ddp") == 0 ? NETRX_DDP : NETRX_E131,
+        .universe = 1,
+        .px_per_universe = 170,
+    };
+    unsigned n_frames = argc > 2 ? atoi(argv[2]) : 1000;
+    loss = argc > 3 ? atof(argv[3]) * 10 : 10;
+    if (n_frames > N_MAX_FRAMES || netrx_init(&rx, &cfg))
+        return 1;
+
+    pthread_t th;
+    pthread_create(&th, NULL, receiver, NULL);
+    usleep(100000);
+
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in a = {
+        .sin_family = AF_INET,
+        .sin_port = htons(cfg.proto == NETRX_E131 ? NETRX_E131_PORT : NETRX_DDP_PORT),
+    };
+    inet_pton(AF_INET, "127.0.0.1", &a.sin_addr);
+    for (unsigned f = 0; f < n_frames; f++) {
+        t_sent[f] = now_us();
+        if (cfg.proto == NETRX_E131)
+            send_e131(s, &a, f);
+        else
+            send_ddp(s, &a, f);
+        usleep(2000);
+    }
+    usleep(200000);
+    rx.stop = 1;
+    pthread_join(th, NULL);
+    close(s);
+
+    printf(
+        "%s: %u frames, %u packets sent, %u dropped by the sender\n",
+        cfg.proto == NETRX_E131 ? "E1.31" : "DDP", n_frames, n_sent, n_skipped
+    );
+    printf(
+        "checked %u complete frames, %u wrong, latency first packet -> show mean %lld us, max %lld us\n",
+        n_checked, n_bad, (long long)(n_checked ? t_lat / n_checked : 0), (long long)t_lat_max
+    );
+    netrx_print_stats(&rx);
+    return n_bad != 0;
+}
+#endif
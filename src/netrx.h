@@ -0,0 +1,88 @@
+#ifndef NETRX_H
+#define NETRX_H
+
+// Receiver for the E1.31 (sACN) and DDP pixel protocols, as spoken by lighting
+// desks and xLights / WLED style senders.
+//
+// The display is a stream of DISPLAY_WIDTH * DISPLAY_HEIGHT RGB pixels, row by
+// row from the top left (or snaking, see netrx_cfg_t). netrx_init() turns that
+// into a table of framebuf indices once, so the channel data of each packet is
+// written straight from the receive buffer into framebuf, whatever FB_LAYOUT is.
+//
+// E1.31: universe u carries pixels (u - universe) * px_per_universe onwards. A
+// frame is complete when the sync packet for its synchronization address comes
+// in or, without synchronization, when every universe has been received.
+// DDP: data offsets are bytes of the stream, the push flag completes a frame.
+//
+// Packet handling is plain C, so the receiver runs on the host as well:
+//   gcc -O2 -pthread -DNETRX_MAIN -Isrc -o netrx src/netrx.c src/framebuf.c src/encoder.c
+//   ./netrx [e131|ddp] [n_frames] [loss %]
+// sends test frames to itself over loopback UDP with simulated packet loss and
+// checks every complete frame.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "framebuf.h"
+
+#define NETRX_E131_PORT 5568
+#define NETRX_DDP_PORT  4048
+
+// Largest packet accepted, an E1.31 data packet with 512 channels is 638 bytes
+#define NETRX_MAX_PACKET 1472
+#define NETRX_MAX_UNIVERSES 32
+
+typedef enum {
+    NETRX_E131,
+    NETRX_DDP,
+} netrx_proto_t;
+
+typedef struct {
+    netrx_proto_t proto;
+    unsigned universe;          // E1.31: universe of the first pixel (1 ..)
+    unsigned px_per_universe;   // E1.31: pixels per universe, 170 fills the 512 channels
+    int serpentine;             // odd rows run from right to left
+} netrx_cfg_t;
+
+typedef struct {
+    unsigned packets, bytes;
+    unsigned frames;
+    unsigned lost;              // packets missing from the sequence numbers
+    unsigned late;              // out of order or repeated packets, dropped
+    unsigned bad;               // malformed, unsupported or not for us
+    unsigned partial;           // frames completed with data missing
+    unsigned dropped;           // frames which never completed, overwritten by the next one
+    int64_t t_asm, t_asm_max;   // first packet of a frame until it is complete [us]
+    int64_t t_show, t_show_max; // handing the frame over (update_frame()) [us]
+} netrx_stats_t;
+
+typedef struct {
+    netrx_cfg_t cfg;
+    uint16_t map[FB_PIXELS];    // stream pixel -> framebuf index
+    unsigned n_universes;
+    uint32_t seen;              // universes of the pending frame, bit u - cfg.universe
+    uint32_t seq_valid;         // universes with a sequence number in seq[]
+    uint8_t seq[NETRX_MAX_UNIVERSES];
+    unsigned sync;              // synchronization address of the pending frame, 0 = none
+    int ddp_seq;                // last DDP sequence number, -1 = none
+    unsigned lost_mark;         // st.lost when the pending frame started
+    int64_t t_first;            // arrival of the first packet of the pending frame, -1 = none
+    volatile int stop;          // set to make netrx_run() return
+    netrx_stats_t st;
+    uint8_t buf[NETRX_MAX_PACKET];  // receive buffer of netrx_run()
+} netrx_t;
+
+// Set up the receiver and the pixel mapping. Returns -1 if the universes don't fit.
+int netrx_init(netrx_t *rx, const netrx_cfg_t *cfg);
+
+// Process one packet received at t_us, its channel data goes straight into framebuf.
+// Returns 1 if a frame is complete and should be shown, 0 if not, -1 if the packet was dropped.
+int netrx_packet(netrx_t *rx, const uint8_t *buf, size_t len, int64_t t_us);
+
+// Receive on the protocol's UDP port until rx->stop is set, call show(arg) for each
+// complete frame, e.g. to run update_frame(). Returns -1 if the socket can't be opened.
+int netrx_run(netrx_t *rx, void (*show)(void *arg), void *arg);
+
+// Print the statistics since the previous call and reset them
+void netrx_print_stats(netrx_t *rx);
+
+#endif
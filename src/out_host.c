@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "host_util.h"
+#include "output.h"
+
+// Simulated panel: a thread takes the pending flip at the start of each
+// refresh, then reads the whole buffer twice, at the start and the end of the
+// refresh period, as the DMA would. A buffer that changed in between was
+// written while on display, which shows up as out_stats_t.torn.
+
+static struct {
+    const out_slot_t *buf[2];
+    unsigned refresh_hz;
+    int started;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t vsync;
+    int active, pending;        // buffer on display, flipped to, -1 = none
+    out_stats_t st;
+} h = {.lock = PTHREAD_MUTEX_INITIALIZER, .vsync = PTHREAD_COND_INITIALIZER};
+
+// Read every slot in scan order, like the DMA
+static uint32_t scan(const out_slot_t *slots)
+{
+    uint32_t sum = 0;
+    for (; slots->memory; slots++) {
+        const uint32_t *p = slots->memory;
+        for (size_t i = 0; i < slots->size / 4; i++)
+            sum = sum * 31 + p[i];
+    }
+    return sum;
+}
+
+static void *refresh_thread(void *arg)
+{
+    int64_t t_next = now_us();
+    while (1) {
+        pthread_mutex_lock(&h.lock);
+        if (h.pending >= 0) {
+            h.active = h.pending;
+            h.pending = -1;
+            pthread_cond_broadcast(&h.vsync);
+        }
+        int b = h.active;
+        int64_t period = 1000000 / h.refresh_hz;
+        pthread_mutex_unlock(&h.lock);
+
+        uint32_t sum = scan(h.buf[b]);
+        t_next += period;
+        int64_t wait = t_next - now_us();
+        if (wait > 0)
+            usleep(wait);
+        else
+            t_next = now_us();  // fell behind, don't catch up with short refreshes
+        uint32_t sum2 = scan(h.buf[b]);
+
+        pthread_mutex_lock(&h.lock);
+        h.st.refreshes++;
+        if (sum != sum2)
+            h.st.torn++;
+        pthread_mutex_unlock(&h.lock);
+    }
+    return NULL;
+}
+
+static int host_setup(const out_cfg_t *cfg)
+{
+    pthread_mutex_lock(&h.lock);
+    h.buf[0] = cfg->buf[0];
+    h.buf[1] = cfg->buf[1];
+    h.refresh_hz = cfg->refresh_hz ? cfg->refresh_hz : 100;
+    h.active = 0;
+    h.pending = -1;
+    memset(&h.st, 0, sizeof(h.st));
+    pthread_mutex_unlock(&h.lock);
+    if (!h.started) {
+        if (pthread_create(&h.thread, NULL, refresh_thread, NULL))
+            return -1;
+        h.started = 1;
+    }
+    return 0;
+}
+
+static void host_flip(int buf)
+{
+    pthread_mutex_lock(&h.lock);
+    h.pending = buf;
+    h.st.flips++;
+    pthread_mutex_unlock(&h.lock);
+}
+
+static void host_wait_vsync(void)
+{
+    pthread_mutex_lock(&h.lock);
+    if (h.pending >= 0) {
+        int64_t t0 = now_us();
+        while (h.pending >= 0)
+            pthread_cond_wait(&h.vsync, &h.lock);
+        int64_t t = now_us() - t0;
+        h.st.waits++;
+        h.st.t_wait += t;
+        if (t > h.st.t_wait_max)
+            h.st.t_wait_max = t;
+    }
+    pthread_mutex_unlock(&h.lock);
+}
+
+static void host_stats(out_stats_t *s)
+{
+    pthread_mutex_lock(&h.lock);
+    *s = h.st;
+    memset(&h.st, 0, sizeof(h.st));
+    pthread_mutex_unlock(&h.lock);
+}
+
+const out_backend_t out_host = {"host", host_setup, host_flip, host_wait_vsync, host_stats};
+
+#ifdef OUTPUT_MAIN
+// Soak test of the output side of the pipeline: draw, encode into the
+// backbuffer, flip, wait for vsync, for a while, then check nothing tore.
+#include "framebuf.h"
+#include "encoder.h"
+
+#define BITPLANE_CNT 7
+#define BITPLANE_SZ (DISPLAY_WIDTH * DISPLAY_HEIGHT / 2)
+
+#if FB_LAYOUT == ENC_FMT_ROWPAIR
+#define ENCODER "rowpair"
+#elif FB_LAYOUT == ENC_FMT_PLANAR
+#define ENCODER "planar"
+#else
+#define ENCODER "runs"
+#endif
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: out_host [-t seconds] [-r refresh_hz] [-f fps] [-n]\n  -n  don't wait for vsync\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned seconds = 10, refresh_hz = 100, fps = 0;
+    int vsync = 1, c;
+    while ((c = getopt(argc, argv, "t:r:f:n")) != -1) {
+        switch (c) {
+        case 't': seconds = atoi(optarg); break;
+        case 'r': refresh_hz = atoi(optarg); break;
+        case 'f': fps = atoi(optarg); break;
+        case 'n': vsync = 0; break;
+        default: usage();
+        }
+    }
+    if (optind != argc || refresh_hz == 0)
+        usage();
+
+    uint16_t *bitplane[2][BITPLANE_CNT];
+    for (int i = 0; i < BITPLANE_CNT; i++)
+        for (int j = 0; j < 2; j++)
+            bitplane[j][i] = calloc(BITPLANE_SZ, 2);
+    uint8_t order[(1 << BITPLANE_CNT) - 1];
+    unsigned n_slots = enc_schedule(order, BITPLANE_CNT);
+    out_slot_t slots[2][1 << BITPLANE_CNT];
+    for (unsigned i = 0; i < n_slots; i++)
+        for (int j = 0; j < 2; j++)
+            slots[j][i] = (out_slot_t){bitplane[j][order[i]], BITPLANE_SZ * 2};
+    slots[0][n_slots].memory = slots[1][n_slots].memory = NULL;
+
+    const out_backend_t *out = &out_host;
+    out_cfg_t ocfg = {.buf = {slots[0], slots[1]}, .refresh_hz = refresh_hz};
+    if (out->setup(&ocfg)) {
+        fprintf(stderr, "can't start the output\n");
+        return 1;
+    }
+    const enc_variant_t *enc = enc_find(ENCODER);
+    enc_cfg_t cfg = {
+        .width = DISPLAY_WIDTH, .rows = DISPLAY_HEIGHT / 2, .n_planes = BITPLANE_CNT, .brightness = 2,
+    };
+
+    int backbuf = 1;
+    unsigned n_frames = 0;
+    int64_t t_enc = 0, t_enc_max = 0;
+    int64_t t_start = now_us(), t_next = t_start;
+    while (now_us() - t_start < seconds * 1000000LL) {
+        // Diagonal colour bands moving one pixel per frame
+        for (unsigned y = 0; y < DISPLAY_HEIGHT; y++)
+            for (unsigned x = 0; x < DISPLAY_WIDTH; x++) {
+                unsigned v = (x + y + n_frames) & 0xFF;
+                setPixel(x, y, v << 16 | (255 - v) << 8 | (v * 3 & 0xFF));
+            }
+
+        if (vsync)
+            out->wait_vsync();
+        int64_t t0 = now_us();
+        enc->fn(bitplane[backbuf], framebuf, &cfg);
+        int64_t t = now_us() - t0;
+        t_enc += t;
+        if (t > t_enc_max)
+            t_enc_max = t;
+        out->flip(backbuf);
+        backbuf ^= 1;
+        n_frames++;
+
+        if (fps) {
+            t_next += 1000000 / fps;
+            int64_t wait = t_next - now_us();
+            if (wait > 0)
+                usleep(wait);
+        }
+    }
+
+    printf(
+        "%s: %u frames in %u s, encode mean %lld us, max %lld us\n",
+        enc->name, n_frames, seconds, (long long)(t_enc / n_frames), (long long)t_enc_max
+    );
+    out_print_stats(out);
+    return 0;
+}
+#endif
@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "i2s_parallel.h"
+#include "output.h"
+
+// -----------------
+//  LED panel GPIOs
+// -----------------
+// Upper half RGB
+#define GPIO_R1 GPIO_NUM_22
+#define GPIO_G1 GPIO_NUM_21
+#define GPIO_B1 GPIO_NUM_23
+// Lower half RGB
+#define GPIO_R2 GPIO_NUM_18
+#define GPIO_G2 GPIO_NUM_5
+#define GPIO_B2 GPIO_NUM_19
+// Control signals
+#if CONFIG_ESP32_SPIRAM_SUPPORT
+// GPIO16 / 17 are the PSRAM chip select and clock on WROVER modules
+#define GPIO_A GPIO_NUM_14
+#define GPIO_B GPIO_NUM_27
+#else
+#define GPIO_A GPIO_NUM_16
+#define GPIO_B GPIO_NUM_17
+#endif
+#define GPIO_C GPIO_NUM_2
+#define GPIO_D GPIO_NUM_4
+#define GPIO_E GPIO_NUM_32
+#define GPIO_LAT GPIO_NUM_15
+#define GPIO_OE GPIO_NUM_33
+#define GPIO_CLK GPIO_NUM_13
+
+// A pass over the buffer takes a few ms, give up on a flip after this
+#define FLIP_TIMEOUT_MS 100
+
+static out_stats_t st;
+static unsigned refresh_mark;
+
+// i2s_parallel_buffer_desc_t copy of a NULL terminated slot list
+static i2s_parallel_buffer_desc_t *to_desc(const out_slot_t *slots)
+{
+    unsigned n = 0;
+    while (slots[n].memory)
+        n++;
+    i2s_parallel_buffer_desc_t *desc = calloc(n + 1, sizeof(*desc));
+    if (desc)
+        for (unsigned i = 0; i < n; i++) {
+            desc[i].memory = slots[i].memory;
+            desc[i].size = slots[i].size;
+        }
+    return desc;
+}
+
+static int i2s_setup(const out_cfg_t *ocfg)
+{
+    i2s_parallel_config_t cfg={
+        // .gpio_bus={2, 15, 4, 16, 27, 17, -1, -1, 5, 18, 19, 21, 26, 25, -1, -1},
+        // .gpio_clk=22,
+
+        // -------------------
+        //  Espirgbani pinout
+        // -------------------
+        .gpio_bus={GPIO_R1, GPIO_G1, GPIO_B1, GPIO_R2, GPIO_G2, GPIO_B2, -1, -1, GPIO_A, GPIO_B, GPIO_C, GPIO_D, GPIO_LAT, GPIO_OE, -1, -1},
+        .gpio_clk=GPIO_CLK,
+
+        .bits=I2S_PARALLEL_BITS_16,
+        // .clk_div=1,     // illegal
+        .clk_div=2,     // = 20 MHz
+        // .clk_div=3,     // = 13.33 MHz
+        // .clk_div=4,     // = 10 MHz
+        // .clk_div=8,     // = 5 MHz
+        // .clk_div=16,     // = 2.5 MHz
+
+        .is_clk_inverted=false,
+        .bufa=to_desc(ocfg->buf[0]),
+        .bufb=to_desc(ocfg->buf[1]),
+    };
+    if (!cfg.bufa || !cfg.bufb) {
+        free(cfg.bufa);
+        free(cfg.bufb);
+        return -1;
+    }
+    //The DMA descriptors are built now, the lists aren't needed afterwards
+    i2s_parallel_setup(&I2S1, &cfg);
+    free(cfg.bufa);
+    free(cfg.bufb);
+    memset(&st, 0, sizeof(st));
+    refresh_mark = 0;
+    return 0;
+}
+
+static void i2s_flip(int buf)
+{
+    i2s_parallel_flip_to_buffer(&I2S1, buf);
+    st.flips++;
+}
+
+static void i2s_wait_vsync(void)
+{
+    int64_t t0 = esp_timer_get_time();
+    int ret = i2s_parallel_wait_flip(&I2S1, FLIP_TIMEOUT_MS / portTICK_PERIOD_MS);
+    int64_t t = esp_timer_get_time() - t0;
+    if (ret < 0)
+        printf("out_i2s: flip timed out\n");
+    if (ret) {
+        st.waits++;
+        st.t_wait += t;
+        if (t > st.t_wait_max)
+            st.t_wait_max = t;
+    }
+}
+
+static void i2s_stats(out_stats_t *s)
+{
+    unsigned n = i2s_parallel_refresh_count(&I2S1);
+    *s = st;
+    s->refreshes = n - refresh_mark;
+    refresh_mark = n;
+    memset(&st, 0, sizeof(st));
+}
+
+const out_backend_t out_i2s = {"i2s", i2s_setup, i2s_flip, i2s_wait_vsync, i2s_stats};
@@ -0,0 +1,14 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "output.h"
+
+void out_print_stats(const out_backend_t *out)
+{
+    out_stats_t st;
+    out->stats(&st);
+    printf(
+        "%s output: %u flips, %u refreshes, %u waits for vsync (mean %lld us, max %lld us), %u torn\n",
+        out->name, st.flips, st.refreshes, st.waits,
+        (long long)(st.waits ? st.t_wait / st.waits : 0), (long long)st.t_wait_max, st.torn
+    );
+}
@@ -0,0 +1,56 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+// Where the encoded bitplanes go. The pipeline only sees this interface, so it
+// runs the same against the panel or against a simulated one.
+//
+//   out_i2s   the panel, through I2S1 in parallel mode and DMA (src/out_i2s.c)
+//   out_host  a thread which scans the flipped buffer at a simulated refresh
+//             rate and checks it isn't written while on display (src/out_host.c)
+//
+// out_host builds on the host as well, together with a soak test of the
+// encode -> flip -> wait for vsync loop:
+//   gcc -O2 -pthread -DOUTPUT_MAIN -Isrc -o out_host src/out_host.c src/output.c src/framebuf.c src/encoder.c
+//   ./out_host [-t seconds] [-r refresh_hz] [-f fps] [-n]
+
+#include <stdint.h>
+#include <stddef.h>
+
+// One DMA slot: a bitplane sent to the panel once
+typedef struct {
+    void *memory;
+    size_t size;
+} out_slot_t;
+
+typedef struct {
+    const out_slot_t *buf[2];   // slots of each of the two frame buffers in scan order, ended by memory == NULL
+    unsigned refresh_hz;        // out_host: simulated panel refresh rate
+} out_cfg_t;
+
+typedef struct {
+    unsigned flips;
+    unsigned refreshes;         // passes over the buffer on display
+    unsigned waits;             // wait_vsync() calls which had to wait
+    int64_t t_wait, t_wait_max; // [us]
+    unsigned torn;              // out_host: refreshes whose buffer changed while on display
+} out_stats_t;
+
+typedef struct {
+    const char *name;
+    // Start showing buf[0]. The slot lists must stay valid. Returns 0 or -1.
+    int (*setup)(const out_cfg_t *cfg);
+    // Show buffer 0 or 1 from the end of the current refresh on
+    void (*flip)(int buf);
+    // Wait until the buffer of the last flip is on display, the other one is then free
+    void (*wait_vsync)(void);
+    // Statistics since the previous call
+    void (*stats)(out_stats_t *st);
+} out_backend_t;
+
+extern const out_backend_t out_i2s;
+extern const out_backend_t out_host;
+
+// Print out_stats_t in one line
+void out_print_stats(const out_backend_t *out);
+
+#endif
@@ -0,0 +1,45 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "esp_heap_caps.h"
+
+#include "framebuf.h"
+#include "psram.h"
+
+// CONFIG_HEAP_ABORT_WHEN_ALLOCATION_FAILS is set, only ask a heap for what it has
+static void *alloc_caps(size_t sz, uint32_t caps)
+{
+    if (heap_caps_get_largest_free_block(caps) < sz)
+        return NULL;
+    return heap_caps_malloc(sz, caps);
+}
+
+void *psram_alloc(size_t sz, bool *in_psram)
+{
+    void *p = alloc_caps(sz, MALLOC_CAP_SPIRAM);
+    if (in_psram)
+        *in_psram = p != NULL;
+    return p ? p : alloc_caps(sz, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+int canvas_init(canvas_t *cv, unsigned w, unsigned h, bool psram)
+{
+    size_t sz = (size_t)w * h * sizeof(uint32_t);
+    cv->w = w;
+    cv->h = h;
+    cv->pix = NULL;
+    cv->in_psram = false;
+    if (w < DISPLAY_WIDTH || h < DISPLAY_HEIGHT)
+        return -1;
+    if (psram)
+        cv->pix = psram_alloc(sz, &cv->in_psram);
+    else
+        cv->pix = alloc_caps(sz, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return cv->pix ? 0 : -1;
+}
+
+void canvas_free(canvas_t *cv)
+{
+    free(cv->pix);
+    cv->pix = NULL;
+}
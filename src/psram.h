@@ -0,0 +1,38 @@
+#ifndef PSRAM_H
+#define PSRAM_H
+
+// Bulk data in external PSRAM. The I2S DMA can't read PSRAM, so the bitplanes
+// stay in internal RAM. Images, frame pools and decoded assets go to PSRAM
+// instead, and the encoder reads them through the cache (enc_canvas()).
+//
+// PSRAM needs CONFIG_ESP32_SPIRAM_SUPPORT. On WROVER modules it takes GPIO16 / 17,
+// out_i2s.c moves panel lines A and B elsewhere then. Without PSRAM everything
+// falls back to internal RAM.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Allocate sz bytes in PSRAM if there is room, internal RAM otherwise, NULL if
+// neither has. Sets *in_psram (if not NULL) to where it went. Free with free().
+void *psram_alloc(size_t sz, bool *in_psram);
+
+// A linear image larger than the display, e.g. to pan around in
+typedef struct {
+    uint32_t *pix;      // pixels, MSB {x, R, G, B} LSB, row after row
+    unsigned w, h;
+    bool in_psram;
+} canvas_t;
+
+// Allocate a w x h canvas, in PSRAM if psram is set and there is room. Returns -1
+// if it is smaller than the display or out of memory.
+int canvas_init(canvas_t *cv, unsigned w, unsigned h, bool psram);
+
+void canvas_free(canvas_t *cv);
+
+static inline void canvas_set(canvas_t *cv, unsigned x, unsigned y, uint32_t col)
+{
+    cv->pix[x + y * cv->w] = col;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include <string.h>
+#include "framebuf.h"
+#include "qoi.h"
+
+#define OP_INDEX 0x00
+#define OP_DIFF  0x40
+#define OP_LUMA  0x80
+#define OP_RUN   0xC0
+#define OP_RGB   0xFE
+#define OP_RGBA  0xFF
+#define OP_MASK  0xC0
+
+static const uint8_t end_marker[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+
+static inline unsigned u32be(const uint8_t *p)
+{
+    return (unsigned)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+int qoi_info(qoi_info_t *info, const uint8_t *data, size_t len)
+{
+    if (len < QOI_HEADER_SZ || memcmp(data, "qoif", 4))
+        return -1;
+    info->width = u32be(&data[4]);
+    info->height = u32be(&data[8]);
+    info->channels = data[12];
+    if (info->width == 0 || info->height == 0 || info->channels < 3 || info->channels > 4)
+        return -1;
+    return 0;
+}
+
+// Colour cache slot of a pixel, MSB {A, R, G, B} LSB
+static inline unsigned hash(uint32_t c)
+{
+    return ((c >> 16 & 0xFF) * 3 + (c >> 8 & 0xFF) * 5 + (c & 0xFF) * 7 + (c >> 24) * 11) & 63;
+}
+
+int qoi_decode(const uint8_t *data, size_t len, int x0, int y0)
+{
+    qoi_info_t info;
+    if (qoi_info(&info, data, len))
+        return -1;
+
+    const uint8_t *p = data + QOI_HEADER_SZ, *end = data + len;
+    uint32_t cache[64] = {0};
+    uint32_t px = 0xFF000000;   // previous pixel, opaque black
+    unsigned run = 0;
+
+    for (unsigned y = 0; y < info.height; y++) {
+        int py = y0 + y;
+        int row_visible = py >= 0 && py < DISPLAY_HEIGHT;
+        for (unsigned x = 0; x < info.width; x++) {
+            if (run) {
+                run--;
+            } else {
+                if (p >= end)
+                    return -1;
+                unsigned b = *p++;
+                if (b == OP_RGB || b == OP_RGBA) {
+                    unsigned n = b == OP_RGB ? 3 : 4;
+                    if (p + n > end)
+                        return -1;
+                    px = (px & 0xFF000000) | p[0] << 16 | p[1] << 8 | p[2];
+                    if (n == 4)
+                        px = (px & 0x00FFFFFF) | (uint32_t)p[3] << 24;
+                    p += n;
+                } else if ((b & OP_MASK) == OP_INDEX) {
+                    px = cache[b];
+                } else if ((b & OP_MASK) == OP_DIFF) {
+                    // per channel difference -2 .. 1, wrapping
+                    unsigned r = (px >> 16) + ((b >> 4) & 3) - 2;
+                    unsigned g = (px >> 8) + ((b >> 2) & 3) - 2;
+                    unsigned bl = px + (b & 3) - 2;
+                    px = (px & 0xFF000000) | (r & 0xFF) << 16 | (g & 0xFF) << 8 | (bl & 0xFF);
+                } else if ((b & OP_MASK) == OP_LUMA) {
+                    if (p >= end)
+                        return -1;
+                    int dg = (b & 0x3F) - 32;
+                    unsigned b2 = *p++;
+                    int dr = dg + (b2 >> 4) - 8, db = dg + (b2 & 15) - 8;
+                    unsigned r = (px >> 16) + dr, g = (px >> 8) + dg, bl = px + db;
+                    px = (px & 0xFF000000) | (r & 0xFF) << 16 | (g & 0xFF) << 8 | (bl & 0xFF);
+                } else {
+                    // OP_RUN, this pixel and (b & 0x3F) more
+                    run = b & 0x3F;
+                }
+                cache[hash(px)] = px;
+            }
+            int pxx = x0 + x;
+            if (row_visible && pxx >= 0 && pxx < DISPLAY_WIDTH)
+                setPixel(pxx, py, px & 0x00FFFFFF);
+        }
+    }
+    // end marker
+    if (p + 8 > end || memcmp(p, end_marker, 8))
+        return -1;
+    return p + 8 - data;
+}
@@ -0,0 +1,28 @@
+#ifndef QOI_H
+#define QOI_H
+
+// Decoder for the QOI image format (https://qoiformat.org), a cheap lossless
+// codec: one byte oriented pass, no tables beyond a 64 entry colour cache.
+// Pixels are decoded straight into framebuf, row by row. Alpha is ignored.
+// tools/qoiconv.c encodes raw RGB24 images and frame sequences.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define QOI_HEADER_SZ 14
+
+typedef struct {
+    unsigned width, height;
+    unsigned channels;      // 3 = RGB, 4 = RGBA
+} qoi_info_t;
+
+// Parse the header. Returns 0 or -1 if this is not a QOI image.
+int qoi_info(qoi_info_t *info, const uint8_t *data, size_t len);
+
+// Decode the image into framebuf with its top left corner at (x0, y0), clipped
+// to the display. Returns the size of the image in bytes or -1 if the data is
+// malformed or truncated. Animations are QOI images back to back, the return
+// value is the offset of the next frame.
+int qoi_decode(const uint8_t *data, size_t len, int x0, int y0);
+
+#endif
@@ -0,0 +1,127 @@
+#include <stdint.h>
+#include <math.h>
+#include "framebuf.h"
+#include "rotozoom.h"
+
+void rz_map(rz_map_t *m, int32_t tu, int32_t tv, float angle, float zoom)
+{
+    float c = cosf(angle) / zoom, s = sinf(angle) / zoom;
+    m->dudx = RZ_FX(c);
+    m->dvdx = RZ_FX(-s);
+    m->dudy = RZ_FX(s);
+    m->dvdy = RZ_FX(c);
+    // pixel (0, 0) is (0.5 - W / 2, 0.5 - H / 2) from the display centre
+    float dx = 0.5f - DISPLAY_WIDTH / 2, dy = 0.5f - DISPLAY_HEIGHT / 2;
+    m->u = tu + RZ_FX(c * dx + s * dy);
+    m->v = tv + RZ_FX(-s * dx + c * dy);
+}
+
+static inline uint32_t texel(const uint8_t *p)
+{
+    return p[0] << 16 | p[1] << 8 | p[2];
+}
+
+// The coordinates are stepped as unsigned so they can wrap around. Each mode
+// has its own loop to keep the addressing decisions out of the pixel loop.
+int rz_draw(const rz_tex_t *t, const rz_map_t *m)
+{
+    uint32_t ru = m->u, rv = m->v;
+    if (t->mode == RZ_WRAP) {
+        if (t->w & (t->w - 1) || t->h & (t->h - 1))
+            return -1;
+        unsigned shift = __builtin_ctz(t->w);
+        uint32_t mu = t->w - 1, mv = t->h - 1;
+        for (unsigned y = 0; y < DISPLAY_HEIGHT; y++) {
+            uint32_t u = ru, v = rv;
+            for (unsigned x = 0; x < DISPLAY_WIDTH; x++) {
+                unsigned i = ((v >> RZ_FRAC) & mv) << shift | ((u >> RZ_FRAC) & mu);
+                fb_set(fb_index(x, y), texel(&t->pix[3 * i]));
+                u += m->dudx;
+                v += m->dvdx;
+            }
+            ru += m->dudy;
+            rv += m->dvdy;
+        }
+    } else {
+        int clamp = t->mode == RZ_CLAMP;
+        for (unsigned y = 0; y < DISPLAY_HEIGHT; y++) {
+            uint32_t u = ru, v = rv;
+            for (unsigned x = 0; x < DISPLAY_WIDTH; x++) {
+                // floor, the arithmetic shift rounds negative coordinates down
+                int tx = (int32_t)u >> RZ_FRAC, ty = (int32_t)v >> RZ_FRAC;
+                uint32_t col;
+                if ((unsigned)tx < t->w && (unsigned)ty < t->h) {
+                    col = texel(&t->pix[3 * (tx + ty * t->w)]);
+                } else if (clamp) {
+                    tx = tx < 0 ? 0 : (unsigned)tx >= t->w ? (int)t->w - 1 : tx;
+                    ty = ty < 0 ? 0 : (unsigned)ty >= t->h ? (int)t->h - 1 : ty;
+                    col = texel(&t->pix[3 * (tx + ty * t->w)]);
+                } else {
+                    col = t->border;
+                }
+                fb_set(fb_index(x, y), col);
+                u += m->dudx;
+                v += m->dvdx;
+            }
+            ru += m->dudy;
+            rv += m->dvdy;
+        }
+    }
+    return 0;
+}
+
+#ifdef ROTOZOOM_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_util.h"
+
+// What rz_draw() must give for pixel (x, y), with the mapping evaluated directly
+static uint32_t pixel_ref(const rz_tex_t *t, const rz_map_t *m, int x, int y)
+{
+    int64_t u = m->u + (int64_t)x * m->dudx + (int64_t)y * m->dudy;
+    int64_t v = m->v + (int64_t)x * m->dvdx + (int64_t)y * m->dvdy;
+    int64_t tx = u >> RZ_FRAC, ty = v >> RZ_FRAC;
+    if (t->mode == RZ_WRAP) {
+        tx &= t->w - 1;
+        ty &= t->h - 1;
+    } else if (tx < 0 || tx >= t->w || ty < 0 || ty >= t->h) {
+        if (t->mode == RZ_BORDER)
+            return t->border;
+        tx = tx < 0 ? 0 : tx >= t->w ? t->w - 1 : tx;
+        ty = ty < 0 ? 0 : ty >= t->h ? t->h - 1 : ty;
+    }
+    return texel(&t->pix[3 * (tx + ty * t->w)]);
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t pix[3 * 64 * 64];
+    for (unsigned i = 0; i < sizeof(pix); i++)
+        pix[i] = rnd();
+    unsigned n = argc > 1 ? strtoul(argv[1], NULL, 0) : 3000, fails = 0;
+    double t_draw = 0;
+    for (unsigned k = 0; k < n; k++) {
+        rz_tex_t t = {.pix = pix, .mode = k % 3, .border = 0x123456};
+        t.w = t.mode == RZ_WRAP ? 1u << (rnd() % 7) : 1 + rnd() % 64;
+        t.h = t.mode == RZ_WRAP ? 1u << (rnd() % 7) : 1 + rnd() % 64;
+        rz_map_t m;
+        float zoom = 0.05f + (rnd() % 1000) / 100.0f;
+        rz_map(&m, RZ_FX(rnd() % 128) - RZ_FX(32), RZ_FX(rnd() % 128) - RZ_FX(32), (rnd() % 6283) / 1000.0f, zoom);
+        // shear now and then
+        if (k % 5 == 0)
+            m.dudy += RZ_FX(0.3);
+        double t0 = cpu_us();
+        rz_draw(&t, &m);
+        t_draw += cpu_us() - t0;
+        for (int y = 0; y < DISPLAY_HEIGHT; y++)
+            for (int x = 0; x < DISPLAY_WIDTH; x++)
+                if (getPixel(x, y) != pixel_ref(&t, &m, x, y) && fails++ < 10)
+                    printf("case %u, mode %d: pixel %d, %d differs\n", k, t.mode, x, y);
+    }
+    printf(
+        "%u frames checked, %u failures, %.1f us per %dx%d frame\n",
+        n, fails, t_draw / n, DISPLAY_WIDTH, DISPLAY_HEIGHT
+    );
+    return fails != 0;
+}
+#endif
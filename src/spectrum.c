@@ -0,0 +1,247 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "framebuf.h"
+#include "fft.h"
+#include "spectrum.h"
+
+// A full scale sine in one bin: 32767 / 2 (window) / 2 (real input), squared
+#define TOP_LOG2 (26 << 8)
+// Shown range below the top, log2 Q8 of the power: 20 = 60 dB
+#define RANGE_LOG2 (20 << 8)
+
+// Bars fall in 40 analyses from the top, peak markers hold for 30, then fall in 60
+#define FALL (SPEC_ONE / 40)
+#define HOLD 30
+#define PEAK_FALL (SPEC_ONE / 60)
+
+int spec_init(spec_t *s, unsigned rate, unsigned n_bands, unsigned f_lo, unsigned f_hi)
+{
+    memset(s, 0, sizeof(*s));
+    if (n_bands == 0 || n_bands > SPEC_MAX_BANDS || f_lo == 0 || f_hi <= f_lo || f_hi > rate / 2)
+        return -1;
+    s->rate = rate;
+    s->n_bands = n_bands;
+    // Log spaced, but at least one bin per band
+    float bin = (float)rate / FFT_N;
+    for (unsigned i = 0; i <= n_bands; i++) {
+        unsigned e = lroundf(f_lo * powf((float)f_hi / f_lo, (float)i / n_bands) / bin);
+        if (i && e <= s->edge[i - 1])
+            e = s->edge[i - 1] + 1;
+        if (e > FFT_N / 2)
+            return -1;
+        s->edge[i] = e;
+    }
+    return 0;
+}
+
+void spec_push(spec_t *s, const int16_t *samples, unsigned n)
+{
+    for (unsigned i = 0; i < n; i++) {
+        s->ring[s->pos] = samples[i];
+        s->pos = (s->pos + 1) % FFT_N;
+    }
+}
+
+// log2(v) in Q8, the fraction linear between powers of 2
+static int log2_q8(uint64_t v)
+{
+    if (v == 0)
+        return 0;
+    int n = 63 - __builtin_clzll(v);
+    unsigned m = n >= 8 ? v >> (n - 8) : v << (8 - n);
+    return n * 256 + (m - 256);
+}
+
+void spec_analyse(spec_t *s)
+{
+    // Windowed real input, oldest sample first
+    for (unsigned i = 0; i < FFT_N; i++) {
+        int w = fft_window[i < FFT_N / 2 ? i : FFT_N - 1 - i];
+        s->x[2 * i] = s->ring[(s->pos + i) % FFT_N] * w >> 15;
+        s->x[2 * i + 1] = 0;
+    }
+    fft_q15(s->x);
+
+    for (unsigned b = 0; b < s->n_bands; b++) {
+        uint64_t p = 0;
+        for (unsigned k = s->edge[b]; k < s->edge[b + 1]; k++) {
+            const int16_t *y = &s->x[2 * fft_pos[k]];
+            p += (uint32_t)(y[0] * y[0]) + (uint32_t)(y[1] * y[1]);
+        }
+        int l = log2_q8(p) + s->gain - (TOP_LOG2 - RANGE_LOG2);
+        l = l < 0 ? 0 : l > RANGE_LOG2 ? SPEC_ONE : l * SPEC_ONE / RANGE_LOG2;
+
+        // Up at once, down slowly
+        if (l >= s->level[b])
+            s->level[b] = l;
+        else
+            s->level[b] = s->level[b] > l + FALL ? s->level[b] - FALL : l;
+
+        if (s->level[b] >= s->peak[b]) {
+            s->peak[b] = s->level[b];
+            s->hold[b] = HOLD;
+        } else if (s->hold[b]) {
+            s->hold[b]--;
+        } else {
+            s->peak[b] = s->peak[b] > PEAK_FALL ? s->peak[b] - PEAK_FALL : 0;
+        }
+    }
+}
+
+static uint32_t scale(uint32_t col, unsigned a)
+{
+    return ((col >> 16 & 0xFF) * a >> 8) << 16 | ((col >> 8 & 0xFF) * a >> 8) << 8 | ((col & 0xFF) * a >> 8);
+}
+
+static void span(int x, int y, unsigned n, uint32_t col)
+{
+    for (unsigned i = 0; i < n; i++)
+        setPixel(x + i, y, col);
+}
+
+void spec_draw(const spec_t *s, int x0, int y0, unsigned w, unsigned h)
+{
+    if (x0 < 0 || y0 < 0 || x0 + w > DISPLAY_WIDTH || y0 + h > DISPLAY_HEIGHT || w < s->n_bands || h == 0)
+        return;
+    unsigned bw = w / s->n_bands, gap = bw > 2;
+    int xl = x0 + (w - bw * s->n_bands) / 2;
+
+    // Bar tops and peak rows in pixels from the bottom, tops in Q8
+    unsigned top[SPEC_MAX_BANDS], pk[SPEC_MAX_BANDS];
+    for (unsigned b = 0; b < s->n_bands; b++) {
+        top[b] = s->level[b] * h * 256 / SPEC_ONE;
+        pk[b] = s->peak[b] ? (s->peak[b] * h - 1) / SPEC_ONE : h;
+    }
+
+    for (unsigned r = 0; r < h; r++) {
+        unsigned k = h - 1 - r;
+        // green at the bottom, through yellow to red at the top
+        unsigned t = k * 511 / (h > 1 ? h - 1 : 1);
+        uint32_t col = t < 256 ? t << 16 | 0xFF00 : 0xFF0000 | (511 - t) << 8;
+        int y = y0 + r;
+        span(x0, y, xl - x0, 0);
+        for (unsigned b = 0; b < s->n_bands; b++) {
+            uint32_t c = 0;
+            if (pk[b] == k)
+                c = 0xFFFFFF;
+            else if (top[b] >= (k + 1) * 256)
+                c = col;
+            else if (top[b] > k * 256)
+                c = scale(col, top[b] - k * 256);
+            span(xl + b * bw, y, bw - gap, c);
+            span(xl + b * bw + bw - gap, y, gap, 0);
+        }
+        span(xl + bw * s->n_bands, y, x0 + w - (xl + bw * s->n_bands), 0);
+    }
+}
+
+#ifdef SPECTRUM_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_util.h"
+
+static unsigned u32le(const uint8_t *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+}
+
+// 16 bit PCM WAV, channels mixed down to mono. Returns the number of samples or -1.
+static long read_wav(const char *path, int16_t **out, unsigned *rate)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return -1;
+    uint8_t hdr[12], ch[8];
+    unsigned n_ch = 0, bits = 0;
+    long n = -1;
+    if (fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) || memcmp(&hdr[8], "WAVE", 4))
+        goto out;
+    while (fread(ch, 1, 8, f) == 8) {
+        unsigned len = u32le(&ch[4]);
+        if (memcmp(ch, "fmt ", 4) == 0) {
+            uint8_t fmt[16];
+            if (len < 16 || fread(fmt, 1, 16, f) != 16)
+                goto out;
+            fseek(f, len - 16 + (len & 1), SEEK_CUR);
+            n_ch = fmt[2] | fmt[3] << 8;
+            *rate = u32le(&fmt[4]);
+            bits = fmt[14] | fmt[15] << 8;
+            if ((fmt[0] | fmt[1] << 8) != 1 || bits != 16 || n_ch == 0)
+                goto out;
+        } else if (memcmp(ch, "data", 4) == 0 && n_ch) {
+            int16_t *raw = malloc(len);
+            n = fread(raw, 2, len / 2, f) / n_ch;
+            *out = malloc(n * sizeof(int16_t));
+            for (long i = 0; i < n; i++) {
+                int sum = 0;
+                for (unsigned c = 0; c < n_ch; c++)
+                    sum += raw[i * n_ch + c];
+                (*out)[i] = sum / (int)n_ch;
+            }
+            free(raw);
+            goto out;
+        } else {
+            fseek(f, len + (len & 1), SEEK_CUR);
+        }
+    }
+out:
+    fclose(f);
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    int16_t *pcm;
+    unsigned rate = 16000;
+    long n;
+    if (argc > 1) {
+        n = read_wav(argv[1], &pcm, &rate);
+        if (n < 0) {
+            fprintf(stderr, "%s: not a 16 bit PCM WAV file\n", argv[1]);
+            return 1;
+        }
+    } else {
+        // 5 s sweep from 50 Hz to 7 kHz at half scale
+        n = 5 * rate;
+        pcm = malloc(n * sizeof(int16_t));
+        double ph = 0;
+        for (long i = 0; i < n; i++) {
+            ph += 2 * M_PI * 50 * pow(140, (double)i / n) / rate;
+            pcm[i] = 16384 * sin(ph);
+        }
+    }
+
+    static spec_t s;
+    if (spec_init(&s, rate, 32, 50, rate / 2 < 12000 ? rate / 2 : 12000)) {
+        fprintf(stderr, "can't set up the bands for %u Hz\n", rate);
+        return 1;
+    }
+    unsigned hop = rate / SPEC_FPS, n_an = 0;
+    int64_t t_an = 0, t_an_max = 0, t_draw = 0;
+    for (long i = 0; i + hop <= n; i += hop) {
+        spec_push(&s, &pcm[i], hop);
+        int64_t t0 = now_us();
+        spec_analyse(&s);
+        int64_t t1 = now_us();
+        spec_draw(&s, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        t_draw += now_us() - t1;
+        t_an += t1 - t0;
+        if (t1 - t0 > t_an_max)
+            t_an_max = t1 - t0;
+        if (n_an++ % 15 == 0) {
+            printf("%6.2f s |", (double)i / rate);
+            for (unsigned b = 0; b < s.n_bands; b++)
+                putchar(" _.-=+*#"[s.level[b] * 8 / (SPEC_ONE + 1)]);
+            printf("|\n");
+        }
+    }
+    if (n_an)
+        printf(
+            "%u analyses at %u Hz, analysis mean %lld us, max %lld us, drawing mean %lld us\n",
+            n_an, rate, (long long)(t_an / n_an), (long long)t_an_max, (long long)(t_draw / n_an)
+        );
+    free(pcm);
+    return 0;
+}
+#endif
@@ -0,0 +1,50 @@
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+// Audio spectrum bars. The last FFT_N samples are windowed and transformed
+// (src/fft.c), the bins summed into log spaced bands and the band powers
+// turned into bar heights on a log scale. Bars jump up and fall back slowly,
+// a peak marker holds the highest recent level for a moment, then drops.
+//
+// Feed it SPEC_FPS times per second, rate / SPEC_FPS samples each time.
+// On the host it reads a WAV file (16 bit PCM) or makes a sweep and prints
+// the bars as text, with the analysis time:
+//   gcc -O2 -DSPECTRUM_MAIN -Isrc -o spectrum src/spectrum.c src/fft.c src/fft_tab.c src/framebuf.c src/encoder.c -lm
+//   ./spectrum [music.wav]
+
+#include <stdint.h>
+#include "fft.h"
+
+#define SPEC_FPS 60
+#define SPEC_MAX_BANDS 64
+// bar height of a full band
+#define SPEC_ONE 4096
+
+typedef struct {
+    unsigned rate;                      // sample rate [Hz]
+    unsigned n_bands;
+    uint16_t edge[SPEC_MAX_BANDS + 1];  // first FFT bin of each band, the last one ends the last band
+    int gain;                           // added to the band powers, log2 Q8 (256 = 3 dB)
+    int16_t ring[FFT_N];                // the last FFT_N samples
+    unsigned pos;                       // oldest sample in ring
+    int16_t x[2 * FFT_N];               // FFT work buffer
+    uint16_t level[SPEC_MAX_BANDS];     // bar heights, 0 .. SPEC_ONE
+    uint16_t peak[SPEC_MAX_BANDS];      // peak markers, 0 .. SPEC_ONE
+    uint8_t hold[SPEC_MAX_BANDS];       // analyses the peak marker stays where it is
+} spec_t;
+
+// Set up n_bands bands, log spaced from f_lo to f_hi (at most rate / 2).
+// Returns -1 if n_bands or the frequencies are out of range.
+int spec_init(spec_t *s, unsigned rate, unsigned n_bands, unsigned f_lo, unsigned f_hi);
+
+// Append samples to the analysis window
+void spec_push(spec_t *s, const int16_t *samples, unsigned n);
+
+// Analyse the window, update the bars and peak markers
+void spec_analyse(spec_t *s);
+
+// Draw the bars into the w x h pixel area at (x0, y0), row by row as spans.
+// Bars are w / n_bands wide, with a pixel of gap if that leaves at least 2.
+void spec_draw(const spec_t *s, int x0, int y0, unsigned w, unsigned h);
+
+#endif
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "tasks.h"
+
+typedef struct {
+    const char *name;
+    BaseType_t core;
+    UBaseType_t prio;
+    uint32_t stack;
+} task_cfg_t;
+
+static const task_cfg_t task_cfg[TASK_CNT] = {
+    [TASK_RENDER] = {"render", TASK_RENDER_CORE, TASK_RENDER_PRIO, TASK_RENDER_STACK},
+    [TASK_ENCODE] = {"encode", TASK_ENCODE_CORE, TASK_ENCODE_PRIO, TASK_ENCODE_STACK},
+    [TASK_ASSET] = {"asset", TASK_ASSET_CORE, TASK_ASSET_PRIO, TASK_ASSET_STACK},
+    [TASK_CONSOLE] = {"console", TASK_CONSOLE_CORE, TASK_CONSOLE_PRIO, TASK_CONSOLE_STACK},
+};
+
+TaskHandle_t tasks_start(task_id_t id, TaskFunction_t fn, void *arg)
+{
+    const task_cfg_t *c = &task_cfg[id];
+    TaskHandle_t h = NULL;
+    BaseType_t ret = xTaskCreatePinnedToCore(fn, c->name, c->stack, arg, c->prio, &h, c->core);
+    assert(ret == pdPASS && "Can't create task");
+    return h;
+}
+
+// Run time counters of the previous call, indexed by task number
+#define MAX_TASKS 32
+static uint32_t prev_runtime[MAX_TASKS];
+static uint32_t prev_total;
+
+void tasks_print_stats(void)
+{
+    // Static, about 1.3 kB would be a big bite of the console task's stack
+    static TaskStatus_t st[MAX_TASKS];
+    uint32_t total;
+    UBaseType_t n = uxTaskGetSystemState(st, MAX_TASKS, &total);
+    if (n == 0) {
+        printf("Too many tasks\n");
+        return;
+    }
+
+    // Percentages are relative to one core, so they add up to 200 % at most
+    uint32_t dt = total - prev_total;
+    prev_total = total;
+    printf("%-16s %4s %7s %9s\n", "task", "prio", "cpu", "stack_free");
+    for (UBaseType_t i = 0; i < n; i++) {
+        unsigned num = st[i].xTaskNumber % MAX_TASKS;
+        uint32_t run = st[i].ulRunTimeCounter - prev_runtime[num];
+        prev_runtime[num] = st[i].ulRunTimeCounter;
+        printf(
+            "%-16s %4u %6.1f%% %9u\n",
+            st[i].pcTaskName,
+            (unsigned)st[i].uxCurrentPriority,
+            dt ? 100.0 * run / dt : 0.0,
+            (unsigned)st[i].usStackHighWaterMark
+        );
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef TASKS_H
+#define TASKS_H
+
+// Layout of the tasks making up the display pipeline.
+//
+// The encode task feeds the DMA bitplanes and must never be starved, so it
+// gets its own core and the highest priority. Application logic (rendering the
+// frames) runs on the other core, next to the WiFi / system tasks.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Core (0, 1 or tskNO_AFFINITY), priority and stack size [bytes] of each task
+#define TASK_RENDER_CORE     0
+#define TASK_RENDER_PRIO     5
+#define TASK_RENDER_STACK    4096
+
+#define TASK_ENCODE_CORE     1
+#define TASK_ENCODE_PRIO     (configMAX_PRIORITIES - 2)
+#define TASK_ENCODE_STACK    3072
+
+#define TASK_ASSET_CORE      0
+#define TASK_ASSET_PRIO      6
+#define TASK_ASSET_STACK     3072
+
+#define TASK_CONSOLE_CORE    0
+#define TASK_CONSOLE_PRIO    2
+#define TASK_CONSOLE_STACK   3072
+
+typedef enum {
+    TASK_RENDER,    // draws into framebuf, calls update_frame()
+    TASK_ENCODE,    // converts framebuf into the DMA bitplanes
+    TASK_ASSET,     // reads assets from flash / storage ahead of time
+    TASK_CONSOLE,   // serial command line
+    TASK_CNT
+} task_id_t;
+
+// Create one of the pipeline tasks with its configured core, priority and stack
+TaskHandle_t tasks_start(task_id_t id, TaskFunction_t fn, void *arg);
+
+// Print CPU utilisation (since the previous call) and stack headroom of all tasks
+void tasks_print_stats(void);
+
+#endif
@@ -1,3 +1,6 @@
 
+//Inverted LED brightness curve, 65535 = off, 0 = full on
+extern const uint16_t lumConvTab[256];
+
 //Converts an 0-255 intensity value to an equivalent  0-255 LED PWM value
 uint8_t valToPwm(int val);
@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "tasks.h"
+#include "psram.h"
+#else
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include "host_util.h"
+#endif
+#include "vidfile.h"
+
+// Counting semaphores between the decoder and the reader: `free` counts buffers
+// the reader may fill, `filled` the ones ready for decoding, in the order 0, 1, 0, ..
+#ifdef ESP_PLATFORM
+typedef SemaphoreHandle_t vf_sem_t;
+
+struct vf_sync {
+    vf_sem_t free, filled, exited;
+    volatile int stop;
+};
+
+static int sem_create(vf_sem_t *s)
+{
+    *s = xSemaphoreCreateCounting(2, 0);
+    return *s ? 0 : -1;
+}
+
+static void sem_delete(vf_sem_t *s)
+{
+    vSemaphoreDelete(*s);
+}
+
+static void sem_give(vf_sem_t *s)
+{
+    xSemaphoreGive(*s);
+}
+
+// Returns 1 if the semaphore was taken
+static int sem_take(vf_sem_t *s, int block)
+{
+    return xSemaphoreTake(*s, block ? portMAX_DELAY : 0) == pdTRUE;
+}
+
+static int64_t now_us(void)
+{
+    return esp_timer_get_time();
+}
+
+static void sleep_us(unsigned us)
+{
+    vTaskDelay(us / 1000 / portTICK_PERIOD_MS);
+}
+#else
+typedef sem_t vf_sem_t;
+
+struct vf_sync {
+    vf_sem_t free, filled;
+    pthread_t thread;
+    volatile int stop;
+};
+
+static int sem_create(vf_sem_t *s)
+{
+    return sem_init(s, 0, 0);
+}
+
+static void sem_delete(vf_sem_t *s)
+{
+    sem_destroy(s);
+}
+
+static void sem_give(vf_sem_t *s)
+{
+    sem_post(s);
+}
+
+static int sem_take(vf_sem_t *s, int block)
+{
+    return (block ? sem_wait(s) : sem_trywait(s)) == 0;
+}
+
+static void sleep_us(unsigned us)
+{
+    usleep(us);
+}
+#endif
+
+// Fill the buffers alternately whenever the decoder releases one
+static void reader(vf_t *v)
+{
+    vf_sync_t *s = v->sync;
+    for (int b = 0;; b ^= 1) {
+        sem_take(&s->free, 1);
+        if (s->stop)
+            return;
+        int64_t t0 = now_us();
+        if (v->latency_us)
+            sleep_us(v->latency_us);
+        v->len[b] = fread(v->buf[b], 1, v->chunk_sz, v->f);
+        v->t_read[b] = now_us() - t0;
+        sem_give(&s->filled);
+    }
+}
+
+#ifdef ESP_PLATFORM
+static void reader_task(void *arg)
+{
+    vf_t *v = arg;
+    reader(v);
+    xSemaphoreGive(v->sync->exited);
+    vTaskDelete(NULL);
+}
+
+// PSRAM if there is room, internal RAM otherwise. The filesystems copy into any
+// memory, and psram_alloc() returns NULL rather than aborting when the heap is short.
+static uint8_t *alloc_buf(size_t sz)
+{
+    return psram_alloc(sz, NULL);
+}
+#else
+static void *reader_thread(void *arg)
+{
+    reader(arg);
+    return NULL;
+}
+
+static uint8_t *alloc_buf(size_t sz)
+{
+    return aligned_alloc(VF_ALIGN, (sz + VF_ALIGN - 1) & ~(size_t)(VF_ALIGN - 1));
+}
+#endif
+
+static void free_bufs(vf_t *v)
+{
+    free(v->buf[0]);
+    free(v->buf[1]);
+    free(v->spill);
+    free(v->sync);
+}
+
+// Count the read of the chunk in buf[cur], which the reader handed over with it
+static void count_read(vf_t *v)
+{
+    int64_t t = v->t_read[v->cur];
+    v->st.chunks++;
+    v->st.bytes += v->len[v->cur];
+    v->st.t_read += t;
+    if (t > v->st.t_read_max)
+        v->st.t_read_max = t;
+}
+
+static int start_reader(vf_t *v)
+{
+    vf_sync_t *s = v->sync;
+    if (sem_create(&s->free))
+        return -1;
+    if (sem_create(&s->filled)) {
+        sem_delete(&s->free);
+        return -1;
+    }
+#ifdef ESP_PLATFORM
+    s->exited = xSemaphoreCreateBinary();
+    if (!s->exited) {
+        sem_delete(&s->free);
+        sem_delete(&s->filled);
+        return -1;
+    }
+    tasks_start(TASK_ASSET, reader_task, v);
+#else
+    if (pthread_create(&s->thread, NULL, reader_thread, v)) {
+        sem_delete(&s->free);
+        sem_delete(&s->filled);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+int vf_open(vf_t *v, const char *path, size_t frame_sz, size_t chunk_sz)
+{
+    memset(v, 0, sizeof(*v));
+    if (frame_sz == 0)
+        return -1;
+    if (chunk_sz == 0)
+        chunk_sz = VF_CHUNK;
+    if (chunk_sz < frame_sz)
+        chunk_sz = frame_sz;
+    chunk_sz = (chunk_sz + VF_ALIGN - 1) & ~(size_t)(VF_ALIGN - 1);
+    v->frame_sz = frame_sz;
+    v->chunk_sz = chunk_sz;
+
+    v->f = fopen(path, "rb");
+    if (!v->f)
+        return -1;
+    // Whole chunks go straight to the filesystem driver, no stdio buffer in between
+    setvbuf(v->f, NULL, _IONBF, 0);
+
+    v->buf[0] = alloc_buf(chunk_sz);
+    v->buf[1] = alloc_buf(chunk_sz);
+    v->spill = alloc_buf(frame_sz);
+    v->sync = calloc(1, sizeof(vf_sync_t));
+    if (!v->buf[0] || !v->buf[1] || !v->spill || !v->sync || start_reader(v)) {
+        free_bufs(v);
+        fclose(v->f);
+        v->f = NULL;
+        return -1;
+    }
+
+    // Both buffers are free, wait for the first chunk so playback starts primed
+    sem_give(&v->sync->free);
+    sem_give(&v->sync->free);
+    sem_take(&v->sync->filled, 1);
+    v->cur = 0;
+    v->pos = 0;
+    count_read(v);
+    return 0;
+}
+
+// Release the current buffer to the reader and move on to the other one.
+// Returns -1 if it holds no data (end of the file).
+static int next_chunk(vf_t *v)
+{
+    vf_sync_t *s = v->sync;
+    sem_give(&s->free);
+    if (!sem_take(&s->filled, 0)) {
+        int64_t t0 = now_us();
+        sem_take(&s->filled, 1);
+        int64_t t = now_us() - t0;
+        v->st.underruns++;
+        v->st.t_stall += t;
+        if (t > v->st.t_stall_max)
+            v->st.t_stall_max = t;
+    }
+    v->cur ^= 1;
+    v->pos = 0;
+    count_read(v);
+    return v->len[v->cur] ? 0 : -1;
+}
+
+const uint8_t *vf_next_frame(vf_t *v)
+{
+    if (!v->f)
+        return NULL;
+
+    const uint8_t *frame;
+    size_t left = v->len[v->cur] - v->pos;
+    if (left >= v->frame_sz) {
+        frame = v->buf[v->cur] + v->pos;
+        v->pos += v->frame_sz;
+    } else {
+        // A short chunk is the end of the file
+        if (v->len[v->cur] < v->chunk_sz)
+            return NULL;
+        // The frame continues in the next chunk, join the two parts in the spill buffer
+        memcpy(v->spill, v->buf[v->cur] + v->pos, left);
+        if (next_chunk(v))
+            return NULL;
+        size_t rest = v->frame_sz - left;
+        if (v->len[v->cur] < rest)
+            return NULL;
+        if (left) {
+            memcpy(v->spill + left, v->buf[v->cur], rest);
+            frame = v->spill;
+            v->st.spills++;
+        } else {
+            frame = v->buf[v->cur];
+        }
+        v->pos = rest;
+    }
+    v->st.frames++;
+    return frame;
+}
+
+void vf_print_stats(vf_t *v)
+{
+    vf_stats_t *st = &v->st;
+    printf(
+        "Video file: %u frames, %u chunks of %u bytes read at %.2f MB/s (max %lld us per chunk), "
+        "%u underruns (%lld us, max %lld us), %u spills\n",
+        st->frames, st->chunks, (unsigned)v->chunk_sz,
+        st->t_read ? (double)st->bytes / st->t_read : 0.0, (long long)st->t_read_max,
+        st->underruns, (long long)st->t_stall, (long long)st->t_stall_max, st->spills
+    );
+    memset(st, 0, sizeof(*st));
+}
+
+void vf_close(vf_t *v)
+{
+    if (!v->f)
+        return;
+    vf_sync_t *s = v->sync;
+    // The reader finishes a read in progress, then sees stop on its next free buffer
+    s->stop = 1;
+    sem_give(&s->free);
+#ifdef ESP_PLATFORM
+    xSemaphoreTake(s->exited, portMAX_DELAY);
+    vSemaphoreDelete(s->exited);
+#else
+    pthread_join(s->thread, NULL);
+#endif
+    sem_delete(&s->free);
+    sem_delete(&s->filled);
+    free_bufs(v);
+    fclose(v->f);
+    memset(v, 0, sizeof(*v));
+}
+
+#ifdef VIDFILE_MAIN
+// Plays a raw RGB24 file at a fixed frame rate. Decoding is stood in for by
+// converting each frame into 32 bit pixels, like the firmware does for framebuf.
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: vidfile [-s WxH] [-r fps] [-c chunk] [-l latency_us] file\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned w = 128, h = 32, chunk = 0, latency = 0;
+    double fps = 30;
+    int c;
+    while ((c = getopt(argc, argv, "s:r:c:l:")) != -1) {
+        switch (c) {
+        case 's':
+            if (sscanf(optarg, "%ux%u", &w, &h) != 2)
+                usage();
+            break;
+        case 'r': fps = atof(optarg); break;
+        case 'c': chunk = atoi(optarg); break;
+        case 'l': latency = atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (optind != argc - 1 || fps <= 0)
+        usage();
+
+    vf_t v;
+    size_t frame_sz = (size_t)w * h * 3;
+    if (vf_open(&v, argv[optind], frame_sz, chunk)) {
+        fprintf(stderr, "%s: can't open\n", argv[optind]);
+        return 1;
+    }
+    v.latency_us = latency;
+
+    uint32_t *fb = malloc(w * h * sizeof(uint32_t));
+    int64_t period = 1000000 / fps, t_next = now_us();
+    unsigned n_late = 0;
+    uint32_t sum = 0;
+    const uint8_t *p;
+    while ((p = vf_next_frame(&v))) {
+        for (unsigned i = 0; i < w * h; i++, p += 3)
+            fb[i] = p[0] << 16 | p[1] << 8 | p[2];
+        sum += fb[v.st.frames % (w * h)];
+        t_next += period;
+        int64_t wait = t_next - now_us();
+        if (wait < 0)
+            n_late++;
+        else
+            usleep(wait);
+    }
+    printf(
+        "%s: %.1f fps needs %.2f MB/s, %u late frames (checksum %08x)\n",
+        argv[optind], fps, frame_sz * fps / 1e6, n_late, sum
+    );
+    vf_print_stats(&v);
+    vf_close(&v);
+    free(fb);
+    return 0;
+}
+#endif
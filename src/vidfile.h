@@ -0,0 +1,73 @@
+#ifndef VIDFILE_H
+#define VIDFILE_H
+
+// Playback of long videos from a filesystem (SPIFFS, LittleFS, FAT on SD, or a
+// plain file on the host), too large to be compiled into the firmware.
+//
+// The file is a stream of fixed size frames, e.g. RGB24 from tools/transcode.c
+// -f raw. It is read sequentially in large chunks, a multiple of VF_ALIGN at
+// chunk aligned file offsets, into two RAM buffers: a reader task fills one
+// while the frames of the other are decoded. Storage latency only stalls the
+// frame clock when a whole chunk takes longer to read than it takes to play,
+// and those underruns are counted.
+//
+// On the target the reader is an asset task (src/tasks.h), on the host a thread:
+//   gcc -O2 -pthread -DVIDFILE_MAIN -Isrc -o vidfile src/vidfile.c
+//   ./vidfile [-s WxH] [-r fps] [-c chunk] [-l latency_us] clip.rgb
+// plays a raw RGB24 file at the frame rate and reports throughput and underruns,
+// with -l adding storage latency to every read.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Filesystem sector / cluster size, chunks are a multiple of it
+#define VF_ALIGN 4096
+
+#ifndef VF_CHUNK
+#define VF_CHUNK (8 * VF_ALIGN)
+#endif
+
+typedef struct {
+    unsigned frames;
+    unsigned chunks;            // chunks read by the reader and handed to the decoder
+    size_t bytes;
+    int64_t t_read, t_read_max; // time spent in fread() per chunk [us]
+    unsigned underruns;         // frames which had to wait for their chunk
+    int64_t t_stall, t_stall_max;
+    unsigned spills;            // frames split over two chunks, copied together
+} vf_stats_t;
+
+typedef struct vf_sync vf_sync_t;
+
+typedef struct {
+    FILE *f;
+    size_t frame_sz, chunk_sz;
+    uint8_t *buf[2];            // chunk buffers, filled alternately
+    size_t len[2];              // bytes read into each, less than chunk_sz at the end of the file
+    int64_t t_read[2];          // time the read of each took [us], counted into st by the decoder
+    uint8_t *spill;             // frame straddling two chunks
+    int cur;                    // buffer the frames come from, 0 or 1, vf_open() waits for buf[0]
+    size_t pos;                 // offset of the next frame in buf[cur]
+    unsigned latency_us;        // added to every read, to simulate slow storage
+    vf_sync_t *sync;
+    vf_stats_t st;              // only updated by the decoder, the reader's side comes with the chunks
+} vf_t;
+
+// Open `path` as a stream of frame_sz byte frames, read chunk_sz bytes at a time
+// (rounded up to VF_ALIGN, 0 = VF_CHUNK), and start reading the first two chunks.
+// Returns -1 if the file can't be opened or the buffers can't be allocated.
+int vf_open(vf_t *v, const char *path, size_t frame_sz, size_t chunk_sz);
+
+// The next frame, valid until the next call. Waits for the reader if its chunk
+// is not loaded yet. Returns NULL at the end of the file or on a read error.
+const uint8_t *vf_next_frame(vf_t *v);
+
+// Print the statistics since the previous call and reset them. Call it from the
+// task which reads the frames, like vf_next_frame().
+void vf_print_stats(vf_t *v);
+
+// Stop the reader, free the buffers and close the file
+void vf_close(vf_t *v);
+
+#endif
@@ -0,0 +1,240 @@
+// Photometric analysis of the binary code modulation.
+//
+// Takes the bitplane schedule (by default the one enc_schedule() generates for
+// the firmware), the OE window and the I2S clock divider and prints, for every
+// 8 bit input value, the emitted luminance, its deviation from the lumConvTab
+// target curve and the lowest flicker frequency with significant amplitude.
+// With -f it analyses the non-binary weights of enc_weights_init() instead.
+//
+// Only the slot level waveform is modelled. The row scan (one OE pulse per row
+// and slot) happens at f_pix / width, which is far above anything visible.
+//
+// Build and run on the host:
+//   gcc -O2 -Isrc -o bcm_analyse tools/bcm_analyse.c src/encoder.c src/val2pwm.c -lm
+//   ./bcm_analyse -p 7 -b 2 -d 2
+//   ./bcm_analyse -p 8 -b 16 -f 3 -q
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+#include "encoder.h"
+#include "val2pwm.h"
+
+// I2S base clock, see i2s_parallel_setup()
+#define I2S_BASE_CLK 80e6
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: bcm_analyse [-p planes] [-w width] [-r rows] [-b brightness] [-d clk_div]\n"
+        "                   [-s \"schedule\"] [-t threshold] [-g] [-f fine_planes] [-q]\n"
+        "  -p  bitplanes (7)\n"
+        "  -w  panel width in pixels (128)\n"
+        "  -r  scan rows (16)\n"
+        "  -b  OE window in pixel clocks (2)\n"
+        "  -d  I2S clock divider (2 = 20 MHz pixel clock)\n"
+        "  -s  custom plane order, e.g. \"2 1 2 0 2 1 2\", default is enc_schedule()\n"
+        "  -t  flicker amplitude threshold relative to the mean (0.05)\n"
+        "  -g  input is gamma corrected by valToPwm() before encoding\n"
+        "  -f  non-binary weights with this many fine planes (enc_weights_init()),\n"
+        "      the brightness curve is in the plane weights and their code table\n"
+        "  -q  print the summary only\n"
+    );
+    exit(1);
+}
+
+// parse a space separated plane order, returns the number of slots
+static unsigned parse_schedule(const char *s, uint8_t *order, unsigned n_planes)
+{
+    unsigned n = 0;
+    char *end;
+    while (n < ENC_MAX_SLOTS) {
+        long pl = strtol(s, &end, 0);
+        if (end == s)
+            break;
+        if (pl < 0 || pl >= (long)n_planes) {
+            fprintf(stderr, "plane %ld out of range\n", pl);
+            exit(1);
+        }
+        order[n++] = pl;
+        s = end;
+    }
+    return n;
+}
+
+// Lowest harmonic of the light per slot (OE pixel clocks, 0 = off) which has an
+// amplitude of at least `thr` relative to the mean. Returns 0 if there is none.
+// With -f the slots have different OE windows, so all on can flicker too.
+static unsigned lowest_flicker(const unsigned *light, unsigned n, double thr, double *amp)
+{
+    unsigned sum = 0;
+    for (unsigned s = 0; s < n; s++)
+        sum += light[s];
+    *amp = 0;
+    if (sum == 0)
+        return 0;
+
+    for (unsigned k = 1; k <= n / 2; k++) {
+        double re = 0, im = 0;
+        for (unsigned s = 0; s < n; s++) {
+            double ph = 2 * M_PI * k * s / n;
+            re += light[s] * cos(ph);
+            im -= light[s] * sin(ph);
+        }
+        double a = 2 * sqrt(re * re + im * im) / sum;
+        if (a >= thr) {
+            *amp = a;
+            return k;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned n_planes = 7, width = 128, rows = 16, clk_div = 2;
+    int brightness = 2;
+    double thr = 0.05;
+    bool gamma = false, quiet = false;
+    const char *sched_str = NULL;
+    int n_fine = -1;
+
+    int c;
+    while ((c = getopt(argc, argv, "p:w:r:b:d:s:t:gf:qh")) != -1) {
+        switch (c) {
+        case 'p': n_planes = atoi(optarg); break;
+        case 'w': width = atoi(optarg); break;
+        case 'r': rows = atoi(optarg); break;
+        case 'b': brightness = atoi(optarg); break;
+        case 'd': clk_div = atoi(optarg); break;
+        case 's': sched_str = optarg; break;
+        case 't': thr = atof(optarg); break;
+        case 'g': gamma = true; break;
+        case 'f': n_fine = atoi(optarg); break;
+        case 'q': quiet = true; break;
+        default: usage();
+        }
+    }
+    if (n_planes < 1 || n_planes > ENC_MAX_PLANES || width < 2 || rows < 1)
+        usage();
+    if (clk_div < 2)
+        clk_div = 2;
+
+    // same clamping as the encoder
+    int br = brightness;
+    if (br > (int)width - 2)
+        br = width - 2;
+    int oe_start = ((int)width - br) / 2;
+    int oe_stop = ((int)width + br) / 2;
+    unsigned oe_clks = oe_stop > oe_start ? oe_stop - oe_start : 0;
+
+    enc_weights_t w;
+    enc_cfg_t wcfg = {.width = width, .rows = rows, .n_planes = n_planes, .brightness = brightness};
+    if (n_fine >= 0)
+        enc_weights_init(&w, &wcfg, n_fine, lumConvTab);
+
+    uint8_t order[ENC_MAX_SLOTS];
+    unsigned n_slots;
+    if (n_fine >= 0)
+        n_slots = enc_schedule_weights(order, &w);
+    else if (sched_str)
+        n_slots = parse_schedule(sched_str, order, n_planes);
+    else
+        n_slots = enc_schedule(order, n_planes);
+    if (n_slots == 0)
+        usage();
+
+    // OE pixel clocks of every slot
+    unsigned slot_clks[ENC_MAX_SLOTS];
+    for (unsigned s = 0; s < n_slots; s++)
+        slot_clks[s] = n_fine >= 0 ? w.weight[order[s]] / w.slots[order[s]] : oe_clks;
+
+    double f_pix = I2S_BASE_CLK / clk_div / 2;
+    double t_slot = (double)width * rows / f_pix;
+    double f_refresh = 1 / (n_slots * t_slot);
+
+    printf("schedule (%u slots):", n_slots);
+    for (unsigned s = 0; s < n_slots; s++)
+        printf(" %d", order[s]);
+    printf("\n");
+    printf(
+        "pixel clock %.2f MHz, slot %.1f us, refresh %.1f Hz, OE %u / %u clocks\n",
+        f_pix / 1e6, t_slot * 1e6, f_refresh, oe_clks, width
+    );
+    if (n_fine >= 0) {
+        printf("plane weights [OE clocks per frame]:");
+        for (unsigned pl = 0; pl < n_planes; pl++)
+            printf(" %u", (unsigned)w.weight[pl]);
+        printf("\n");
+    }
+
+    // emitted luminance of the full scale code, everything is relative to this
+    unsigned full_on = 0;
+    for (unsigned s = 0; s < n_slots; s++)
+        full_on += ((0xFF >> (8 - n_planes + order[s])) & 1) * slot_clks[s];
+    printf(
+        "peak duty cycle %.3f %%\n",
+        100.0 * full_on / ((double)width * rows * n_slots)
+    );
+
+    if (!quiet)
+        printf("\n  val code  emitted%%  target%%     dev%%  flicker_Hz  amp%%\n");
+
+    double max_dev = 0, worst_f = 0;
+    int max_dev_v = 0, worst_f_v = -1, n_levels = 0, n_levels_dark = 0;
+    int prev_on = -1;
+    for (int v = 0; v < 256; v++) {
+        unsigned code = n_fine >= 0 ? w.code[v] : gamma ? valToPwm(v) : v;
+        unsigned light[ENC_MAX_SLOTS];
+        unsigned n_on = 0;
+        for (unsigned s = 0; s < n_slots; s++) {
+            light[s] = code & (1 << (8 - n_planes + order[s])) ? slot_clks[s] : 0;
+            n_on += light[s];
+        }
+        double emitted = full_on ? (double)n_on / full_on : 0;
+        double target = (65535.0 - lumConvTab[v]) / (65535.0 - lumConvTab[255]);
+        double dev = emitted - target;
+        if (fabs(dev) > fabs(max_dev)) {
+            max_dev = dev;
+            max_dev_v = v;
+        }
+
+        if ((int)n_on != prev_on) {
+            n_levels++;
+            if (target < 0.1)
+                n_levels_dark++;
+            prev_on = n_on;
+        }
+
+        double amp;
+        unsigned k = lowest_flicker(light, n_slots, thr, &amp);
+        double f = k * f_refresh;
+        if (k && (worst_f_v < 0 || f < worst_f)) {
+            worst_f = f;
+            worst_f_v = v;
+        }
+
+        if (quiet)
+            continue;
+        printf(
+            "  %3d  %3u  %7.3f  %7.3f  %+7.3f",
+            v, code, 100 * emitted, 100 * target, 100 * dev
+        );
+        if (k)
+            printf("  %10.1f  %4.0f\n", f, 100 * amp);
+        else
+            printf("           -     -\n");
+    }
+
+    printf("\n");
+    printf("distinct levels: %d (%d below 10 %% target)\n", n_levels, n_levels_dark);
+    printf("max deviation: %+.3f %% at %d\n", 100 * max_dev, max_dev_v);
+    if (worst_f_v >= 0)
+        printf("lowest flicker: %.1f Hz at %d\n", worst_f, worst_f_v);
+    else
+        printf("lowest flicker: none above threshold\n");
+    return 0;
+}
@@ -0,0 +1,330 @@
+// Encode raw RGB24 frames as block video for the firmware's decoder (src/blockvid.c).
+//
+//   bvconv [-w width] [-h height] [-b block] [-d delay_ms] [-r range] out.bv in.rgb ...
+//       Every complete frame of the inputs becomes a frame of the video. The
+//       encoding is lossless, each block takes the cheapest operation which
+//       reproduces it exactly. Copies are searched up to `range` pixels away (8).
+//
+// The encoder keeps its own copy of the decoder's canvas, updated block by
+// block, so skips and copies refer to exactly what the decoder will have. Each
+// frame is encoded in both block orders and the smaller one is kept. The
+// video is decoded again with the firmware decoder, checked against the input
+// and the decode time and changed rows are reported.
+//
+// Build:
+//   gcc -O2 -Isrc -o bvconv tools/bvconv.c src/blockvid.c src/framebuf.c src/encoder.c
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "host_util.h"
+#include "framebuf.h"
+#include "blockvid.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bvconv [-w width] [-h height] [-b block] [-d delay_ms] [-r range] out.bv in.rgb ...\n");
+    exit(1);
+}
+
+static unsigned w = 64, h = 32, bs = 4;
+static int range = 8;
+
+// One encoding of a frame: the bytes and the decoder's canvas after it
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    uint32_t *cur;
+    bool rev;           // blocks in reverse order
+    // pending run of skip, solid or copy blocks, written once it can't grow any more
+    unsigned op, n;
+    uint32_t c;
+    int dx, dy;
+} enc_t;
+
+static void put(enc_t *e, unsigned b)
+{
+    e->buf[e->len++] = b;
+}
+
+static void put_rgb(enc_t *e, uint32_t c)
+{
+    put(e, (c >> 16) & 0xFF);
+    put(e, (c >> 8) & 0xFF);
+    put(e, c & 0xFF);
+}
+
+static void flush_run(enc_t *e)
+{
+    if (!e->n)
+        return;
+    put(e, e->op | (e->n - 1));
+    if (e->op == 0x40) {
+        put_rgb(e, e->c);
+    } else if (e->op == 0x80) {
+        put(e, (uint8_t)e->dx);
+        put(e, (uint8_t)e->dy);
+    }
+    e->n = 0;
+}
+
+// Add a block to the pending run, starting a new one if it doesn't fit
+static void add_run(enc_t *e, unsigned op, uint32_t c, int dx, int dy)
+{
+    if (e->n && (e->op != op || e->n == 64 || e->c != c || e->dx != dx || e->dy != dy))
+        flush_run(e);
+    if (!e->n) {
+        e->op = op;
+        e->c = c;
+        e->dx = dx;
+        e->dy = dy;
+    }
+    e->n++;
+}
+
+// Would copying from (dx, dy) away reproduce blk at (x, y)? Follows the decoder
+// pixel by pixel: source pixels inside the block which are already written
+// hold the new values, which match blk as long as nothing failed so far.
+static bool copy_matches(const enc_t *e, const uint32_t *blk, unsigned x, unsigned y, int dx, int dy)
+{
+    int sx = x + dx, sy = y + dy;
+    if (sx < 0 || sy < 0 || sx + bs > w || sy + bs > h)
+        return false;
+    for (unsigned n = 0; n < bs * bs; n++) {
+        unsigned k = e->rev ? bs * bs - 1 - n : n;
+        unsigned i = k % bs, j = k / bs;
+        int si = i + dx, sj = j + dy;
+        uint32_t c;
+        if (si >= 0 && si < (int)bs && sj >= 0 && sj < (int)bs && (e->rev ? si + sj * (int)bs > (int)k : si + sj * (int)bs < (int)k))
+            c = blk[si + sj * bs];
+        else
+            c = e->cur[sx + i + (sy + j) * w];
+        if (c != blk[k])
+            return false;
+    }
+    return true;
+}
+
+// Nearest copy source for blk, the vector of the pending run first as it costs nothing
+static bool find_copy(const enc_t *e, const uint32_t *blk, unsigned x, unsigned y, int *dx, int *dy)
+{
+    if (e->n && e->op == 0x80 && copy_matches(e, blk, x, y, e->dx, e->dy)) {
+        *dx = e->dx;
+        *dy = e->dy;
+        return true;
+    }
+    for (int r = 1; r <= range; r++) {
+        for (*dy = -r; *dy <= r; (*dy)++)
+            for (*dx = -r; *dx <= r; (*dx)++)
+                if ((abs(*dx) == r || abs(*dy) == r) && copy_matches(e, blk, x, y, *dx, *dy))
+                    return true;
+    }
+    return false;
+}
+
+static void encode_block(enc_t *e, const uint8_t *rgb, unsigned x, unsigned y, bool first)
+{
+    uint32_t blk[64];
+    for (unsigned j = 0; j < bs; j++) {
+        for (unsigned i = 0; i < bs; i++) {
+            const uint8_t *p = &rgb[3 * (x + i + (y + j) * w)];
+            blk[i + j * bs] = p[0] << 16 | p[1] << 8 | p[2];
+        }
+    }
+
+    // up to 5 distinct colours, 5 means too many for a palette
+    uint32_t pal[5];
+    unsigned n_col = 0;
+    for (unsigned i = 0; i < bs * bs && n_col < 5; i++) {
+        unsigned k = 0;
+        while (k < n_col && pal[k] != blk[i])
+            k++;
+        if (k == n_col)
+            pal[n_col++] = blk[i];
+    }
+
+    bool same = !first;
+    for (unsigned j = 0; same && j < bs; j++)
+        same = memcmp(&e->cur[x + (y + j) * w], &blk[j * bs], bs * sizeof(uint32_t)) == 0;
+
+    int dx = 0, dy = 0;
+    bool copy = !same && !first && n_col > 1 && find_copy(e, blk, x, y, &dx, &dy);
+
+    if (same) {
+        add_run(e, 0x00, 0, 0, 0);
+    } else if (n_col == 1) {
+        add_run(e, 0x40, pal[0], 0, 0);
+    } else if (copy) {
+        add_run(e, 0x80, 0, dx, dy);
+    } else if (n_col <= 4) {
+        flush_run(e);
+        unsigned bits = n_col == 2 ? 1 : 2;
+        put(e, n_col == 2 ? 0xC1 : 0xC2);
+        for (unsigned k = 0; k < (1U << bits); k++)
+            put_rgb(e, k < n_col ? pal[k] : 0);
+        unsigned acc = 0, n = 0;
+        for (unsigned i = 0; i < bs * bs; i++) {
+            unsigned k = 0;
+            while (pal[k] != blk[i])
+                k++;
+            acc = acc << bits | k;
+            n += bits;
+            if (n == 8) {
+                put(e, acc);
+                acc = n = 0;
+            }
+        }
+    } else {
+        flush_run(e);
+        put(e, 0xC0);
+        for (unsigned i = 0; i < bs * bs; i++)
+            put_rgb(e, blk[i]);
+    }
+
+    for (unsigned j = 0; j < bs; j++)
+        memcpy(&e->cur[x + (y + j) * w], &blk[j * bs], bs * sizeof(uint32_t));
+}
+
+// Encode a frame on top of the canvas `prev` in block order `rev`
+static void encode_frame(enc_t *e, const uint32_t *prev, const uint8_t *rgb, unsigned delay, bool first)
+{
+    unsigned bw = w / bs, n_blocks = bw * (h / bs);
+    memcpy(e->cur, prev, w * h * sizeof(uint32_t));
+    e->len = 0;
+    e->n = 0;
+    put(e, delay & 0xFF);
+    put(e, (delay >> 8 & 0x7F) | e->rev << 7);
+    for (unsigned n = 0; n < n_blocks; n++) {
+        unsigned k = e->rev ? n_blocks - 1 - n : n;
+        encode_block(e, rgb, k % bw * bs, k / bw * bs, first);
+    }
+    flush_run(e);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned delay = 100;
+    int c;
+    while ((c = getopt(argc, argv, "w:h:b:d:r:")) != -1) {
+        switch (c) {
+        case 'w': w = atoi(optarg); break;
+        case 'h': h = atoi(optarg); break;
+        case 'b': bs = atoi(optarg); break;
+        case 'd': delay = atoi(optarg); break;
+        case 'r': range = atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (optind + 2 > argc || (bs != 4 && bs != 8) || w == 0 || h == 0 || w % bs || h % bs || range < 0 || range > 127 || delay > 0x7FFF)
+        usage();
+
+    FILE *fo = fopen(argv[optind], "w+b");
+    if (!fo) {
+        perror(argv[optind]);
+        return 1;
+    }
+    uint8_t hdr[BV_HEADER_SZ] = {'B', 'V', bs, 0, w, w >> 8, h, h >> 8, 0, 0};
+    fwrite(hdr, sizeof(hdr), 1, fo);
+
+    size_t n_raw = (size_t)w * h * 3;
+    uint8_t *rgb = malloc(n_raw);
+    uint8_t *frames = NULL;     // all input frames, for the decode check
+    // both block orders are tried, the smaller one is kept
+    enc_t enc[2];
+    uint32_t *cur = calloc(w * h, sizeof(uint32_t));
+    for (unsigned i = 0; i < 2; i++) {
+        enc[i].buf = malloc(2 + w * h / (bs * bs) + n_raw);
+        enc[i].cur = malloc(w * h * sizeof(uint32_t));
+        enc[i].rev = i;
+    }
+    unsigned n_frames = 0, n_rev = 0;
+
+    for (int a = optind + 1; a < argc; a++) {
+        FILE *f = fopen(argv[a], "rb");
+        if (!f) {
+            perror(argv[a]);
+            return 1;
+        }
+        while (fread(rgb, n_raw, 1, f) == 1 && n_frames < 0xFFFF) {
+            for (unsigned i = 0; i < 2; i++)
+                encode_frame(&enc[i], cur, rgb, delay, n_frames == 0);
+            const enc_t *e = &enc[enc[1].len < enc[0].len];
+            n_rev += e->rev;
+            fwrite(e->buf, e->len, 1, fo);
+            memcpy(cur, e->cur, w * h * sizeof(uint32_t));
+
+            frames = realloc(frames, (n_frames + 1) * n_raw);
+            memcpy(&frames[n_frames * n_raw], rgb, n_raw);
+            n_frames++;
+        }
+        fclose(f);
+    }
+    hdr[8] = n_frames;
+    hdr[9] = n_frames >> 8;
+    fseek(fo, 0, SEEK_SET);
+    fwrite(hdr, sizeof(hdr), 1, fo);
+    fseek(fo, 0, SEEK_END);
+    size_t len = ftell(fo);
+    printf(
+        "%u frames of %ux%u, %ux%u blocks, %zu -> %zu bytes (%.1f %%), %u in reverse order\n",
+        n_frames, w, h, bs, bs, n_frames * n_raw, len, n_frames ? 100.0 * len / (n_frames * n_raw) : 0, n_rev
+    );
+    if (w > DISPLAY_WIDTH || h > DISPLAY_HEIGHT || !n_frames) {
+        fclose(fo);
+        return 0;
+    }
+
+    // decode check
+    uint8_t *data = malloc(len);
+    fseek(fo, 0, SEEK_SET);
+    if (fread(data, len, 1, fo) != 1) {
+        perror(argv[optind]);
+        return 1;
+    }
+    fclose(fo);
+
+    bv_t v;
+    unsigned n_bad = 0, n_rows = 0, n_loops = 1000;
+    uint32_t dirty;
+    setAll(0);
+    if (bv_open(&v, data, len)) {
+        fprintf(stderr, "%s: can't open\n", argv[optind]);
+        return 1;
+    }
+    static uint32_t prev[FB_PIXELS];
+    for (unsigned n = 0; n < n_frames; n++) {
+        for (unsigned i = 0; i < FB_PIXELS; i++)
+            prev[i] = getPixel(i % DISPLAY_WIDTH, i / DISPLAY_WIDTH);
+        if (bv_next_frame(&v, 0, 0, NULL, &dirty)) {
+            fprintf(stderr, "frame %u: decode failed\n", n);
+            return 1;
+        }
+        for (unsigned i = 0; i < w * h; i++) {
+            const uint8_t *p = &frames[n * n_raw + 3 * i];
+            if (getPixel(i % w, i / w) != (uint32_t)(p[0] << 16 | p[1] << 8 | p[2]))
+                n_bad++;
+        }
+        // rows which are not marked must not have changed
+        for (unsigned y = 0; y < DISPLAY_HEIGHT; y++)
+            if (!(fb_row_mask(y, y + 1) & dirty))
+                for (unsigned x = 0; x < DISPLAY_WIDTH; x++)
+                    if (getPixel(x, y) != prev[x + y * DISPLAY_WIDTH])
+                        n_bad++;
+        for (unsigned y = 0; y < DISPLAY_HEIGHT / 2; y++)
+            n_rows += dirty >> y & 1;
+    }
+
+    int64_t t0 = now_us();
+    for (unsigned i = 0; i < n_loops; i++) {
+        bv_rewind(&v);
+        while (bv_next_frame(&v, 0, 0, NULL, NULL) == 0);
+    }
+    double t = now_us() - t0;
+    printf(
+        "decode check: %u pixel mismatches, %.1f us per frame, %.1f of %u scan rows changed per frame\n",
+        n_bad, t / n_loops / n_frames, (double)n_rows / n_frames, DISPLAY_HEIGHT / 2
+    );
+    return n_bad != 0;
+}
@@ -0,0 +1,52 @@
+// Generate src/fft_tab.c, the constant tables of src/fft.c for FFT_N
+//
+// Build:
+//   gcc -O2 -Isrc -o fftgen tools/fftgen.c -lm
+//   ./fftgen > src/fft_tab.c
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "fft.h"
+
+static int q15(double v)
+{
+    long r = lround(v * 32768);
+    return r > 32767 ? 32767 : r < -32768 ? -32768 : r;
+}
+
+int main(void)
+{
+    unsigned n_digits = 0;
+    for (unsigned n = FFT_N / 2; n > 1; n /= 4)
+        n_digits++;
+    if ((1U << (2 * n_digits)) != FFT_N / 2) {
+        fprintf(stderr, "FFT_N must be 2 * 4^n\n");
+        return 1;
+    }
+
+    printf("//Auto-generated by tools/fftgen.c\n#include <stdint.h>\n#include \"fft.h\"\n\n");
+
+    printf("const int16_t fft_twiddle[3 * FFT_N / 4][2]={");
+    for (unsigned m = 0; m < 3 * FFT_N / 4; m++) {
+        double a = -2 * M_PI * m / FFT_N;
+        printf("%s{%d,%d},", m % 8 ? "" : "\n    ", q15(cos(a)), q15(sin(a)));
+    }
+    printf("\n};\n\n");
+
+    printf("const int16_t fft_window[FFT_N / 2]={");
+    for (unsigned i = 0; i < FFT_N / 2; i++)
+        printf("%s%d,", i % 16 ? "" : "\n    ", q15(0.5 - 0.5 * cos(2 * M_PI * i / (FFT_N - 1))));
+    printf("\n};\n\n");
+
+    // The radix-2 stage puts even bins into the first half, odd ones into the
+    // second. Each radix-4 stage then reverses one base 4 digit of the index.
+    printf("const uint16_t fft_pos[FFT_N / 2]={");
+    for (unsigned k = 0; k < FFT_N / 2; k++) {
+        unsigned q = k >> 1, rev = 0;
+        for (unsigned d = 0; d < n_digits; d++, q >>= 2)
+            rev = rev << 2 | (q & 3);
+        printf("%s%u,", k % 16 ? "" : "\n    ", (k & 1) * FFT_N / 2 + rev);
+    }
+    printf("\n};\n");
+    return 0;
+}
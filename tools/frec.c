@@ -0,0 +1,245 @@
+// Record and replay frame streams (see src/framerec.h) on the host.
+//
+//   frec record [-w width] [-h height] [-r fps] out.frec < frames.rgb
+//       Records raw RGB24 frames from stdin, e.g. piped from
+//       ffmpeg -i clip.mp4 -s 128x32 -f rawvideo -pix_fmt rgb24 -
+//   frec info in.frec
+//   frec replay [-f] [-p planes] [-b brightness] in.frec
+//       Runs every frame through all encoder variants with the recorded
+//       timing (or as fast as possible with -f) and reports encode times.
+//
+// Build:
+//   gcc -O2 -Isrc -o frec tools/frec.c src/framerec.c src/encoder.c
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include "host_util.h"
+#include "encoder.h"
+#include "framerec.h"
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: frec record [-w width] [-h height] [-r fps] out.frec < frames.rgb\n"
+        "       frec info in.frec\n"
+        "       frec replay [-f] [-p planes] [-b brightness] in.frec\n"
+    );
+    exit(1);
+}
+
+static void sleep_until_us(int64_t t)
+{
+    struct timespec ts = {t / 1000000, (t % 1000000) * 1000};
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+}
+
+static FILE *open_or_die(const char *path, const char *mode)
+{
+    FILE *f = fopen(path, mode);
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    return f;
+}
+
+static int cmd_record(int argc, char **argv)
+{
+    unsigned w = 128, h = 32;
+    double fps = 25;
+    int c;
+    while ((c = getopt(argc, argv, "w:h:r:")) != -1) {
+        switch (c) {
+        case 'w': w = atoi(optarg); break;
+        case 'h': h = atoi(optarg); break;
+        case 'r': fps = atof(optarg); break;
+        default: usage();
+        }
+    }
+    if (optind >= argc || fps <= 0)
+        usage();
+
+    FILE *f = open_or_die(argv[optind], "wb");
+    framerec_t rec;
+    uint8_t *rgb = malloc(w * h * 3);
+    uint32_t *fb = malloc(w * h * sizeof(uint32_t));
+    if (!rgb || !fb || framerec_open_write(&rec, f, w, h)) {
+        fprintf(stderr, "record: setup failed\n");
+        return 1;
+    }
+    while (fread(rgb, w * h * 3, 1, stdin) == 1) {
+        for (unsigned i = 0; i < w * h; i++)
+            fb[i] = rgb[3 * i] << 16 | rgb[3 * i + 1] << 8 | rgb[3 * i + 2];
+        if (framerec_write(&rec, fb, rec.n_frames * 1e6 / fps)) {
+            fprintf(stderr, "record: write failed\n");
+            return 1;
+        }
+    }
+    printf(
+        "%u frames, %zu bytes (%.1f %% of raw)\n", rec.n_frames, rec.n_bytes,
+        rec.n_frames ? 100.0 * rec.n_bytes / (rec.n_frames * w * h * 3.0) : 0
+    );
+    framerec_close(&rec);
+    fclose(f);
+    free(rgb);
+    free(fb);
+    return 0;
+}
+
+static int cmd_info(int argc, char **argv)
+{
+    if (argc < 2)
+        usage();
+    FILE *f = open_or_die(argv[1], "rb");
+    framerec_t rec;
+    if (framerec_open_read(&rec, f)) {
+        fprintf(stderr, "%s: not a frame recording\n", argv[1]);
+        return 1;
+    }
+    uint32_t *fb = malloc(rec.width * rec.height * sizeof(uint32_t));
+    uint32_t dt;
+    uint64_t t = 0;
+    int ret;
+    while ((ret = framerec_read(&rec, fb, &dt)) == 0)
+        t += dt;
+    if (ret < 0)
+        fprintf(stderr, "%s: truncated after %u frames\n", argv[1], rec.n_frames);
+    printf(
+        "%ux%u, %u frames, %.2f s, %zu bytes (%.1f %% of raw)\n",
+        rec.width, rec.height, rec.n_frames, t / 1e6, rec.n_bytes,
+        rec.n_frames ? 100.0 * rec.n_bytes / (rec.n_frames * rec.width * rec.height * 3.0) : 0
+    );
+    framerec_close(&rec);
+    fclose(f);
+    free(fb);
+    return ret < 0;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmd_replay(int argc, char **argv)
+{
+    bool fast = false;
+    unsigned n_planes = 7;
+    int brightness = 2;
+    int c;
+    while ((c = getopt(argc, argv, "fp:b:")) != -1) {
+        switch (c) {
+        case 'f': fast = true; break;
+        case 'p': n_planes = atoi(optarg); break;
+        case 'b': brightness = atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (optind >= argc || n_planes < 1 || n_planes > ENC_MAX_PLANES)
+        usage();
+
+    FILE *f = open_or_die(argv[optind], "rb");
+    framerec_t rec;
+    if (framerec_open_read(&rec, f)) {
+        fprintf(stderr, "%s: not a usable frame recording\n", argv[optind]);
+        return 1;
+    }
+    if (rec.width == 0 || rec.width & 1 || rec.width > ENC_MAX_WIDTH || rec.height == 0 || rec.height & 1 || rec.height > 2 * ENC_MAX_ROWS) {
+        fprintf(
+            stderr, "%s: %ux%u, replay needs an even width up to %d and an even height up to %d\n",
+            argv[optind], rec.width, rec.height, ENC_MAX_WIDTH, 2 * ENC_MAX_ROWS
+        );
+        return 1;
+    }
+    enc_cfg_t cfg = {
+        .width = rec.width,
+        .rows = rec.height / 2,
+        .n_planes = n_planes,
+        .brightness = brightness,
+    };
+    uint32_t *fb = malloc(rec.width * rec.height * sizeof(uint32_t));
+    unsigned conv_sz = 0;
+    for (unsigned v = 0; v < enc_variant_cnt; v++)
+        if (enc_fb_size(&cfg, enc_variants[v].fmt) > conv_sz)
+            conv_sz = enc_fb_size(&cfg, enc_variants[v].fmt);
+    void *fb_conv = malloc(conv_sz);
+    uint16_t *planes[ENC_MAX_PLANES];
+    for (unsigned i = 0; i < n_planes; i++)
+        planes[i] = malloc(rec.width * cfg.rows * sizeof(uint16_t));
+
+    // encode time of every frame for every variant [ns]
+    unsigned cap = 1024, n = 0;
+    uint32_t *t_enc[enc_variant_cnt];
+    for (unsigned v = 0; v < enc_variant_cnt; v++)
+        t_enc[v] = malloc(cap * sizeof(uint32_t));
+
+    uint32_t dt;
+    unsigned n_late = 0;
+    int64_t late_max = 0;
+    int64_t t_next = now_us();
+    while (framerec_read(&rec, fb, &dt) == 0) {
+        t_next += dt;
+        if (!fast) {
+            int64_t late = now_us() - t_next;
+            if (late > 0) {
+                n_late++;
+                if (late > late_max)
+                    late_max = late;
+            } else {
+                sleep_until_us(t_next);
+            }
+        }
+        if (n == cap) {
+            cap *= 2;
+            for (unsigned v = 0; v < enc_variant_cnt; v++)
+                t_enc[v] = realloc(t_enc[v], cap * sizeof(uint32_t));
+        }
+        for (unsigned v = 0; v < enc_variant_cnt; v++) {
+            // layout conversion is not part of the encode time
+            enc_from_linear(fb_conv, fb, &cfg, enc_variants[v].fmt);
+            int64_t t0 = now_ns();
+            enc_variants[v].fn(planes, fb_conv, &cfg);
+            t_enc[v][n] = now_ns() - t0;
+        }
+        n++;
+    }
+    if (n == 0) {
+        fprintf(stderr, "no frames\n");
+        return 1;
+    }
+
+    printf("%u frames of %ux%u, %u planes", n, rec.width, rec.height, n_planes);
+    if (!fast)
+        printf(", %u late (max %lld us)", n_late, (long long)late_max);
+    printf("\n%-16s %10s %10s %10s\n", "encoder", "mean_us", "p99_us", "max_us");
+    for (unsigned v = 0; v < enc_variant_cnt; v++) {
+        uint64_t sum = 0;
+        for (unsigned i = 0; i < n; i++)
+            sum += t_enc[v][i];
+        qsort(t_enc[v], n, sizeof(uint32_t), cmp_u32);
+        printf(
+            "%-16s %10.1f %10.1f %10.1f\n", enc_variants[v].name,
+            sum / 1e3 / n, t_enc[v][n * 99 / 100] / 1e3, t_enc[v][n - 1] / 1e3
+        );
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+        usage();
+    if (strcmp(argv[1], "record") == 0)
+        return cmd_record(argc - 1, argv + 1);
+    if (strcmp(argv[1], "info") == 0)
+        return cmd_info(argc - 1, argv + 1);
+    if (strcmp(argv[1], "replay") == 0)
+        return cmd_replay(argc - 1, argv + 1);
+    usage();
+    return 1;
+}
@@ -0,0 +1,159 @@
+// Encode raw RGB24 images as QOI for the firmware's decoder (src/qoi.c).
+//
+//   qoiconv [-w width] [-h height] out.qoi in.rgb ...
+//       e.g. raw frames from `convert lenna.png lenna.rgb`. Every complete
+//       frame of the inputs is encoded, the images are written back to back.
+//
+// Frames which fit the display are decoded again with the firmware decoder,
+// checked against the input and the decode time is reported.
+//
+// Build:
+//   gcc -O2 -Isrc -o qoiconv tools/qoiconv.c src/qoi.c src/framebuf.c src/encoder.c
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "host_util.h"
+#include "framebuf.h"
+#include "qoi.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: qoiconv [-w width] [-h height] out.qoi in.rgb ...\n");
+    exit(1);
+}
+
+static uint8_t *put_u32be(uint8_t *p, uint32_t v)
+{
+    *p++ = v >> 24;
+    *p++ = v >> 16;
+    *p++ = v >> 8;
+    *p++ = v;
+    return p;
+}
+
+// Encode w * h RGB24 pixels into out (at least w * h * 4 + 22 bytes), returns the size
+static size_t qoi_encode(uint8_t *out, const uint8_t *rgb, unsigned w, unsigned h)
+{
+    uint8_t *p = out;
+    memcpy(p, "qoif", 4);
+    p = put_u32be(p + 4, w);
+    p = put_u32be(p, h);
+    *p++ = 3;   // channels
+    *p++ = 0;   // sRGB
+
+    // MSB {A, R, G, B} LSB, the empty slots are transparent black and never match
+    uint32_t cache[64] = {0};
+    uint8_t prev[3] = {0, 0, 0};
+    unsigned run = 0, n = w * h;
+
+    for (unsigned i = 0; i < n; i++) {
+        const uint8_t *c = &rgb[3 * i];
+        if (memcmp(c, prev, 3) == 0) {
+            if (++run == 62 || i == n - 1) {
+                *p++ = 0xC0 | (run - 1);
+                run = 0;
+            }
+            continue;
+        }
+        if (run) {
+            *p++ = 0xC0 | (run - 1);
+            run = 0;
+        }
+        // alpha is always 255, it is part of the hash
+        uint32_t px = 0xFF000000 | c[0] << 16 | c[1] << 8 | c[2];
+        unsigned idx = (c[0] * 3 + c[1] * 5 + c[2] * 7 + 255 * 11) & 63;
+        if (cache[idx] == px) {
+            *p++ = idx;
+        } else {
+            cache[idx] = px;
+            int dr = (int8_t)(c[0] - prev[0]), dg = (int8_t)(c[1] - prev[1]), db = (int8_t)(c[2] - prev[2]);
+            int dr_dg = dr - dg, db_dg = db - dg;
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                *p++ = 0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2);
+            } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+                *p++ = 0x80 | (dg + 32);
+                *p++ = (dr_dg + 8) << 4 | (db_dg + 8);
+            } else {
+                *p++ = 0xFE;
+                memcpy(p, c, 3);
+                p += 3;
+            }
+        }
+        memcpy(prev, c, 3);
+    }
+    static const uint8_t padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+    memcpy(p, padding, 8);
+    return p + 8 - out;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned w = 64, h = 32;
+    int c;
+    while ((c = getopt(argc, argv, "w:h:")) != -1) {
+        switch (c) {
+        case 'w': w = atoi(optarg); break;
+        case 'h': h = atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (optind + 2 > argc || w == 0 || h == 0)
+        usage();
+
+    FILE *fo = fopen(argv[optind], "wb");
+    if (!fo) {
+        perror(argv[optind]);
+        return 1;
+    }
+    size_t n_raw = (size_t)w * h * 3;
+    uint8_t *rgb = malloc(n_raw), *out = malloc((size_t)w * h * 4 + 22);
+    size_t sum_raw = 0, sum_qoi = 0;
+    unsigned n_frames = 0, n_bad = 0, n_loops = 1000;
+    double t_dec = 0;
+
+    for (int a = optind + 1; a < argc; a++) {
+        FILE *f = fopen(argv[a], "rb");
+        if (!f) {
+            perror(argv[a]);
+            return 1;
+        }
+        while (fread(rgb, n_raw, 1, f) == 1) {
+            size_t n = qoi_encode(out, rgb, w, h);
+            if (fwrite(out, n, 1, fo) != 1) {
+                perror(argv[optind]);
+                return 1;
+            }
+            n_frames++;
+            sum_raw += n_raw;
+            sum_qoi += n;
+            if (w > DISPLAY_WIDTH || h > DISPLAY_HEIGHT)
+                continue;
+
+            int64_t t0 = now_us();
+            for (unsigned i = 0; i < n_loops; i++) {
+                if (qoi_decode(out, n, 0, 0) != (int)n) {
+                    fprintf(stderr, "%s: decode failed\n", argv[a]);
+                    return 1;
+                }
+            }
+            t_dec += (double)(now_us() - t0) / n_loops;
+            for (unsigned i = 0; i < w * h; i++) {
+                const uint8_t *p = &rgb[3 * i];
+                if (getPixel(i % w, i / w) != (uint32_t)(p[0] << 16 | p[1] << 8 | p[2]))
+                    n_bad++;
+            }
+        }
+        fclose(f);
+    }
+    fclose(fo);
+
+    printf(
+        "%u frames of %ux%u, %zu -> %zu bytes (%.1f %%)\n",
+        n_frames, w, h, sum_raw, sum_qoi, sum_raw ? 100.0 * sum_qoi / sum_raw : 0
+    );
+    if (n_frames && w <= DISPLAY_WIDTH && h <= DISPLAY_HEIGHT)
+        printf("decode check: %u pixel mismatches, %.1f us per frame\n", n_bad, t_dec / n_frames);
+    return n_bad != 0;
+}
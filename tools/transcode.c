@@ -0,0 +1,378 @@
+// Convert video, GIFs and images into panel assets, in parallel over frames.
+//
+//   transcode [options] in out
+//     in     anything ffmpeg decodes (video, GIF, PNG), or raw RGB24 frames
+//            (*.rgb or - for stdin) of the size given with -s
+//     -s WxH size of raw input frames
+//     -W WxH panel size (128x32)
+//     -r fps output frame rate, ffmpeg drops / repeats frames to match (25)
+//     -p n   bits per channel shown on the panel, the bitplane count (7)
+//     -g g   gamma of the input (2.2), 1 to take the values as they are
+//     -d     ordered dither to the panel bit depth
+//     -f fmt raw:    RGB24 frames
+//            c:      RGB24 frames as a C array named after -n, like src/anim.c
+//            frec:   run-length deltas (src/framerec.h)
+//            planes: DMA-ready bitplanes from enc_runs(), n planes of
+//                    W * H / 2 uint16 per frame, brightness from -b
+//     -n name  array name for -f c (anim)
+//     -b n   OE window for -f planes (2)
+//     -j n   worker threads (all cores)
+//
+// Frames are resampled with an area average in linear light: input values are
+// linearised with the input gamma, averaged, then quantised to the panel bit
+// depth. The panel's bit code modulation is linear, so no further curve is
+// applied. Output values keep the panel bits at the top, the lower bits repeat them.
+//
+// Build:
+//   gcc -O2 -pthread -Isrc -o transcode tools/transcode.c src/framerec.c src/encoder.c -lm
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "encoder.h"
+#include "framerec.h"
+
+enum {FMT_RAW, FMT_C, FMT_FREC, FMT_PLANES};
+
+// Most worker threads, -j and the core count are clamped to this
+#define MAX_THREADS 64
+
+static struct {
+    unsigned sw, sh;        // input size
+    unsigned dw, dh;        // panel size
+    unsigned bits;
+    bool dither;
+    int fmt;
+    int brightness;
+    uint16_t lin[256];      // input value -> linear light, 0 .. 65535
+    unsigned n_threads;
+} cfg = {
+    .dw = 128, .dh = 32, .bits = 7, .fmt = FMT_RAW, .brightness = 2,
+};
+
+// 4x4 Bayer matrix, thresholds in 1/16
+static const uint8_t bayer[4][4] = {
+    {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}
+};
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: transcode [-s WxH] [-W WxH] [-r fps] [-p bits] [-g gamma] [-d]\n"
+        "                 [-f raw|c|frec|planes] [-n name] [-b brightness] [-j threads] in out\n"
+    );
+    exit(1);
+}
+
+static void parse_size(const char *s, unsigned *w, unsigned *h)
+{
+    if (sscanf(s, "%ux%u", w, h) != 2 || *w == 0 || *h == 0)
+        usage();
+}
+
+// Quantise linear light l (0 .. 65535) of pixel (x, y) to cfg.bits, keep them at the top of a byte
+static inline unsigned quantise(uint32_t l, unsigned x, unsigned y)
+{
+    uint32_t levels = (1 << cfg.bits) - 1;
+    uint32_t t = cfg.dither ? (bayer[y & 3][x & 3] * 2 + 1) * 65535 / 32 : 32767;
+    uint32_t q = (l * levels + t) / 65535;
+    if (q > levels)
+        q = levels;
+    unsigned v = 0;
+    for (int s = 8 - cfg.bits; s > -(int)cfg.bits; s -= cfg.bits)
+        v |= s >= 0 ? q << s : q >> -s;
+    return v & 0xFF;
+}
+
+// Resample, linearise and quantise one input frame into a panel frame
+static void process(const uint8_t *src, uint32_t *dst)
+{
+    for (unsigned y = 0; y < cfg.dh; y++) {
+        unsigned y0 = y * cfg.sh / cfg.dh, y1 = (y + 1) * cfg.sh / cfg.dh;
+        if (y1 <= y0)
+            y1 = y0 + 1;
+        for (unsigned x = 0; x < cfg.dw; x++) {
+            unsigned x0 = x * cfg.sw / cfg.dw, x1 = (x + 1) * cfg.sw / cfg.dw;
+            if (x1 <= x0)
+                x1 = x0 + 1;
+            uint64_t sum[3] = {0, 0, 0};
+            for (unsigned sy = y0; sy < y1; sy++) {
+                const uint8_t *p = &src[(sy * cfg.sw + x0) * 3];
+                for (unsigned sx = x0; sx < x1; sx++, p += 3) {
+                    sum[0] += cfg.lin[p[0]];
+                    sum[1] += cfg.lin[p[1]];
+                    sum[2] += cfg.lin[p[2]];
+                }
+            }
+            unsigned n = (y1 - y0) * (x1 - x0);
+            uint32_t c = 0;
+            for (int ch = 0; ch < 3; ch++)
+                c = c << 8 | quantise(sum[ch] / n, x, y);
+            dst[x + y * cfg.dw] = c;
+        }
+    }
+}
+
+// A batch of frames, processed by all workers, then written out in order
+typedef struct {
+    unsigned n;
+    uint8_t **src;
+    uint32_t **dst;
+    uint16_t **planes;      // n_planes planes per frame, only for FMT_PLANES
+} batch_t;
+
+typedef struct {
+    batch_t *b;
+    unsigned id;
+} worker_t;
+
+static void *worker(void *arg)
+{
+    worker_t *w = arg;
+    batch_t *b = w->b;
+    enc_cfg_t ecfg = {
+        .width = cfg.dw,
+        .rows = cfg.dh / 2,
+        .n_planes = cfg.bits,
+        .brightness = cfg.brightness,
+    };
+    for (unsigned i = w->id; i < b->n; i += cfg.n_threads) {
+        process(b->src[i], b->dst[i]);
+        if (cfg.fmt == FMT_PLANES) {
+            uint16_t *planes[ENC_MAX_PLANES];
+            for (unsigned pl = 0; pl < cfg.bits; pl++)
+                planes[pl] = &b->planes[i][pl * cfg.dw * ecfg.rows];
+            enc_runs(planes, b->dst[i], &ecfg);
+        }
+    }
+    return NULL;
+}
+
+// Output state
+static FILE *out;
+static framerec_t rec;
+static double fps = 25;
+static size_t n_out;        // bytes written to the C array so far
+static const char *c_name = "anim";
+
+static int write_frame(const batch_t *b, unsigned i, unsigned n)
+{
+    const uint32_t *fb = b->dst[i];
+    unsigned n_px = cfg.dw * cfg.dh;
+    uint8_t rgb[3];
+
+    switch (cfg.fmt) {
+    case FMT_RAW:
+        for (unsigned k = 0; k < n_px; k++) {
+            rgb[0] = fb[k] >> 16;
+            rgb[1] = fb[k] >> 8;
+            rgb[2] = fb[k];
+            if (fwrite(rgb, 3, 1, out) != 1)
+                return -1;
+        }
+        return 0;
+    case FMT_C:
+        for (unsigned k = 0; k < n_px; k++) {
+            for (int ch = 2; ch >= 0; ch--) {
+                // like xxd -i: 12 per line, no comma after the last
+                fprintf(out, "%s0x%02x", n_out == 0 ? "\n  " : n_out % 12 ? ", " : ",\n  ", (fb[k] >> (8 * ch)) & 0xFF);
+                n_out++;
+            }
+        }
+        return 0;
+    case FMT_FREC:
+        return framerec_write(&rec, fb, (int64_t)(n * 1e6 / fps));
+    default: {
+        size_t n_words = (size_t)cfg.bits * n_px / 2;
+        for (size_t k = 0; k < n_words; k++) {
+            uint8_t le[2] = {b->planes[i][k], b->planes[i][k] >> 8};
+            if (fwrite(le, 2, 1, out) != 1)
+                return -1;
+        }
+        return 0;
+    }
+    }
+}
+
+// Run argv[0] with its stdout on the returned stream, the path goes to it as an
+// argument and never through a shell
+static FILE *spawn(char *const argv[], pid_t *pid)
+{
+    int fd[2];
+    if (pipe(fd))
+        return NULL;
+    *pid = fork();
+    if (*pid == 0) {
+        dup2(fd[1], STDOUT_FILENO);
+        close(fd[0]);
+        close(fd[1]);
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    close(fd[1]);
+    if (*pid < 0) {
+        close(fd[0]);
+        return NULL;
+    }
+    return fdopen(fd[0], "r");
+}
+
+// Close the stream of a spawned program and wait for it. Returns -1 if it failed.
+static int reap(FILE *f, pid_t pid)
+{
+    int status;
+    fclose(f);
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        return -1;
+    return 0;
+}
+
+// Open the input as a stream of raw RGB24 frames, decoding with ffmpeg if needed.
+// *child is the decoder's pid, 0 if there is none.
+static FILE *open_input(const char *path, pid_t *child)
+{
+    size_t len = strlen(path);
+    *child = 0;
+    if (strcmp(path, "-") == 0)
+        return stdin;
+    if (len > 4 && strcmp(&path[len - 4], ".rgb") == 0)
+        return fopen(path, "rb");
+
+    if (!cfg.sw) {
+        char *probe[] = {
+            "ffprobe", "-v", "error", "-select_streams", "v:0", "-show_entries", "stream=width,height",
+            "-of", "csv=p=0", (char *)path, NULL
+        };
+        pid_t pid;
+        FILE *p = spawn(probe, &pid);
+        if (!p || fscanf(p, "%u,%u", &cfg.sw, &cfg.sh) != 2 || reap(p, pid)) {
+            fprintf(stderr, "%s: can't get the video size, is ffprobe installed?\n", path);
+            exit(1);
+        }
+    }
+    char rate[32];
+    snprintf(rate, sizeof(rate), "%g", fps);
+    char *dec[] = {
+        "ffmpeg", "-v", "error", "-i", (char *)path, "-r", rate, "-f", "rawvideo", "-pix_fmt", "rgb24", "-", NULL
+    };
+    return spawn(dec, child);
+}
+
+int main(int argc, char **argv)
+{
+    double gamma = 2.2;
+    long n_cpu = sysconf(_SC_NPROCESSORS_ONLN);
+    cfg.n_threads = n_cpu < 1 ? 1 : n_cpu > MAX_THREADS ? MAX_THREADS : n_cpu;
+    int c;
+    while ((c = getopt(argc, argv, "s:W:r:p:g:df:n:b:j:")) != -1) {
+        switch (c) {
+        case 's': parse_size(optarg, &cfg.sw, &cfg.sh); break;
+        case 'W': parse_size(optarg, &cfg.dw, &cfg.dh); break;
+        case 'r': fps = atof(optarg); break;
+        case 'p': cfg.bits = atoi(optarg); break;
+        case 'g': gamma = atof(optarg); break;
+        case 'd': cfg.dither = true; break;
+        case 'f':
+            if (strcmp(optarg, "raw") == 0) cfg.fmt = FMT_RAW;
+            else if (strcmp(optarg, "c") == 0) cfg.fmt = FMT_C;
+            else if (strcmp(optarg, "frec") == 0) cfg.fmt = FMT_FREC;
+            else if (strcmp(optarg, "planes") == 0) cfg.fmt = FMT_PLANES;
+            else usage();
+            break;
+        case 'n': c_name = optarg; break;
+        case 'b': cfg.brightness = atoi(optarg); break;
+        case 'j': cfg.n_threads = atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (optind + 2 != argc || cfg.bits < 1 || cfg.bits > 8 || fps <= 0 || gamma <= 0 || cfg.n_threads < 1 || cfg.n_threads > MAX_THREADS)
+        usage();
+    if (cfg.fmt == FMT_PLANES && (cfg.dw & 1 || cfg.dw > ENC_MAX_WIDTH || cfg.dh & 1 || cfg.dh > 2 * ENC_MAX_ROWS)) {
+        fprintf(stderr, "-f planes needs an even width up to %d and an even height up to %d\n", ENC_MAX_WIDTH, 2 * ENC_MAX_ROWS);
+        return 1;
+    }
+    for (unsigned v = 0; v < 256; v++)
+        cfg.lin[v] = lround(65535 * pow(v / 255.0, gamma));
+
+    pid_t child;
+    FILE *in = open_input(argv[optind], &child);
+    if (!in || !cfg.sw) {
+        fprintf(stderr, "%s: can't open, raw input needs -s WxH\n", argv[optind]);
+        return 1;
+    }
+    out = fopen(argv[optind + 1], "wb");
+    if (!out) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+    if (cfg.fmt == FMT_FREC && framerec_open_write(&rec, out, cfg.dw, cfg.dh))
+        return 1;
+    if (cfg.fmt == FMT_C)
+        fprintf(out, "//Auto-generated\nstatic const unsigned char my%s[]={", c_name);
+
+    // a few frames per thread per batch, input frames can be large
+    batch_t b;
+    unsigned cap = 4 * cfg.n_threads;
+    size_t src_sz = (size_t)cfg.sw * cfg.sh * 3;
+    b.src = malloc(cap * sizeof(*b.src));
+    b.dst = malloc(cap * sizeof(*b.dst));
+    b.planes = malloc(cap * sizeof(*b.planes));
+    for (unsigned i = 0; i < cap; i++) {
+        b.src[i] = malloc(src_sz);
+        b.dst[i] = malloc(cfg.dw * cfg.dh * sizeof(uint32_t));
+        b.planes[i] = cfg.fmt == FMT_PLANES ? malloc(cfg.bits * cfg.dw * cfg.dh) : NULL;
+    }
+
+    pthread_t th[cfg.n_threads];
+    worker_t w[cfg.n_threads];
+    unsigned n_frames = 0;
+    size_t got = src_sz;
+    do {
+        for (b.n = 0; b.n < cap; b.n++)
+            if ((got = fread(b.src[b.n], 1, src_sz, in)) != src_sz)
+                break;
+        for (unsigned t = 0; t < cfg.n_threads; t++) {
+            w[t] = (worker_t){&b, t};
+            pthread_create(&th[t], NULL, worker, &w[t]);
+        }
+        for (unsigned t = 0; t < cfg.n_threads; t++)
+            pthread_join(th[t], NULL);
+        for (unsigned i = 0; i < b.n; i++, n_frames++) {
+            if (write_frame(&b, i, n_frames)) {
+                fprintf(stderr, "%s: write failed\n", argv[optind + 1]);
+                return 1;
+            }
+        }
+    } while (b.n == cap);
+
+    if (cfg.fmt == FMT_C)
+        fprintf(out, "\n};\nconst unsigned char *%s=&my%s[0];\n", c_name, c_name);
+    if (cfg.fmt == FMT_FREC)
+        framerec_close(&rec);
+    long size = ftell(out);
+    fclose(out);
+    int err = ferror(in);
+    if (child)
+        err |= reap(in, child);
+    else if (in != stdin)
+        fclose(in);
+    if (err) {
+        fprintf(stderr, "%s: reading or decoding failed after %u frames\n", argv[optind], n_frames);
+        return 1;
+    }
+    if (got) {
+        fprintf(stderr, "%s: %zu bytes of a partial frame at the end\n", argv[optind], got);
+        return 1;
+    }
+    fprintf(
+        stderr, "%u frames %ux%u -> %ux%u, %u bits, %ld bytes\n",
+        n_frames, cfg.sw, cfg.sh, cfg.dw, cfg.dh, cfg.bits, size
+    );
+    return 0;
+}